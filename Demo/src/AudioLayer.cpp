@@ -55,4 +55,4 @@ void AudioLayer::ShowDebugWindow()
 	if (ImGui::Button("Play"))
 		Light::AudioEngine::Get().PlayAudio2D("res/explosion.wav");
 	ImGui::PopID();
-}
+}
\ No newline at end of file
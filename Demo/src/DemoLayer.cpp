@@ -87,6 +87,7 @@ void DemoLayer::OnUserInterfaceUpdate()
 		ImGui::Text("|-----------|----------------------|");
 		ImGui::Text("|     E     |    GraphicsAPI:GL    |");
 		ImGui::Text("|     R     |    GraphicsAPI:DX    |");
+		ImGui::Text("|     T     |    GraphicsAPI:SW    |");
 		ImGui::Text("|-----------|----------------------|");
 		ImGui::Text("|     Z     |  Resolution (4:3)    |");
 		ImGui::Text("|     X     |  Resolution (16:9)   |");
@@ -120,11 +121,29 @@ void DemoLayer::OnUserInterfaceUpdate()
 
 	if (ImGui::TreeNode("Layers"))
 	{
+		// the layers update and record the next frame while the render thread draws the previous one
+		bool renderThread = Light::Application::IsRenderThreadEnabled();
+		if (ImGui::Checkbox("render thread", &renderThread))
+			Light::Application::SetRenderThread(renderThread);
+
 		Light::Application::ShowDebugWindow();
 		ImGui::TreePop();
 	}
 	ImGui::Separator();
 
+	if (ImGui::TreeNode("Time"))
+	{
+		// 0 is unlimited, the loop sleeps between frames otherwise
+		int frameRateLimit = Light::Time::GetFrameRateLimit();
+		if (ImGui::DragInt("frame rate limit", &frameRateLimit, 1.0f, 0, 1000))
+			Light::Time::SetFrameRateLimit(frameRateLimit);
+
+		ImGui::Text("fixed step: %.2fms, alpha: %.2f", Light::Time::GetFixedDeltaTime() * 1000.0f, Light::Time::GetFixedAlpha());
+
+		ImGui::TreePop();
+	}
+	ImGui::Separator();
+
 	if (ImGui::TreeNode("Camera"))
 	{
 		m_Camera->ShowDebugWindow();
@@ -157,6 +176,13 @@ void DemoLayer::OnUserInterfaceUpdate()
 	}
 	ImGui::Separator();
 
+	if (ImGui::TreeNode("Renderer"))
+	{
+		Light::Renderer::ShowDebugWindow();
+		ImGui::TreePop();
+	}
+	ImGui::Separator();
+
 	if (ImGui::TreeNode("Input"))
 	{
 		Light::Input::ShowDebugWindow();
@@ -188,7 +214,7 @@ bool DemoLayer::OnKeyPress(Light::KeyboardKeyPressedEvent& event)
 		Light::Window::Get()->Close();
 
 	// change graphics context
-	if (event.GetKey() == KEY_E || event.GetKey() == KEY_R)
+	if (event.GetKey() == KEY_E || event.GetKey() == KEY_R || event.GetKey() == KEY_T)
 	{
 		// detach layers before deleting
 		Light::Application::DetachLayer(m_QuadsLayer);
@@ -201,7 +227,9 @@ bool DemoLayer::OnKeyPress(Light::KeyboardKeyPressedEvent& event)
 		delete m_TextLayer;
 
 		// change context
-		Light::GraphicsContext::CreateContext(event.GetKey() == KEY_E ? Light::GraphicsAPI::Opengl : Light::GraphicsAPI::Directx,
+		Light::GraphicsContext::CreateContext(event.GetKey() == KEY_E ? Light::GraphicsAPI::Opengl  :
+		                                      event.GetKey() == KEY_R ? Light::GraphicsAPI::Directx :
+		                                                                Light::GraphicsAPI::Software,
 		                                      Light::GraphicsContext::GetConfigurations());
 
 		// construct layers
@@ -7,10 +7,18 @@ PostProcessLayer::PostProcessLayer()
 	LT_TRACE("PostProcessLayer::PostProcessLayer");
 	m_LayeDebugrName = "PostProcessLayer";
 
-	// create framebuffers
-	m_Grayscale = Light::Framebuffer::Create("res/FramebuffersVS.shader", "res/GrayscalePS.shader");
-	m_Inverse = Light::Framebuffer::Create("res/FramebuffersVS.shader", "res/InversePS.shader");
-	m_Kernel = Light::Framebuffer::Create("res/FramebuffersVS.shader", "res/KernelPS.shader");
+	// per-pixel effects, the renderer fuses consecutive ones into a single pass
+	m_Grayscale.name = "grayscale";
+	m_Grayscale.glsl = "float avg = 0.2126 * color.r + 0.7152 * color.g + 0.0722 * color.b; color = vec4(avg, avg, avg, 1.0);";
+	m_Grayscale.hlsl = "float avg = 0.2126 * color.r + 0.7152 * color.g + 0.0722 * color.b; color = float4(avg, avg, avg, 1.0);";
+
+	m_Inverse.name = "inverse";
+	m_Inverse.glsl = "color = vec4(1.0 - color.rgb, 1.0);";
+	m_Inverse.hlsl = "color = float4(1.0 - color.rgb, 1.0);";
+
+	// sampling effect, reads the neighbouring texels
+	m_Kernel.name = "kernel";
+	m_Kernel.pixelShader = "res/KernelPS.shader";
 	
 	// create and set the kernel data
 	m_KernelData = Light::ConstantBuffer::Create(Light::ConstantBufferIndex_ClientSlot0, sizeof(float) * 16);
@@ -19,13 +27,7 @@ PostProcessLayer::PostProcessLayer()
 	                                1.0f, -8.0f, 1.0f,
 	                                1.0f,  1.0f, 1.0f);
 
-	float* map = (float*)m_KernelData->Map();
-
-	memcpy(map, glm::value_ptr(m_ConvolutionMatrix), sizeof(glm::mat3));
-	*(map + 12) = 1.0f / Light::GraphicsContext::GetResolution().width;
-	*(map + 13) = 1.0f / Light::GraphicsContext::GetResolution().height;
-
-	m_KernelData->UnMap();
+	UpdateKernelData();
 }
 
 void PostProcessLayer::OnAttach()
@@ -42,32 +44,46 @@ void PostProcessLayer::ShowDebugWindow()
 {
 	ImGui::BulletText("**** order matters ****");
 
-	// add or remove the specified framebuffers, order matters
+	// add or remove the specified effects, order matters
 	if (ImGui::Checkbox("grayscale", &m_GrayscaleAttached))
 	{
 		if (m_GrayscaleAttached)
-			Light::Renderer::AddFramebuffer(m_Grayscale);
+			Light::Renderer::AddPostProcessEffect(m_Grayscale);
 
 		if (!m_GrayscaleAttached)
-			Light::Renderer::RemoveFramebuffer(m_Grayscale);
+			Light::Renderer::RemovePostProcessEffect(LT_SID("grayscale"));
 	}
 
 	if (ImGui::Checkbox("inverse", &m_InverseAttached))
 	{
 		if (m_InverseAttached)
-			Light::Renderer::AddFramebuffer(m_Inverse);
+			Light::Renderer::AddPostProcessEffect(m_Inverse);
 
 		if (!m_InverseAttached)
-			Light::Renderer::RemoveFramebuffer(m_Inverse);
+			Light::Renderer::RemovePostProcessEffect(LT_SID("inverse"));
 	}
 
 	if (ImGui::Checkbox("kernel", &m_KernelAttached))
 	{
 		if (m_KernelAttached)
-			Light::Renderer::AddFramebuffer(m_Kernel);
+			Light::Renderer::AddPostProcessEffect(m_Kernel);
 
 		if (!m_KernelAttached)
-			Light::Renderer::RemoveFramebuffer(m_Kernel);
+			Light::Renderer::RemovePostProcessEffect(LT_SID("kernel"));
+	}
+
+	// the kernel is cheaper at a reduced resolution and upsampled back
+	static const char* scales[] = { "full", "half", "quarter" };
+	int scale = m_Kernel.scale == Light::PostProcessScale::Full ? 0 : m_Kernel.scale == Light::PostProcessScale::Half ? 1 : 2;
+
+	if (ImGui::Combo("kernel resolution", &scale, scales, 3))
+	{
+		m_Kernel.scale = (Light::PostProcessScale)(1u << scale);
+		UpdateKernelData();
+
+		// replaced in place
+		if (m_KernelAttached)
+			Light::Renderer::AddPostProcessEffect(m_Kernel);
 	}
 
 	// change values of kernel effect's convolution matrix, for more information about kernel effects:
@@ -81,32 +97,22 @@ void PostProcessLayer::ShowDebugWindow()
 		valueChanged += ImGui::DragFloat3("bottom", &m_ConvolutionMatrix[2][0], 0.01f, NULL, NULL, "%.2f");
 
 		if (valueChanged)
-		{
-			float* map = (float*)m_KernelData->Map();
-
-			memcpy(map, glm::value_ptr(m_ConvolutionMatrix), sizeof(glm::mat3));
-			*(map + 12) = 1.0f / Light::GraphicsContext::GetResolution().width;
-			*(map + 13) = 1.0f / Light::GraphicsContext::GetResolution().height;
-
-			m_KernelData->UnMap();
-		}
+			UpdateKernelData();
 
 		ImGui::TreePop();
 	}
 }
 
-void PostProcessLayer::OnEvent(Light::Event& event)
+void PostProcessLayer::UpdateKernelData()
 {
-	Light::Dispatcher dispatcher(event);
-	dispatcher.Dispatch<Light::WindowResizedEvent>(LT_EVENT_FN(PostProcessLayer::OnWindowResize));
-}
+	// offsets are one texel of the kernel's input, which has the size of the effect's output
+	const float scale = (float)m_Kernel.scale;
 
-bool PostProcessLayer::OnWindowResize(Light::WindowResizedEvent& event)
-{
-	// resize framebuffers to the size of the window
-	m_Grayscale->Resize(event.GetWidth(), event.GetHeight());
-	m_Inverse->Resize(event.GetWidth(), event.GetHeight());
-	m_Kernel->Resize(event.GetWidth(), event.GetHeight());
+	float* map = (float*)m_KernelData->Map();
 
-	return false;
-}
+	memcpy(map, glm::value_ptr(m_ConvolutionMatrix), sizeof(glm::mat3));
+	*(map + 12) = scale / Light::GraphicsContext::GetResolution().width;
+	*(map + 13) = scale / Light::GraphicsContext::GetResolution().height;
+
+	m_KernelData->UnMap();
+}
\ No newline at end of file
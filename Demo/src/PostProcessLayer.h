@@ -5,7 +5,7 @@
 class PostProcessLayer : public Light::Layer
 {
 private:
-	std::shared_ptr<Light::Framebuffer> m_Grayscale, m_Inverse, m_Kernel;
+	Light::PostProcessEffect m_Grayscale, m_Inverse, m_Kernel;
 
 	std::shared_ptr<Light::ConstantBuffer> m_KernelData;
 	glm::mat3 m_ConvolutionMatrix;
@@ -18,8 +18,6 @@ public:
 	void OnDetatch() override;
 
 	void ShowDebugWindow() override;
-
-	void OnEvent(Light::Event& event) override;
 private:
-	bool OnWindowResize(Light::WindowResizedEvent& event);
+	void UpdateKernelData();
 };
\ No newline at end of file
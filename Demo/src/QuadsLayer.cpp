@@ -7,15 +7,16 @@ QuadsLayer::QuadsLayer(std::shared_ptr<Light::Camera> camera)
 	LT_TRACE("QuadsLayer::QuadsLayer");
 	m_LayeDebugrName = "QuadsLayer";
 
-	// load texture atlas
-	Light::ResourceManager::LoadTextureAtlas("QuadsLayerAtlas", "res/atlas.png", "res/atlas.txt");
+	// load texture atlas, the packed layout and mips come from the cache, it's (re)baked if missing or stale
+	Light::ResourceManager::SetTextureCache("res/textures.ltcache");
+	Light::ResourceManager::LoadTextureManifest("res/textures.manifest");
 	// call ResolceTextures after you've loaded all textures / texture atlases.
 	Light::ResourceManager::ResolveTextures(); 
 
 	// get texture atlas (it doesn't matter if it has an atlas or not, all textures can be retrived with ResourceManager::GetTexture).
-	std::shared_ptr<Light::Texture> atlas = Light::ResourceManager::GetTexture("QuadsLayerAtlas");
+	std::shared_ptr<Light::Texture> atlas = Light::ResourceManager::GetTexture(LT_SID("QuadsLayerAtlas"));
 	// get atlas's SubTexture's texture coordinates
-	Light::TextureCoordinates* awesomefaceUV = atlas->GetSubTextureUV("awesomeface");
+	Light::TextureCoordinates* awesomefaceUV = atlas->GetSubTextureUV(LT_SID("awesomeface"));
 
 	// create sprites
 	for (int i = 0; i < 125; i++)
@@ -62,33 +63,32 @@ void QuadsLayer::OnUpdate(float DeltaTime)
 		m_SelectedSprite->position = glm::vec3(Light::Input::MousePosToCameraView(m_Camera), m_DrawPriority); // converts mouse pos to world pos
 }
 
-void QuadsLayer::OnRender()
+void QuadsLayer::OnRender(Light::RenderCommandList& commands)
 {
-	// ** all Renderer functions should be called in OnRender() function because it is wrapped with Renderer::Begin/EndFrame.
+	// ** OnRender records into the layer's own command list on a worker thread, the lists of all layers
+	//     are submitted in layer order once they're recorded. only read the layer's state here, it's updated in OnUpdate.
 
-	// all layers should specify whether their quads should be renderer with blending enabled or disabled because previous layers
-	//     can change the blending state.
+	// the blending state is a part of the command list, it starts disabled every frame.
 
 	// note: you can't enable and disable this between DrawQuads, Renderer batches all the quads together to minimize render calls,
 	//     you can have only one blending state for each EndScene.
-	Light::Blender::Get()->Enable();
+	commands.SetBlending(true);
 
 	// we have to call BeginScene before any drawing session
-	Light::Renderer::BeginScene(m_Camera);
+	commands.BeginScene(m_Camera);
 
 	// note: each layer's m_DrawPriority is different from the next/previous layer by 1.0f,
-	//    and all DrawString calls gets rendered after DrawQuads call (when Renderer::EndScene is called),
-	//    so if you want to have a string drawn in front of a quad in a single Renderer::Begin/EndScene,
+	//    and all DrawString calls gets rendered after DrawQuads call (when EndScene is called),
+	//    so if you want to have a string drawn in front of a quad in a single Begin/EndScene,
 	//    you have to pass a value no greater than 0.99..., otherwise it would be rendered in front of the next layer
 
 	// note: do not use DrawQuad with angle parameter if the angle is always 0,
 	//     calculating quad's vertices' rotated position is a bit costly.
 	for (const auto& sprite : m_Sprites)
-		Light::Renderer::DrawQuad(glm::vec3(sprite.position, m_DrawPriority), sprite.size, glm::radians(m_Angle), sprite.uv, sprite.tint); 
+		commands.DrawQuad(glm::vec3(sprite.position, m_DrawPriority), sprite.size, glm::radians(m_Angle), sprite.uv, sprite.tint); 
 
-	// we have to call EndScene before another BeginScene, otherwise it results in mapping Vertexbuffer twice without
-	//     unmapping it, which results in a runtime error.
-	Light::Renderer::EndScene();
+	// we have to call EndScene before another BeginScene.
+	commands.EndScene();
 }
 
 void QuadsLayer::ShowDebugWindow()
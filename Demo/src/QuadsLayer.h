@@ -31,7 +31,7 @@ public:
 	void OnDetatch() override;
 	
 	void OnUpdate(float DeltaTime) override;
-	void OnRender() override;
+	void OnRender(Light::RenderCommandList& commands) override;
 
 	void ShowDebugWindow() override;
 
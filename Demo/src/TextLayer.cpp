@@ -7,28 +7,28 @@ TextLayer::TextLayer(std::shared_ptr<Light::Camera> camera)
 	LT_TRACE("TextLayer::TextLayer");
 	m_LayeDebugrName = "TextLayer";
 
-	// load Fonts
-	Light::ResourceManager::LoadFont("arial", "res/arial.ttf", 24);
-	Light::ResourceManager::LoadFont("comic", "res/comic.ttf", 24);
-	Light::ResourceManager::LoadFont("impact", "res/impact.ttf", 24);
+	// load Fonts, drawn scaled up so signed distance fields keep them crisp
+	Light::ResourceManager::LoadSDFFont("arial", "res/arial.ttf", 24);
+	Light::ResourceManager::LoadSDFFont("comic", "res/comic.ttf", 24);
+	Light::ResourceManager::LoadSDFFont("impact", "res/impact.ttf", 24);
 
 	// initialize Texts
 	m_Arial.content = "The quick brown fox jumps over the lazy dog";
-	m_Arial.font = Light::ResourceManager::GetFont("arial");
+	m_Arial.font = Light::ResourceManager::GetFont(LT_SID("arial"));
 	m_Arial.position = glm::vec3(0.0f, -800.0f, m_DrawPriority);
 	m_Arial.scale = 3.2f;
 
 	m_Arial.tint = glm::vec4(255.0f / 255.0f, 57.0f / 255.0f , 57.0f / 255.0f, 1.0f);
 
 	m_Comic.content = "The quick brown fox jumps over the lazy dog";
-	m_Comic.font = Light::ResourceManager::GetFont("comic");
+	m_Comic.font = Light::ResourceManager::GetFont(LT_SID("comic"));
 	m_Comic.scale = 3.2f;
 	m_Comic.position = glm::vec3(0.0f, -700.0f, m_DrawPriority);
 
 	m_Comic.tint = glm::vec4(14.0f / 255.0f, 163.0f / 255.0f, 255.0f / 255.0f, 1.0f);
 
 	m_Impact.content = "The quick brown fox jumps over the lazy dog";
-	m_Impact.font = Light::ResourceManager::GetFont("impact");
+	m_Impact.font = Light::ResourceManager::GetFont(LT_SID("impact"));
 	m_Impact.position = glm::vec3(100.0f, -600.0f, m_DrawPriority);
 	m_Impact.scale = 3.2f;
 
@@ -56,35 +56,31 @@ void TextLayer::OnDetatch()
 	LT_TRACE("TextLayer::OnDetatch");
 }
 
-void TextLayer::OnRender()
+void TextLayer::OnRender(Light::RenderCommandList& commands)
 {
 	// note: each layer's m_DrawPriority is different from the next/previous layer by 1.0f,
-	//    and all DrawString calls gets rendered after DrawQuads call (when Renderer::EndScene is called),
-	//    so if you want to have a string drawn in front of a quad in a single Renderer::Begin/EndScene,
+	//    and all DrawString calls gets rendered after DrawQuads call (when EndScene is called),
+	//    so if you want to have a string drawn in front of a quad in a single Begin/EndScene,
 	//    you have to pass a value no greater than 0.99..., otherwise it would be rendered in front of the next layer
 
-	// all layers should specify whether their quads should be renderer with blending enabled or disabled because previous layers
-	//     can change the blending state.
+	// the blending state is a part of the layer's command list, it starts disabled every frame.
 
 	// note: you can't enable and disable this between DrawQuads, Renderer batches all the quads together to minimize render calls,
 	//     you can have only one blending state for each EndScene.
-	if(m_BlenderEnabled)
-		Light::Blender::Get()->Enable();
-	else
-		Light::Blender::Get()->Disable();
+	commands.SetBlending(m_BlenderEnabled);
 
-	Light::Renderer::BeginScene(m_Camera);
-	Light::Renderer::DrawString("The quick brown fox jumps over the lazy dog", m_Arial.font,
-	                            glm::vec3(m_Arial.position, m_DrawPriority), m_Arial.scale, m_Arial.tint);
+	commands.BeginScene(m_Camera);
+	commands.DrawString("The quick brown fox jumps over the lazy dog", m_Arial.font,
+	                    glm::vec3(m_Arial.position, m_DrawPriority), m_Arial.scale, m_Arial.tint);
 
 	// again, do not call the function with angle parameter if it's always 0, calculating quad's vertices' rotated position is a bit costly.
 	//     this amplifies on rendering strings because each character counts as a separate quad.
-	Light::Renderer::DrawString("The quick brown fox jumps over the lazy dog", m_Comic.font,
-	                            glm::vec3(m_Comic.position, m_DrawPriority), glm::radians(m_Angle), m_Comic.scale, m_Comic.tint);
+	commands.DrawString("The quick brown fox jumps over the lazy dog", m_Comic.font,
+	                    glm::vec3(m_Comic.position, m_DrawPriority), glm::radians(m_Angle), m_Comic.scale, m_Comic.tint);
 
-	Light::Renderer::DrawString("The quick brown fox jumps over the lazy dog", m_Impact.font,
-	                            glm::vec3(m_Impact.position, m_DrawPriority), m_Impact.scale, m_Impact.tint);
-	Light::Renderer::EndScene();
+	commands.DrawString("The quick brown fox jumps over the lazy dog", m_Impact.font,
+	                    glm::vec3(m_Impact.position, m_DrawPriority), m_Impact.scale, m_Impact.tint);
+	commands.EndScene();
 }
 
 void TextLayer::ShowDebugWindow()
@@ -106,4 +102,4 @@ void TextLayer::ShowDebugWindow()
 	ImGui::PushID("impact");
 	m_Impact.ShowDebugWindow();
 	ImGui::PopID();
-}
+}
\ No newline at end of file
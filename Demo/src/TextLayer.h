@@ -38,7 +38,7 @@ public:
 	void OnAttach() override;
 	void OnDetatch() override;
 
-	void OnRender() override;
+	void OnRender(Light::RenderCommandList& commands) override;
 
 	void ShowDebugWindow() override;
 };
\ No newline at end of file
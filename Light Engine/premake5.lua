@@ -58,6 +58,7 @@ project "Light Engine"
 			"d3d11.lib"       ,
 			"dxguid.lib"      ,
 			"D3DCompiler.lib" ,
+			"winmm.lib"       ,
 		}
 
 
@@ -4,6 +4,7 @@
 #include "Timer.h"
 #include "Window.h"
 #include "Monitor.h"
+#include "RenderThread.h"
 
 #include "Events/Event.h"
 #include "Events/WindowEvents.h"
@@ -12,11 +13,16 @@
 
 #include "Layers/Layer.h"
 
+#include "Renderer/GraphicsContext.h"
 #include "Renderer/RenderCommand.h"
+#include "Renderer/RenderCommandList.h"
 #include "Renderer/Renderer.h"
 
 #include "UserInterface/UserInterface.h"
 
+#include "Utility/ResourceManager.h"
+#include "Utility/JobSystem.h"
+
 namespace Light {
 
 	Application* Application::s_Instance = nullptr;
@@ -26,6 +32,7 @@ namespace Light {
 		LT_PROFILE_FUNC();
 
 		Logger::Init();
+		JobSystem::Init();
 		srand(time(NULL));
 
 		LT_CORE_ASSERT(!s_Instance, "Application::Application: multiple Application instances");
@@ -50,7 +57,21 @@ namespace Light {
 
 		s_Instance = nullptr;
 
+		// GameLoop was left by an exception, the render thread may still be drawing
+		if (RenderThread::IsRunning())
+		{
+			try
+			{
+				RenderThread::Stop();
+			}
+			catch (...)
+			{
+				LT_CORE_ERROR("Application::~Application: the render thread threw while the game loop was unwinding");
+			}
+		}
+
 		LT_FILE_INFO("Application::~Application: total application runtime: {}s", Time::ElapsedTime());
+		JobSystem::Terminate();
 		Logger::Terminate();
 	}
 
@@ -64,39 +85,41 @@ namespace Light {
 
 		while (!m_Window->IsClosed())
 		{
+			// Stop waits for the frame being drawn
+			if (b_RenderThread != RenderThread::IsRunning())
+				b_RenderThread ? RenderThread::Start() : RenderThread::Stop();
+
 			Time::CalculateDeltaTime();
 
+			{
+				// fixed update
+				LT_PROFILE_SCOPE("Application::GameLoop::OnFixedUpdate");
+				while (Time::ConsumeFixedStep())
+					for (const auto& it = m_LayerStack.begin(); it != m_LayerStack.end(); m_LayerStack.next())
+						if ((*it)->IsEnabled())
+							(*it)->OnFixedUpdate(Time::GetFixedDeltaTime());
+			}
+
 			{
 				// update
 				LT_PROFILE_SCOPE("Application::GameLoop::OnUpdate");
-				for (const auto& it = m_LayerStack.begin(); it != m_LayerStack.end(); m_LayerStack.next())
-					if ((*it)->IsEnabled())
-						(*it)->OnUpdate(Time::GetDeltaTime());
+				m_LayerStack.OnUpdate(Time::GetDeltaTime());
 			}
 
-			if (!m_Window->IsMinimized())
+			FramePacket& packet = m_FramePackets[m_FramePacketIndex];
+			packet.visible = !m_Window->IsMinimized();
+			packet.contextGeneration = GraphicsContext::GetGeneration();
+
+			if (packet.visible)
 			{
-				{
-					// render
-					LT_PROFILE_SCOPE("Application::GameLoop::OnRender");
-					Renderer::BeginFrame();
-					for (const auto& it = m_LayerStack.begin(); it != m_LayerStack.end(); m_LayerStack.next())
-						if ((*it)->IsEnabled())
-							(*it)->OnRender();
-					Renderer::EndFrame();
-				}
-
-				{
-					// user interface
-					LT_PROFILE_SCOPE("Application::GameLoop::OnUserInterface");
-					UserInterface::Get()->Begin();
-					for (const auto& it = m_LayerStack.begin(); it != m_LayerStack.end(); m_LayerStack.next())
-						if ((*it)->IsEnabled())
-							(*it)->OnUserInterfaceUpdate();
-					UserInterface::Get()->End();
-				}
+				// render
+				LT_PROFILE_SCOPE("Application::GameLoop::OnRender");
+				RecordLayers(packet);
 			}
 
+			// the previous frame is drawn and the graphics context is back on this thread
+			RenderThread::Wait();
+
 			{
 				// handle event
 				LT_PROFILE_SCOPE("Application::GameLoop::HandleEvents");
@@ -104,12 +127,46 @@ namespace Light {
 			}
 
 			{
-				// swap buffers and clear buffer
-				LT_PROFILE_SCOPE("Application::GameLoop::RenderCommand");
-				RenderCommand::SwapBuffers();
-				RenderCommand::ClearBackbuffer();
+				// move textures out of sparse slices left behind by deleted ones,
+				// the texels they leave stay until the slice is written again so the recorded lists still draw them
+				LT_PROFILE_SCOPE("Application::GameLoop::DefragmentTextures");
+				ResourceManager::DefragmentTextures();
+			}
+
+			if (packet.visible)
+			{
+				// the layers edit static batches while the render thread draws, the batches are uploaded here
+				// after it's done with them and after they're repacked for the moved textures
+				LT_PROFILE_SCOPE("Application::GameLoop::UploadStaticBatches");
+				for (unsigned int i = 0; i < packet.commandListCount; i++)
+					Renderer::UploadStaticBatches(*packet.commandLists[i]);
+			}
+
+			if (packet.visible)
+			{
+				// user interface
+				LT_PROFILE_SCOPE("Application::GameLoop::OnUserInterface");
+				UserInterface::Get()->Begin();
+				for (const auto& it = m_LayerStack.begin(); it != m_LayerStack.end(); m_LayerStack.next())
+					if ((*it)->IsEnabled())
+						(*it)->OnUserInterfaceUpdate();
+				packet.userInterface = UserInterface::Get()->Render();
 			}
+
+			if (RenderThread::IsRunning())
+			{
+				// the next frame is recorded into the other packet while this one is drawn
+				RenderThread::Submit([this, &packet]() { DrawFramePacket(packet); });
+				m_FramePacketIndex = (m_FramePacketIndex + 1u) % 2u;
+			}
+			else
+				DrawFramePacket(packet);
+
+			// without v-sync the loop would take a whole core
+			Time::LimitFrameRate();
 		}
+
+		RenderThread::Stop();
 	}
 
 	void Application::OnEvent(Event& event)
@@ -136,6 +193,67 @@ namespace Light {
 		dispatcher.Dispatch<WindowClosedEvent>(LT_EVENT_FN(Application::OnWindowClosedEvent));
 	}
 
+	void Application::RecordLayers(FramePacket& packet)
+	{
+		LT_PROFILE_FUNC();
+
+		m_RenderLayers.clear();
+		for (const auto& it = m_LayerStack.begin(); it != m_LayerStack.end(); m_LayerStack.next())
+			if ((*it)->IsEnabled())
+				m_RenderLayers.push_back(*it);
+
+		packet.commandListCount = (unsigned int)m_RenderLayers.size();
+		if (m_RenderLayers.empty())
+			return;
+
+		while (packet.commandLists.size() < m_RenderLayers.size())
+			packet.commandLists.push_back(std::make_unique<RenderCommandList>());
+
+		// lists take the renderer's state when they're reset, before any layer records
+		for (unsigned int i = 0; i < m_RenderLayers.size(); i++)
+			packet.commandLists[i]->Reset();
+
+		// the main thread records layers too, the layers may change once every list is recorded
+		JobSystem::ParallelFor((unsigned int)m_RenderLayers.size(), 1u, [this, &packet](unsigned int begin, unsigned int end)
+		{
+			for (unsigned int i = begin; i < end; i++)
+				m_RenderLayers[i]->OnRender(*packet.commandLists[i]);
+		});
+	}
+
+	void Application::DrawFramePacket(const FramePacket& packet)
+	{
+		LT_PROFILE_FUNC();
+
+		if (packet.visible)
+		{
+			{
+				// render
+				LT_PROFILE_SCOPE("Application::DrawFramePacket::Render");
+				Renderer::BeginFrame();
+
+				if (packet.contextGeneration == GraphicsContext::GetGeneration())
+					for (unsigned int i = 0; i < packet.commandListCount; i++)
+						Renderer::Submit(*packet.commandLists[i]);
+
+				Renderer::EndFrame();
+			}
+
+			{
+				// user interface
+				LT_PROFILE_SCOPE("Application::DrawFramePacket::UserInterface");
+				UserInterface::Get()->Draw(packet.userInterface);
+			}
+		}
+
+		{
+			// swap buffers and clear buffer
+			LT_PROFILE_SCOPE("Application::DrawFramePacket::RenderCommand");
+			RenderCommand::SwapBuffers();
+			RenderCommand::ClearBackbuffer();
+		}
+	}
+
 	bool Application::OnWindowClosedEvent(WindowClosedEvent& event)
 	{
 		m_Window->Close();
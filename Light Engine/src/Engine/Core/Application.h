@@ -4,18 +4,46 @@
 
 #include "Layers/LayerStack.h"
 
+struct ImDrawData;
+
 namespace Light {
 
 	class Window;
 
+	class RenderCommandList;
+
 	class Event;
 	class WindowClosedEvent;
 
 	class Application
 	{
 	private:
+		// what's drawn for a frame, recorded by the main thread while the render thread draws the previous one
+		struct FramePacket
+		{
+			// one per enabled layer, kept between frames with their staging memory
+			std::vector<std::unique_ptr<RenderCommandList>> commandLists;
+			unsigned int commandListCount = 0u;
+
+			// valid until the next UserInterface::Begin, which comes after the packet is drawn
+			ImDrawData* userInterface = nullptr;
+
+			// the scene is dropped if the graphics context was recreated after it was recorded
+			uint32_t contextGeneration = 0u;
+
+			bool visible = false;
+		};
+
 		static Application* s_Instance;
 		LayerStack m_LayerStack;
+
+		// double-buffered, the render thread draws one while the other is recorded
+		FramePacket m_FramePackets[2];
+		unsigned int m_FramePacketIndex = 0u;
+
+		std::vector<Layer*> m_RenderLayers;
+
+		bool b_RenderThread = false;
 	protected:
 		std::unique_ptr<Window> m_Window;
 	public:
@@ -32,7 +60,20 @@ namespace Light {
 		void OnEvent(Event& event);
 
 		static inline void ShowDebugWindow() { s_Instance->m_LayerStack.ShowDebugWindow(); };
+
+		// draws on a render thread, which owns the graphics context while the layers update and record the next frame
+		// OnUpdate and OnRender can't use the graphics context then, it's available to OnEvent and OnUserInterfaceUpdate
+		// started or stopped at the beginning of the next frame
+		static inline void SetRenderThread(bool enabled) { s_Instance->b_RenderThread = enabled; }
+
+		static inline bool IsRenderThreadEnabled() { return s_Instance->b_RenderThread; }
 	private:
+		// records the enabled layers' command lists on the job system
+		void RecordLayers(FramePacket& packet);
+
+		// the render thread's frame, or the main thread's if it isn't running
+		void DrawFramePacket(const FramePacket& packet);
+
 		bool OnWindowClosedEvent(WindowClosedEvent& event);
 	};
 
@@ -26,9 +26,13 @@
 	#define LT_DX(x)
 #endif
 
+// __LINE__ has to be expanded before it's pasted
+#define LT_CONCAT_IMPL(a, b) a##b
+#define LT_CONCAT(a, b) LT_CONCAT_IMPL(a, b)
+
 // benchmark
 #if !defined(LIGHT_DIST) && !defined(DISABLE_LIGHT_BENCHMARKING)
-	#define LT_PROFILE_SCOPE(name) ::Light::InstrumentationTimer timer##__LINE__(name) 
+	#define LT_PROFILE_SCOPE(name) ::Light::InstrumentationTimer LT_CONCAT(timer, __LINE__)(name)
 	#define LT_PROFILE_FUNC() LT_PROFILE_SCOPE(__FUNCSIG__)
 
 	#define LT_PROFILE_SESSION_BEGIN(filePath) ::Light::Instrumentor::Get().BeginSession(filePath) 
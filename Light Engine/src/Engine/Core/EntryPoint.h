@@ -23,17 +23,18 @@ int main()
 	Light::Application* app = nullptr;
 	int exitCode = 0;
 
+	// the traces are converted to JSON by the TraceConverter
 	try
 	{
 		// create
-		LT_PROFILE_SESSION_BEGIN("Create.json");
+		LT_PROFILE_SESSION_BEGIN("Create.lttrace");
 		app = Light::CreateApplication();
 		LT_PROFILE_SESSION_END();
 
 		LT_CORE_ASSERT(app, "main: Light::Application is not initialized");
 
 		// game loop
-		LT_PROFILE_SESSION_BEGIN("GameLoop.json");
+		LT_PROFILE_SESSION_BEGIN("GameLoop.lttrace");
 		app->GameLoop();
 		LT_PROFILE_SESSION_END();
 	}
@@ -54,7 +55,7 @@ int main()
 	}
 
 	// delete
-	LT_PROFILE_SESSION_BEGIN("Delete.json");
+	LT_PROFILE_SESSION_BEGIN("Delete.lttrace");
 	delete app;
 	LT_PROFILE_SESSION_END();
 
@@ -34,6 +34,9 @@ namespace Light {
 
 		LT_CORE_ASSERT(s_Count, "Monitor::Init: no monitors are connected or an error has been occurd");
 
+		// handles of a previous window's monitors
+		s_Handles.clear();
+
 		for (int i = 0; i < s_Count; i++)
 			s_Handles.push_back(std::make_shared<Monitor>(i));
 
@@ -0,0 +1,134 @@
+#include "ltpch.h"
+#include "RenderThread.h"
+
+#include "Renderer/GraphicsContext.h"
+
+namespace Light {
+
+	std::thread RenderThread::s_Thread;
+
+	std::mutex RenderThread::s_Mutex;
+	std::condition_variable RenderThread::s_Condition;
+
+	std::function<void()> RenderThread::s_Frame;
+
+	bool RenderThread::s_Submitted = false;
+
+	std::exception_ptr RenderThread::s_Exception;
+	bool RenderThread::s_Running = false;
+
+	void RenderThread::Start()
+	{
+		LT_PROFILE_FUNC();
+		LT_CORE_ASSERT(!s_Running, "RenderThread::Start: recalled before calling RenderThread::Stop()");
+
+		s_Running = true;
+		s_Thread = std::thread(&RenderThread::ThreadLoop);
+	}
+
+	void RenderThread::Stop()
+	{
+		if (!s_Running)
+			return;
+
+		LT_PROFILE_FUNC();
+
+		WaitForFrame();
+
+		{
+			std::lock_guard<std::mutex> lock(s_Mutex);
+			s_Running = false;
+		}
+
+		s_Condition.notify_all();
+		s_Thread.join();
+
+		RethrowException();
+	}
+
+	void RenderThread::Submit(std::function<void()> frame)
+	{
+		LT_CORE_ASSERT(s_Running, "RenderThread::Submit: the render thread isn't running");
+		LT_CORE_ASSERT(!s_Submitted, "RenderThread::Submit: the previous frame wasn't waited for");
+
+		GraphicsContext::Get()->MakeCurrent(false);
+
+		{
+			std::lock_guard<std::mutex> lock(s_Mutex);
+			s_Frame = std::move(frame);
+			s_Submitted = true;
+		}
+
+		s_Condition.notify_all();
+	}
+
+	void RenderThread::Wait()
+	{
+		WaitForFrame();
+		RethrowException();
+	}
+
+	void RenderThread::WaitForFrame()
+	{
+		if (!s_Submitted)
+			return;
+
+		LT_PROFILE_FUNC();
+
+		{
+			std::unique_lock<std::mutex> lock(s_Mutex);
+			s_Condition.wait(lock, []() { return !s_Frame; });
+
+			s_Submitted = false;
+		}
+
+		GraphicsContext::Get()->MakeCurrent(true);
+		GraphicsContext::s_ContextThread = std::this_thread::get_id();
+	}
+
+	void RenderThread::ThreadLoop()
+	{
+		while (true)
+		{
+			{
+				std::unique_lock<std::mutex> lock(s_Mutex);
+				s_Condition.wait(lock, []() { return !s_Running || s_Frame; });
+
+				// Stop waits for the frame being drawn, nothing is left
+				if (!s_Running)
+					return;
+			}
+
+			// the main thread doesn't touch the frame nor the graphics context until it's drawn
+			GraphicsContext::Get()->MakeCurrent(true);
+			GraphicsContext::s_ContextThread = std::this_thread::get_id();
+
+			// main() reports the engine's exceptions, they're handed to the main thread instead of terminating
+			try
+			{
+				s_Frame();
+			}
+			catch (...)
+			{
+				s_Exception = std::current_exception();
+			}
+
+			GraphicsContext::Get()->MakeCurrent(false);
+
+			{
+				std::lock_guard<std::mutex> lock(s_Mutex);
+				s_Frame = nullptr;
+			}
+
+			s_Condition.notify_all();
+		}
+	}
+
+	void RenderThread::RethrowException()
+	{
+		// written before the frame was marked drawn, under the mutex
+		if (std::exception_ptr exception = std::exchange(s_Exception, nullptr))
+			std::rethrow_exception(exception);
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "Core.h"
+
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+namespace Light {
+
+	// draws one frame at a time while the main thread records the next one
+	// the graphics context is current on the render thread while it draws and on the main thread otherwise,
+	// so only one thread uses it at a time
+	class RenderThread
+	{
+	private:
+		static std::thread s_Thread;
+
+		static std::mutex s_Mutex;
+		static std::condition_variable s_Condition;
+
+		// the frame being drawn, empty once it's drawn
+		static std::function<void()> s_Frame;
+
+		// a frame was submitted and the main thread hasn't taken the graphics context back yet
+		static bool s_Submitted;
+
+		// thrown while drawing (ie. FailedAssertion), rethrown on the main thread by Wait or Stop
+		static std::exception_ptr s_Exception;
+
+		static bool s_Running;
+	public:
+		RenderThread() = delete;
+
+		static void Start();
+
+		// waits for the frame being drawn, the graphics context is current on the calling thread after
+		// rethrows what the frame threw once the thread is joined
+		static void Stop();
+
+		// the graphics context is released by the calling thread, Wait has to be called before using it again
+		static void Submit(std::function<void()> frame);
+
+		// returns once the submitted frame is drawn and the graphics context is current on the calling thread,
+		// returns right away if nothing was submitted since the last call, rethrows what the frame threw
+		static void Wait();
+
+		static inline bool IsRunning() { return s_Running; }
+	private:
+		static void ThreadLoop();
+
+		static void WaitForFrame();
+		static void RethrowException();
+	};
+
+}
\ No newline at end of file
@@ -1,19 +1,110 @@
 #include "ltpch.h"
 #include "Timer.h"
 
+#include <thread>
+
+// WIN32_LEAN_AND_MEAN leaves out timeBeginPeriod and timeEndPeriod
+#ifdef LIGHT_PLATFORM_WINDOWS
+	#include <timeapi.h>
+#endif
+
+// steps are dropped past this, a long frame (ie. a breakpoint or a dragged window) would take even longer to catch up
+#define LT_MAX_FIXED_STEPS_PER_FRAME 8u
+
+// 0.2ms, the limiter spins at least this long
+#define LT_MIN_SPIN_TICKS 200000u
+
 namespace Light {
 
 	std::chrono::time_point<std::chrono::steady_clock> Time::s_AppStartPoint = std::chrono::steady_clock::now();
 
-	float Time::s_DeltaTime    = 0.0f;
-	float Time::s_CurrentFrame = 0.0f;
-	float Time::s_PrevFrame    = 0.0f;
+	uint64_t Time::s_CurrentFrameTicks = 0u;
+	uint64_t Time::s_DeltaTicks        = 0u;
+	float    Time::s_DeltaTime         = 0.0f;
+
+	uint64_t Time::s_FixedStepTicks   = 1000000000u / 60u;
+	uint64_t Time::s_AccumulatedTicks = 0u;
+
+	uint64_t Time::s_FrameLimitTicks = 0u;
+	uint64_t Time::s_NextFrameTicks  = 0u;
+	uint64_t Time::s_SpinTicks       = 2000000u;
 
 	void Time::CalculateDeltaTime()
 	{
-		s_CurrentFrame = ElapsedTime();
-		s_DeltaTime = s_CurrentFrame - s_PrevFrame;
-		s_PrevFrame = s_CurrentFrame;
+		const uint64_t ticks = GetTicks();
+
+		s_DeltaTicks = ticks - s_CurrentFrameTicks;
+		s_DeltaTime = s_DeltaTicks / 1e9f;
+		s_CurrentFrameTicks = ticks;
+
+		s_AccumulatedTicks = std::min(s_AccumulatedTicks + s_DeltaTicks, s_FixedStepTicks * LT_MAX_FIXED_STEPS_PER_FRAME);
+	}
+
+	bool Time::ConsumeFixedStep()
+	{
+		if (s_AccumulatedTicks < s_FixedStepTicks)
+			return false;
+
+		s_AccumulatedTicks -= s_FixedStepTicks;
+		return true;
+	}
+
+	void Time::LimitFrameRate()
+	{
+		if (!s_FrameLimitTicks)
+			return;
+
+		LT_PROFILE_FUNC();
+
+		/* locals */
+		uint64_t ticks = GetTicks();
+
+		// frames aren't rushed to catch up with the deadline once they fall behind
+		if (ticks >= s_NextFrameTicks)
+		{
+			s_NextFrameTicks = ticks + s_FrameLimitTicks;
+			return;
+		}
+
+		// the spin margin follows the worst recent oversleep, it's the scheduler's granularity on most systems
+		// at most half of the frame is spun, a margin past the frame period would never sleep
+		const uint64_t spinTicks = std::min(s_SpinTicks, s_FrameLimitTicks / 2u);
+
+		if (s_NextFrameTicks - ticks > spinTicks)
+		{
+			const uint64_t wakeTicks = s_NextFrameTicks - spinTicks;
+
+			std::this_thread::sleep_for(chrono::nanoseconds(wakeTicks - ticks));
+			ticks = GetTicks();
+
+			const uint64_t oversleep = ticks > wakeTicks ? ticks - wakeTicks : 0u;
+			s_SpinTicks = std::max({ oversleep + oversleep / 4u, s_SpinTicks - s_SpinTicks / 16u, (uint64_t)LT_MIN_SPIN_TICKS });
+		}
+
+		while (GetTicks() < s_NextFrameTicks)
+			std::this_thread::yield();
+
+		s_NextFrameTicks += s_FrameLimitTicks;
+	}
+
+	void Time::SetFixedStep(float seconds)
+	{
+		LT_CORE_ASSERT(seconds > 0.0f, "Time::SetFixedStep: seconds has to be positive: {}", seconds);
+		s_FixedStepTicks = std::max((uint64_t)(seconds * 1e9), (uint64_t)1u);
+	}
+
+	void Time::SetFrameRateLimit(unsigned int framesPerSecond)
+	{
+#ifdef LIGHT_PLATFORM_WINDOWS
+		// sleeps are rounded up to the system timer's 15.6ms period by default, 1ms is requested while the limiter is on
+		if (framesPerSecond && !s_FrameLimitTicks)
+			timeBeginPeriod(1u);
+		else if (!framesPerSecond && s_FrameLimitTicks)
+			timeEndPeriod(1u);
+#endif
+
+		s_FrameLimitTicks = framesPerSecond ? 1000000000u / framesPerSecond : 0u;
+		s_NextFrameTicks = 0u;
 	}
 
 }
\ No newline at end of file
@@ -13,16 +13,47 @@ namespace Light {
 	private:
 		static chrono::time_point<std::chrono::steady_clock> s_AppStartPoint;
 
+		// nanoseconds since s_AppStartPoint, integers don't lose precision as the application keeps running
+		static uint64_t s_CurrentFrameTicks;
+		static uint64_t s_DeltaTicks;
 		static float s_DeltaTime;
-		static float s_PrevFrame;
-		static float s_CurrentFrame;
+
+		// fixed step
+		static uint64_t s_FixedStepTicks;
+		static uint64_t s_AccumulatedTicks;
+
+		// frame limiter, 0 ticks is unlimited
+		static uint64_t s_FrameLimitTicks;
+		static uint64_t s_NextFrameTicks;
+		static uint64_t s_SpinTicks;
 	public:
 		Time() = delete;
 
 		static void CalculateDeltaTime();
 
+		// returns true while a fixed step is due, each call consumes one
+		static bool ConsumeFixedStep();
+
+		// sleeps until the limiter's next frame, then spins the remaining time since sleeps overshoot
+		static void LimitFrameRate();
+
+		// setters
+		static void SetFixedStep(float seconds);
+		static void SetFrameRateLimit(unsigned int framesPerSecond);
+
+		// getters
 		static inline float GetDeltaTime() { return s_DeltaTime; }
-		static inline float ElapsedTime () { return ((chrono::duration<float>)(chrono::steady_clock::now() - s_AppStartPoint)).count(); }
+		static inline uint64_t GetDeltaTicks() { return s_DeltaTicks; }
+
+		static inline float GetFixedDeltaTime() { return s_FixedStepTicks / 1e9f; }
+
+		// how far the frame is between the last fixed step and the next, for interpolating the fixed steps' state
+		static inline float GetFixedAlpha() { return (float)((double)s_AccumulatedTicks / s_FixedStepTicks); }
+
+		static inline unsigned int GetFrameRateLimit() { return s_FrameLimitTicks ? (unsigned int)(1000000000u / s_FrameLimitTicks) : 0u; }
+
+		static inline uint64_t GetTicks() { return chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - s_AppStartPoint).count(); }
+		static inline double ElapsedTime() { return GetTicks() / 1e9; }
 	};
 
 	class Timer
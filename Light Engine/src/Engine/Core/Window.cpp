@@ -9,6 +9,7 @@
 #include "Events/WindowEvents.h"
 
 #include "Utility/FileManager.h"
+#include "Renderer/ShaderCache.h"
 #include "Renderer/Texture.h"
 
 #if   defined(LIGHT_PLATFORM_WINDOWS)
@@ -71,6 +72,9 @@ namespace Light {
 	{
 		LT_PROFILE_FUNC();
 
+		// programs compiled this run are saved for the next one
+		ShaderCache::Terminate();
+
 		glfwDestroyWindow(m_GlfwHandle);
 		glfwTerminate();
 	}
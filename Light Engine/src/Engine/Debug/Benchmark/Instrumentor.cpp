@@ -1,77 +1,356 @@
 #include "ltpch.h"
 #include "Instrumentor.h"
 
+#include <cstring>
+#include <iomanip>
+
+// binary trace:
+//   header: LT_TRACE_MAGIC, uint32 version
+//   name:   'N', uint32 id, uint32 length, chars, written before the first scope using it
+//   scope:  'S', uint32 threadID, uint32 nameID, int64 start, int64 end (nanoseconds)
+//   footer: 'E', uint64 dropped records
+#define LT_TRACE_MAGIC "LTTRACE"
+#define LT_TRACE_VERSION 1u
+
+// how often the writer drains the buffers, a buffer fills in ~8k scopes
+#define LT_TRACE_DRAIN_INTERVAL std::chrono::milliseconds(2)
+
 namespace Light {
 
+	thread_local Instrumentor::ThreadBufferOwner Instrumentor::s_ThreadBuffer;
+
+	namespace {
+
+		template<typename T>
+		void WriteValue(std::ofstream& stream, const T& value)
+		{
+			stream.write((const char*)&value, sizeof(T));
+		}
+
+		template<typename T>
+		bool ReadValue(std::ifstream& stream, T& value)
+		{
+			return (bool)stream.read((char*)&value, sizeof(T));
+		}
+
+	}
+
 	Instrumentor::Instrumentor()
-		: m_ProfileCount(0)
+		: m_NextThreadID(0u), b_Active(false), m_Session(0u), m_SessionStart(0), b_WriterRunning(false), m_DroppedRecords(0u)
 	{
 	}
 
+	Instrumentor::~Instrumentor()
+	{
+		if (m_Writer.joinable())
+			EndSession();
+	}
+
 	Instrumentor& Instrumentor::Get()
 	{
 		static Instrumentor instance;
 		return instance;
 	}
 
-	void Instrumentor::BeginSession(const std::string& filepath /* = "results.json" */)
+	void Instrumentor::BeginSession(const std::string& filepath /* = "results.lttrace" */)
 	{
-		m_OutputStream.open(filepath);
+		if (m_Writer.joinable())
+			EndSession();
+
+		m_SessionPath = filepath;
+		m_OutputStream.open(filepath, std::ios::binary);
 		WriteHeader();
+
+		m_NameIDs.clear();
+		m_DroppedRecords = 0u;
+
+		// records pushed after the previous session ended belong to neither
+		{
+			std::lock_guard<std::mutex> lock(m_BuffersMutex);
+			for (auto& buffer : m_Buffers)
+			{
+				buffer->tail.store(buffer->head.load(std::memory_order_acquire), std::memory_order_relaxed);
+				buffer->dropped = 0u;
+			}
+		}
+
+		m_SessionStart.store(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count(),
+		                     std::memory_order_relaxed);
+		m_Session.fetch_add(1u, std::memory_order_relaxed);
+
+		b_WriterRunning = true;
+		m_Writer = std::thread(&Instrumentor::WriterLoop, this);
+
+		b_Active.store(true, std::memory_order_release);
 	}
 
 	void Instrumentor::EndSession()
 	{
+		if (!m_Writer.joinable())
+			return;
+
+		b_Active.store(false, std::memory_order_release);
+
+		{
+			std::lock_guard<std::mutex> lock(m_WriterMutex);
+			b_WriterRunning = false;
+		}
+
+		m_WriterCondition.notify_one();
+		m_Writer.join();
+
+		// scopes that ended while the writer was stopping
+		Drain();
+
 		WriteFooter();
 		m_OutputStream.close();
-		m_ProfileCount = 0;
 	}
 
-	void Instrumentor::WriteProfile(const ProfileResult& result)
+	void Instrumentor::Record(const char* name, uint32_t session, std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end)
+	{
+		if (!s_ThreadBuffer.buffer)
+			s_ThreadBuffer.buffer = RegisterThread();
+
+		/* locals */
+		ThreadBuffer& buffer = *s_ThreadBuffer.buffer;
+		const uint32_t head = buffer.head.load(std::memory_order_relaxed);
+
+		if (head - buffer.tail.load(std::memory_order_acquire) == ThreadBuffer::Capacity)
+		{
+			buffer.dropped.fetch_add(1u, std::memory_order_relaxed);
+			return;
+		}
+
+		// a scope of the previous session reads the next one's start, its record is dropped by Drain
+		const int64_t sessionStart = m_SessionStart.load(std::memory_order_relaxed);
+
+		buffer.records[head % ThreadBuffer::Capacity] = { name, session,
+		                                                  std::chrono::duration_cast<std::chrono::nanoseconds>(start.time_since_epoch()).count() - sessionStart,
+		                                                  std::chrono::duration_cast<std::chrono::nanoseconds>(end.time_since_epoch()).count() - sessionStart };
+
+		buffer.head.store(head + 1u, std::memory_order_release);
+	}
+
+	bool Instrumentor::ConvertToChromeTrace(const std::string& tracePath, const std::string& jsonPath)
+	{
+		std::ifstream trace(tracePath, std::ios::binary);
+		if (!trace)
+		{
+			LT_CORE_ERROR("Instrumentor::ConvertToChromeTrace: failed to open trace: {}", tracePath);
+			return false;
+		}
+
+		/* locals */
+		char magic[sizeof(LT_TRACE_MAGIC)];
+		uint32_t version;
+
+		if (!ReadValue(trace, magic) || std::memcmp(magic, LT_TRACE_MAGIC, sizeof(magic)) || !ReadValue(trace, version) || version != LT_TRACE_VERSION)
+		{
+			LT_CORE_ERROR("Instrumentor::ConvertToChromeTrace: not a trace or an unsupported version: {}", tracePath);
+			return false;
+		}
+
+		std::ofstream json(jsonPath);
+		if (!json)
+		{
+			LT_CORE_ERROR("Instrumentor::ConvertToChromeTrace: failed to open output: {}", jsonPath);
+			return false;
+		}
+
+		// timestamps are microseconds
+		json << std::fixed << std::setprecision(3);
+		json << "{\"otherData\": {},\"traceEvents\":[";
+
+		std::vector<std::string> names;
+		uint64_t profileCount = 0u, dropped = 0u;
+
+		for (char tag; ReadValue(trace, tag);)
+		{
+			if (tag == 'N')
+			{
+				uint32_t id, length;
+				if (!ReadValue(trace, id) || !ReadValue(trace, length))
+					break;
+
+				std::string name(length, '\0');
+				if (!trace.read(name.data(), length))
+					break;
+
+				// the names are written to JSON as is
+				std::replace(name.begin(), name.end(), '"', '\'');
+				std::replace(name.begin(), name.end(), '\\', '/');
+
+				names.resize(std::max((size_t)id + 1u, names.size()));
+				names[id] = std::move(name);
+			}
+			else if (tag == 'S')
+			{
+				uint32_t threadID, nameID;
+				int64_t start, end;
+				if (!ReadValue(trace, threadID) || !ReadValue(trace, nameID) || !ReadValue(trace, start) || !ReadValue(trace, end))
+					break;
+
+				if (profileCount++ > 0)
+					json << ",";
+
+				json << "{";
+				json << "\"cat\":\"function\",";
+				json << "\"dur\":" << (end - start) / 1000.0 << ',';
+				json << "\"name\":\"" << (nameID < names.size() ? names[nameID] : "") << "\",";
+				json << "\"ph\":\"X\",";
+				json << "\"pid\":0,";
+				json << "\"tid\":" << threadID << ",";
+				json << "\"ts\":" << start / 1000.0;
+				json << "}";
+			}
+			else if (tag == 'E')
+			{
+				ReadValue(trace, dropped);
+				break;
+			}
+			else
+			{
+				LT_CORE_ERROR("Instrumentor::ConvertToChromeTrace: corrupted trace: {}", tracePath);
+				break;
+			}
+		}
+
+		json << "]}";
+
+		if (dropped)
+			LT_CORE_WARN("Instrumentor::ConvertToChromeTrace: {} records were dropped while tracing: {}", dropped, tracePath);
+
+		return true;
+	}
+
+	Instrumentor::ThreadBuffer* Instrumentor::RegisterThread()
 	{
-		if (m_ProfileCount++ > 0)
-			m_OutputStream << ",";
+		std::lock_guard<std::mutex> lock(m_BuffersMutex);
+
+		/* locals */
+		ThreadBuffer* buffer = nullptr;
+
+		for (auto& retired : m_Buffers)
+			if (retired->retired.load(std::memory_order_acquire) &&
+			    retired->head.load(std::memory_order_relaxed) == retired->tail.load(std::memory_order_acquire))
+			{
+				buffer = retired.get();
+				buffer->retired.store(false, std::memory_order_relaxed);
+				break;
+			}
 
-		std::string name = result.name;
-		std::replace(name.begin(), name.end(), '"', '\'');
+		if (!buffer)
+		{
+			m_Buffers.push_back(std::make_unique<ThreadBuffer>());
+			buffer = m_Buffers.back().get();
+		}
 
-		m_OutputStream << "{";
-		m_OutputStream << "\"cat\":\"function\",";
-		m_OutputStream << "\"dur\":" << (result.end - result.start) << ',';
-		m_OutputStream << "\"name\":\"" << name << "\",";
-		m_OutputStream << "\"ph\":\"X\",";
-		m_OutputStream << "\"pid\":0,";
-		m_OutputStream << "\"tid\":" << result.threadID << ",";
-		m_OutputStream << "\"ts\":" << result.start;
-		m_OutputStream << "}";
+		buffer->threadID = m_NextThreadID++;
+		return buffer;
+	}
+
+	Instrumentor::ThreadBufferOwner::~ThreadBufferOwner()
+	{
+		if (buffer)
+			buffer->retired.store(true, std::memory_order_release);
+	}
+
+	void Instrumentor::WriterLoop()
+	{
+		std::unique_lock<std::mutex> lock(m_WriterMutex);
+
+		while (b_WriterRunning)
+		{
+			m_WriterCondition.wait_for(lock, LT_TRACE_DRAIN_INTERVAL, [this]() { return !b_WriterRunning; });
+
+			lock.unlock();
+			Drain();
+			lock.lock();
+		}
+	}
+
+	void Instrumentor::Drain()
+	{
+		/* locals */
+		std::vector<ThreadBuffer*> buffers;
+		const uint32_t session = m_Session.load(std::memory_order_relaxed);
+
+		{
+			// threads register while the buffers are drained
+			std::lock_guard<std::mutex> lock(m_BuffersMutex);
+
+			buffers.reserve(m_Buffers.size());
+			for (auto& buffer : m_Buffers)
+				buffers.push_back(buffer.get());
+		}
+
+		for (ThreadBuffer* buffer : buffers)
+		{
+			const uint32_t head = buffer->head.load(std::memory_order_acquire);
+
+			for (uint32_t tail = buffer->tail.load(std::memory_order_relaxed); tail != head; tail++)
+				if (buffer->records[tail % ThreadBuffer::Capacity].session == session)
+					WriteRecord(buffer->threadID, buffer->records[tail % ThreadBuffer::Capacity]);
+
+			buffer->tail.store(head, std::memory_order_release);
+			m_DroppedRecords += buffer->dropped.exchange(0u, std::memory_order_relaxed);
+		}
 	}
 
 	void Instrumentor::WriteHeader()
 	{
-		m_OutputStream << "{\"otherData\": {},\"traceEvents\":[";
+		m_OutputStream.write(LT_TRACE_MAGIC, sizeof(LT_TRACE_MAGIC));
+		WriteValue(m_OutputStream, LT_TRACE_VERSION);
+	}
+
+	void Instrumentor::WriteRecord(uint32_t threadID, const ProfileRecord& record)
+	{
+		auto name = m_NameIDs.find(record.name);
+
+		// names are interned by pointer, written once per session
+		if (name == m_NameIDs.end())
+		{
+			name = m_NameIDs.emplace(record.name, (uint32_t)m_NameIDs.size()).first;
+
+			const uint32_t length = (uint32_t)std::strlen(record.name);
+
+			WriteValue(m_OutputStream, 'N');
+			WriteValue(m_OutputStream, name->second);
+			WriteValue(m_OutputStream, length);
+			m_OutputStream.write(record.name, length);
+		}
+
+		WriteValue(m_OutputStream, 'S');
+		WriteValue(m_OutputStream, threadID);
+		WriteValue(m_OutputStream, name->second);
+		WriteValue(m_OutputStream, record.start);
+		WriteValue(m_OutputStream, record.end);
 	}
 
 	void Instrumentor::WriteFooter()
 	{
-		m_OutputStream << "]}";
+		WriteValue(m_OutputStream, 'E');
+		// reported by ConvertToChromeTrace, the last session ends after the logger is terminated
+		WriteValue(m_OutputStream, m_DroppedRecords);
 	}
 
 	InstrumentationTimer::InstrumentationTimer(const char* name)
-		: m_Result({name, 0, 0, 0})
+		: m_Name(Instrumentor::Get().IsActive() ? name : nullptr), m_Session(Instrumentor::Get().GetSession())
 	{
-		m_StartTimepoint = std::chrono::high_resolution_clock::now();
+		if (m_Name)
+			m_StartTimepoint = std::chrono::steady_clock::now();
 	}
 
 	InstrumentationTimer::~InstrumentationTimer()
 	{
-		auto endTimepoint = std::chrono::high_resolution_clock::now();
-
-		m_Result.start = std::chrono::time_point_cast<std::chrono::microseconds>(m_StartTimepoint).time_since_epoch().count();
-		m_Result.end = std::chrono::time_point_cast<std::chrono::microseconds>(endTimepoint).time_since_epoch().count();
+		if (!m_Name)
+			return;
 
-		m_Result.threadID = std::hash<std::thread::id>{}(std::this_thread::get_id());
+		const auto endTimepoint = std::chrono::steady_clock::now();
 
-		Instrumentor::Get().WriteProfile(m_Result);
+		// a scope that outlives its session is dropped
+		if (Instrumentor::Get().IsActive())
+			Instrumentor::Get().Record(m_Name, m_Session, m_StartTimepoint, endTimepoint);
 	}
 
 }
\ No newline at end of file
@@ -4,48 +4,130 @@
 
 #pragma once
 
-#include <string>
+#include <atomic>
 #include <chrono>
-#include <algorithm>
+#include <condition_variable>
 #include <fstream>
-#include <thread>
+#include <memory>
 #include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 namespace Light {
 
-	struct ProfileResult
+	// fixed size so recording a scope is a copy into the thread's buffer, the name is a pointer and isn't copied,
+	// it has to outlive the session (ie. a string literal or __FUNCSIG__)
+	struct ProfileRecord
 	{
-		std::string name;
-		long long start, end;
-		uint32_t threadID;
+		const char* name;
+
+		// the session the scope began in, records of an earlier session are dropped when they're drained
+		uint32_t session;
+
+		// nanoseconds since the session began
+		int64_t start, end;
 	};
 
+	// profiled scopes are recorded into per-thread ring buffers without locking,
+	// a writer thread drains them into a binary trace which ConvertToChromeTrace (or the TraceConverter) turns into JSON
 	class Instrumentor
 	{
 	private:
+		// written by its thread, read by the writer thread
+		struct ThreadBuffer
+		{
+			static constexpr uint32_t Capacity = 1u << 13;
+
+			ProfileRecord records[Capacity];
+
+			std::atomic<uint32_t> head = 0u;
+			std::atomic<uint32_t> tail = 0u;
+
+			// records are dropped instead of waiting for the writer when the buffer is full
+			std::atomic<uint32_t> dropped = 0u;
+
+			// set when the thread exits, the buffer is reused by the next thread once it's drained
+			std::atomic<bool> retired = false;
+
+			uint32_t threadID;
+		};
+
+		// retires the thread's buffer when the thread exits
+		struct ThreadBufferOwner
+		{
+			ThreadBuffer* buffer = nullptr;
+
+			~ThreadBufferOwner();
+		};
+
+		std::vector<std::unique_ptr<ThreadBuffer>> m_Buffers;
+		std::mutex m_BuffersMutex;
+		uint32_t m_NextThreadID;
+
+		static thread_local ThreadBufferOwner s_ThreadBuffer;
+
+		std::atomic<bool> b_Active;
+		std::string m_SessionPath;
+
+		// a scope of the previous session may still be recording while the next one begins
+		std::atomic<uint32_t> m_Session;
+		std::atomic<int64_t> m_SessionStart; // steady_clock nanoseconds
+
+		// writer thread
+		std::thread m_Writer;
+		std::mutex m_WriterMutex;
+		std::condition_variable m_WriterCondition;
+		bool b_WriterRunning;
+
 		std::ofstream m_OutputStream;
-		int m_ProfileCount;
+		std::unordered_map<const char*, uint32_t> m_NameIDs;
+		uint64_t m_DroppedRecords;
 	private:
 		Instrumentor();
 	public:
+		~Instrumentor();
+
 		static Instrumentor& Get();
 
-		void BeginSession(const std::string& filepath = "results.json");
+		void BeginSession(const std::string& filepath = "results.lttrace");
 		void EndSession();
 
-		void WriteProfile(const ProfileResult& result);
+		void Record(const char* name, uint32_t session, std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end);
+
+		// acquire pairs with BeginSession's release, a scope that saw the session active reads its index
+		inline bool IsActive() const { return b_Active.load(std::memory_order_acquire); }
+		inline uint32_t GetSession() const { return m_Session.load(std::memory_order_relaxed); }
+
+		// the path of the current or the last session
+		inline const std::string& GetSessionPath() const { return m_SessionPath; }
+
+		// returns false if the trace can't be read or the JSON can't be written
+		static bool ConvertToChromeTrace(const std::string& tracePath, const std::string& jsonPath);
+	private:
+		ThreadBuffer* RegisterThread();
+
+		void WriterLoop();
+
+		// writes every record pushed so far
+		void Drain();
+
 		void WriteHeader();
+		void WriteRecord(uint32_t threadID, const ProfileRecord& record);
 		void WriteFooter();
 	};
 
 	class InstrumentationTimer
 	{
 	private:
-		ProfileResult m_Result;
-		std::chrono::time_point<std::chrono::high_resolution_clock> m_StartTimepoint;
+		// null if there was no session when the scope began
+		const char* m_Name;
+		uint32_t m_Session;
+		std::chrono::steady_clock::time_point m_StartTimepoint;
 	public:
 		InstrumentationTimer(const char* name);
 		~InstrumentationTimer();
 	};
 
-}
+}
\ No newline at end of file
@@ -7,6 +7,8 @@
 namespace Light {
 
 	class Event;
+
+	class RenderCommandList;
 	
 	class Layer
 	{
@@ -14,6 +16,10 @@ namespace Light {
 		std::string m_LayeDebugrName = "UnassignedLayerName";
 		bool b_Enabled = true;
 		float m_DrawPriority;
+
+		// set by layers whose OnUpdate doesn't touch the state of other layers or attach/detach layers,
+		// they're updated on the job system concurrently with each other and with the other layers
+		bool b_IndependentUpdate = false;
 	public:
 		Layer() = default;
 		virtual ~Layer() = default;
@@ -27,8 +33,17 @@ namespace Light {
 		virtual void OnAttach () {}
 		virtual void OnDetatch() {}
 
-		virtual void OnRender()                {}
-		virtual void OnUpdate(float DeltaTime) {}
+		// recorded on a worker thread concurrently with the other layers, the lists are submitted in layer order
+		// the Renderer's static draws and MeasureString assert the graphics context's thread, which is the main thread
+		// in OnEvent and OnUserInterfaceUpdate, and in OnUpdate while the render thread is off
+		virtual void OnRender(RenderCommandList& commands) {}
+		// with Application::SetRenderThread, the previous frame is drawn meanwhile
+		// static batches can be edited here since the render thread only draws what was uploaded before it started,
+		// but they must not be edited from any other thread while it is on (ie. a job left running past OnUpdate)
+		virtual void OnUpdate(float DeltaTime)             {}
+		// called zero or more times per frame before OnUpdate, at Time::GetFixedDeltaTime intervals
+		// Time::GetFixedAlpha interpolates the fixed steps' state for rendering
+		virtual void OnFixedUpdate(float fixedDeltaTime)   {}
 		virtual void OnUserInterfaceUpdate() {}
 
 		virtual void ShowDebugWindow() { ImGui::Text("ShowDebugWindow function is not overridden!"); }
@@ -38,6 +53,7 @@ namespace Light {
 		// getters
 		inline const std::string& GetName() const { return m_LayeDebugrName; }
 		inline bool IsEnabled() const { return b_Enabled; }
+		inline bool IsUpdateIndependent() const { return b_IndependentUpdate; }
 	private:
 		friend class LayerStack;
 		void SetDrawProiority(unsigned int priority) { m_DrawPriority = priority; }
@@ -1,6 +1,8 @@
 #include "ltpch.h"
 #include "LayerStack.h"
 
+#include "Utility/JobSystem.h"
+
 #include <imgui.h>
 
 namespace Light {
@@ -83,6 +85,32 @@ namespace Light {
 			m_Layers[i]->SetDrawProiority(i);
 	}
 
+	void LayerStack::OnUpdate(float deltaTime)
+	{
+		LT_PROFILE_FUNC();
+
+		// the layers are gathered first, the dependent ones may attach or detach layers while they update
+		m_IndependentLayers.clear();
+		for (Layer* layer : m_Layers)
+			if (layer->IsEnabled() && layer->IsUpdateIndependent())
+				m_IndependentLayers.push_back(layer);
+
+		/* locals */
+		JobHandle barrier = JobSystem::Create(nullptr);
+
+		for (Layer* layer : m_IndependentLayers)
+			JobSystem::Schedule([layer, deltaTime]() { layer->OnUpdate(deltaTime); }, barrier);
+
+		JobSystem::Run(barrier);
+
+		for (const auto& it = begin(); it != end(); next())
+			if ((*it)->IsEnabled() && !(*it)->IsUpdateIndependent())
+				(*it)->OnUpdate(deltaTime);
+
+		// nothing is rendered before every layer is updated
+		JobSystem::Wait(barrier);
+	}
+
 	void LayerStack::ShowDebugWindow()
 	{
  		for (int i = 0; i < m_Layers.size(); i++)
@@ -12,6 +12,7 @@ namespace Light {
 	{
 	private:
 		std::vector<Layer*> m_Layers;
+		std::vector<Layer*> m_IndependentLayers;
 
 		std::vector<Layer*>::iterator m_Current;
 
@@ -23,6 +24,10 @@ namespace Light {
 		void AttachLayer(Layer* layer);
 		void DetachLayer(Layer* layer);
 
+		// independent layers are updated on the job system while the others are updated in order on the calling thread,
+		// returns once every layer is updated
+		void OnUpdate(float deltaTime);
+
 		void ShowDebugWindow();
 
 		// getters
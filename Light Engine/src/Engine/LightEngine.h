@@ -77,14 +77,25 @@
 #include "Renderer/Buffers.h"
 #include "Renderer/Framebuffer.h"
 #include "Renderer/GraphicsContext.h"
+#include "Renderer/PostProcess.h"
+#include "Renderer/RenderCommandList.h"
 #include "Renderer/Renderer.h"
 #include "Renderer/Shader.h"
+#include "Renderer/ShaderCache.h"
+#include "Renderer/StaticBatch.h"
 #include "Renderer/Texture.h"
+#include "Renderer/TextureCache.h"
 // --------------------------
 
 // Utility ------------------
 #include "Utility/FileManager.h"
+#include "Utility/ImageUtility.h"
+#include "Utility/MappedFile.h"
+#include "Utility/RectanglePacker.h"
 #include "Utility/ResourceManager.h"
+#include "Utility/SlotMap.h"
+#include "Utility/StringID.h"
+#include "Utility/JobSystem.h"
 // --------------------------
 
-// ======================================================
+// ======================================================
\ No newline at end of file
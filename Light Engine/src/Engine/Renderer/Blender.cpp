@@ -7,6 +7,8 @@
 	#include "Platform/DirectX/dxBlender.h"
 #endif
 #include "Platform/Opengl/glBlender.h"
+#include "Platform/Null/nullBlender.h"
+#include "Platform/Software/swBlender.h"
 
 namespace Light {
 
@@ -27,6 +29,14 @@ namespace Light {
 			s_Context = std::make_unique<dxBlender>();
 			break;
 		)
+		case GraphicsAPI::Software:
+			s_Context = std::make_unique<swBlender>();
+			break;
+
+		case GraphicsAPI::Null:
+			s_Context = std::make_unique<nullBlender>();
+			break;
+
 		default:
 			LT_CORE_ASSERT(false, "Blender::Init: invalid GraphicsAPI");
 		}
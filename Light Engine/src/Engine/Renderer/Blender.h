@@ -34,6 +34,8 @@ namespace Light {
 	{
 	private:
 		static std::unique_ptr<Blender> s_Context;
+	protected:
+		bool b_Enabled = false;
 	public:
 		virtual ~Blender() = default;
 
@@ -44,6 +46,8 @@ namespace Light {
 
 		virtual void SetSrcFactor(BlendFactor factor) = 0;
 		virtual void SetDstFactor(BlendFactor factor) = 0;
+
+		inline bool IsEnabled() const { return b_Enabled; }
 	private:
 		friend class GraphicsContext;
 		static void Init();
@@ -7,6 +7,8 @@
 	#include "Platform/DirectX/dxBuffers.h"
 #endif
 #include "Platform/Opengl/glBuffers.h"
+#include "Platform/Null/nullBuffers.h"
+#include "Platform/Software/swBuffers.h"
 
 namespace Light {
 
@@ -21,37 +23,68 @@ namespace Light {
 		case GraphicsAPI::Directx: LT_DX(
 			return std::make_shared<dxConstantBuffer>(index, size);
 		)
+		case GraphicsAPI::Software:
+			return std::make_shared<swConstantBuffer>(index, size);
+		case GraphicsAPI::Null:
+			return std::make_shared<nullConstantBuffer>(index, size);
 		default:
 			LT_CORE_ASSERT(false, "ConstantBuffer::Create: invalid GraphicsAPI");
 		}
 
 	}
 
-	std::shared_ptr<VertexBuffer> VertexBuffer::Create(float* vertices, unsigned int stride, unsigned int count)
+	std::shared_ptr<VertexBuffer> VertexBuffer::Create(float* vertices, unsigned int stride, unsigned int count, BufferUsage usage)
 	{
 		LT_PROFILE_FUNC();
 
 		switch (GraphicsContext::GetAPI())
 		{
 		case GraphicsAPI::Opengl:
-			return std::make_shared<glVertexBuffer>(vertices, stride * count);
+			return std::make_shared<glVertexBuffer>(vertices, stride * count, usage);
 		case GraphicsAPI::Directx: LT_DX(
-			return std::make_shared<dxVertexBuffer>(vertices, stride, count); )
+			return std::make_shared<dxVertexBuffer>(vertices, stride, count, usage); )
+		case GraphicsAPI::Software:
+			return std::make_shared<swVertexBuffer>(vertices, stride * count);
+		case GraphicsAPI::Null:
+			return std::make_shared<nullVertexBuffer>(vertices, stride * count);
 		default:
 			LT_CORE_ASSERT(false, "VertexBuffer::Create: invalid GraphicsAPI");
 		}
 	}
 
-	std::shared_ptr<Light::IndexBuffer> IndexBuffer::Create(unsigned int* indices, unsigned int count)
+	std::shared_ptr<StreamVertexBuffer> StreamVertexBuffer::Create(unsigned int stride, unsigned int count)
 	{
 		LT_PROFILE_FUNC();
 
 		switch (GraphicsContext::GetAPI())
 		{
 		case GraphicsAPI::Opengl:
-			return std::make_shared<glIndexBuffer>(indices, count);
+			return std::make_shared<glStreamVertexBuffer>(stride, count);
 		case GraphicsAPI::Directx: LT_DX(
-			return std::make_shared<dxIndexBuffer>(indices, count); )
+			return std::make_shared<dxStreamVertexBuffer>(stride, count); )
+		case GraphicsAPI::Software:
+			return std::make_shared<swStreamVertexBuffer>(stride, count);
+		case GraphicsAPI::Null:
+			return std::make_shared<nullStreamVertexBuffer>(stride, count);
+		default:
+			LT_CORE_ASSERT(false, "StreamVertexBuffer::Create: invalid GraphicsAPI");
+		}
+	}
+
+	std::shared_ptr<Light::IndexBuffer> IndexBuffer::Create(unsigned int* indices, unsigned int count, IndexFormat format)
+	{
+		LT_PROFILE_FUNC();
+
+		switch (GraphicsContext::GetAPI())
+		{
+		case GraphicsAPI::Opengl:
+			return std::make_shared<glIndexBuffer>(indices, count, format);
+		case GraphicsAPI::Directx: LT_DX(
+			return std::make_shared<dxIndexBuffer>(indices, count, format); )
+		case GraphicsAPI::Software:
+			return std::make_shared<swIndexBuffer>(indices, count, format);
+		case GraphicsAPI::Null:
+			return std::make_shared<nullIndexBuffer>(indices, count, format);
 		default:
 			LT_CORE_ASSERT(false, "IndexBuffer::Create: invalid GraphicsAPI");
 		}
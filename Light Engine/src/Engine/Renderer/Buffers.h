@@ -2,6 +2,9 @@
 
 #include "Core/Core.h"
 
+// frames the CPU may write ahead of the GPU before a StreamVertexBuffer region has to be waited on
+#define LT_FRAMES_IN_FLIGHT 3u
+
 namespace Light {
 
 	enum ConstantBufferIndex
@@ -18,6 +21,18 @@ namespace Light {
 		ConstantBufferIndex_ViewProjection = 6,
 	};
 
+	enum class IndexFormat
+	{
+		UInt16, UInt32,
+	};
+
+	// Dynamic: rewritten with Map/UnMap
+	// Static : rarely changed, in parts, with Update
+	enum class BufferUsage
+	{
+		Dynamic, Static,
+	};
+
 	class ConstantBuffer
 	{
 	public:
@@ -36,22 +51,73 @@ namespace Light {
 	public:
 		virtual ~VertexBuffer() = default;
 
-		static std::shared_ptr<VertexBuffer> Create(float* vertices, unsigned int stride, unsigned int count);
+		static std::shared_ptr<VertexBuffer> Create(float* vertices, unsigned int stride, unsigned int count, BufferUsage usage = BufferUsage::Dynamic);
 
 		virtual void Bind() = 0;
 
 		virtual void* Map() = 0;
 		virtual void UnMap() = 0;
+
+		// writes 'size' bytes at byte 'offset', BufferUsage::Static only
+		virtual void Update(const void* data, unsigned int offset, unsigned int size) = 0;
+	};
+
+	// vertex buffer that is rewritten every frame, split into LT_FRAMES_IN_FLIGHT regions of 'count' vertices
+	// Map returns the unwritten rest of the current frame's region, it only waits on the GPU if the region is still
+	// being read from LT_FRAMES_IN_FLIGHT frames ago
+	class StreamVertexBuffer : public VertexBuffer
+	{
+	protected:
+		unsigned int m_Stride;
+		unsigned int m_RegionCount;
+
+		unsigned int m_Region = 0u;
+		unsigned int m_Cursor = 0u; // vertices written to the current region
+	public:
+		virtual ~StreamVertexBuffer() = default;
+
+		static std::shared_ptr<StreamVertexBuffer> Create(unsigned int stride, unsigned int count);
+
+		// 'count' vertices were written since the last Map, the next Map continues after them
+		inline void Commit(unsigned int count) { m_Cursor += count; }
+
+		// all of the frame's draws are issued, the next frame writes to the next region
+		virtual void EndFrame() = 0;
+
+		inline void Update(const void* data, unsigned int offset, unsigned int size) override
+		{
+			LT_CORE_ASSERT(false, "StreamVertexBuffer::Update: stream buffers are written with Map");
+		}
+
+		// getters
+		inline unsigned int GetFirstVertex() const { return m_Region * m_RegionCount + m_Cursor; }
+
+		inline unsigned int GetAvailableCount() const { return m_RegionCount - m_Cursor; }
+
+		inline unsigned int GetRegionCount() const { return m_RegionCount; }
+	protected:
+		StreamVertexBuffer(unsigned int stride, unsigned int count) : m_Stride(stride), m_RegionCount(count) {}
+
+		inline void AdvanceRegion()
+		{
+			m_Region = (m_Region + 1u) % LT_FRAMES_IN_FLIGHT;
+			m_Cursor = 0u;
+		}
 	};
 
 	class IndexBuffer
 	{
+	protected:
+		IndexFormat m_Format = IndexFormat::UInt32;
 	public:
 		virtual ~IndexBuffer() = default;
 
-		static std::shared_ptr<IndexBuffer> Create(unsigned int* indices, unsigned int count);
+		// indices are narrowed down to 16 bits with IndexFormat::UInt16
+		static std::shared_ptr<IndexBuffer> Create(unsigned int* indices, unsigned int count, IndexFormat format = IndexFormat::UInt32);
 
 		virtual void Bind() = 0;
+
+		inline IndexFormat GetFormat() const { return m_Format; }
 	};
 
 }
\ No newline at end of file
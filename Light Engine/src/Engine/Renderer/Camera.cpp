@@ -16,17 +16,22 @@ namespace Light {
 	}
 
 	void Camera::CalculateViewProjection()
+	{
+		CalculateViewProjection(m_View, m_Projection);
+	}
+
+	void Camera::CalculateViewProjection(glm::mat4& view, glm::mat4& projection) const
 	{
 		const glm::vec2& position = m_Controller->GetPosition();
 		const float aspectRatio = m_Controller->GetAspectRatio();
 		const float zoomLevel = m_Controller->GetZoomLevel();
 
-		m_View = glm::lookAt(glm::vec3(position, 255000.0f), glm::vec3(position, 0.0f), m_Up);
+		view = glm::lookAt(glm::vec3(position, 255000.0f), glm::vec3(position, 0.0f), m_Up);
 
-		m_Projection = glm::ortho(aspectRatio * -zoomLevel,
-		                          aspectRatio *  zoomLevel,
-		                                         zoomLevel,
-		                                        -zoomLevel, FLT_MAX, FLT_MIN);
+		projection = glm::ortho(aspectRatio * -zoomLevel,
+		                        aspectRatio *  zoomLevel,
+		                                       zoomLevel,
+		                                      -zoomLevel, FLT_MAX, FLT_MIN);
 	}
 
 	void Camera::ShowDebugWindow()
@@ -30,6 +30,9 @@ namespace Light {
 
 		void CalculateViewProjection();
 
+		// doesn't modify the camera, layers recording on other threads may share it
+		void CalculateViewProjection(glm::mat4& view, glm::mat4& projection) const;
+
 		void ShowDebugWindow();
 	};
 
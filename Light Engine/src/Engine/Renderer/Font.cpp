@@ -1,55 +1,101 @@
 #include "ltpch.h"
 #include "Font.h"
 
+#include "Utility/DistanceField.h"
+#include "Utility/JobSystem.h"
+
+#include <cstring>
+
 namespace Light {
 
-	Font::Font(const std::string& name, const std::string& path, std::shared_ptr<TextureArray> textureArray, unsigned int size)
+	std::atomic<uint64_t> Font::s_NextID = 1u;
+
+	Font::Font(const std::string& name, const std::string& path, std::shared_ptr<TextureArray> textureArray, unsigned int size,
+	           FontMode mode /*= FontMode::Bitmap*/, unsigned int cachedGlyphs /*= LT_FONT_CACHED_GLYPHS*/)
+		: m_Size(size), m_Mode(mode), m_File(std::make_unique<FontFileData>(FileManager::LoadFont(path, size))), m_TextureArray(textureArray), m_ID(s_NextID++)
 	{
 		LT_PROFILE_FUNC();
 
-		std::vector<TextureCoordinates> glyphsSpace;
+		std::vector<std::vector<unsigned char>> glyphsPixels(LT_FONT_TABLE_SIZE);
 
 		float width = 0.0f;
 		float height = 0.0f;
-		
-		std::vector<unsigned char*> buffers(128);
-		buffers.resize(128);
 
-		FontFileData font = FileManager::LoadFont(path, size);
+		FontFileData& font = *m_File;
 
-		for (uint8_t i = 0; i < 128; i++)
+		// freetype faces aren't thread safe, the bitmaps are rasterized one by one
+		for (uint32_t i = 0; i < LT_FONT_TABLE_SIZE; i++)
 		{
-			bool found = false;
-
 			font.LoadChar(i);
-			m_CharactersData[i] = { font.GetSize(), font.GetBearing(), font.GetAdvance() };
+			m_Table[i].size = font.GetSize();
+			m_Table[i].bearing = font.GetBearing();
+			m_Table[i].advance = font.GetAdvance();
+
+			m_Ascent = std::max(m_Ascent, m_Table[i].bearing.y);
+			m_Descent = std::max(m_Descent, m_Table[i].size.y - m_Table[i].bearing.y);
+
+			glyphsPixels[i] = font.GetBitmap();
+		}
+
+		if (mode == FontMode::SDF)
+		{
+			// the distance fields are independent of each other, generate them on the job system
+			JobSystem::ParallelFor(LT_FONT_TABLE_SIZE, 4u, [this, &glyphsPixels](unsigned int begin, unsigned int end)
+			{
+				for (unsigned int i = begin; i < end; i++)
+					glyphsPixels[i] = GenerateDistanceField(glyphsPixels[i].data(), m_Table[i].size.x, m_Table[i].size.y,
+					                                        m_Table[i].size.x, LT_SDF_SPREAD);
+			});
 
-			for (uint16_t y = 0; y < 2048u && !found; y++)
+			// the padding is part of the glyph, the layout stays the same
+			for (auto& character : m_Table)
 			{
-				found = false;
-				for (uint16_t x = 0; x < 2048u && !found; x++)
-				{
-					const TextureCoordinates uv(x, y, x + m_CharactersData[i].size.x, y + m_CharactersData[i].size.y, 0);
-
-					bool valid = true;
-					for (const auto& t : glyphsSpace)
-						if (t.Intersects(uv))
-							{ valid = false; break; }
-
-					if (valid)
-					{
-						found = true;
-						glyphsSpace.push_back(uv);
-
-						if (uv.xMax > width)
-							width = uv.xMax;
-						if (uv.yMax > height)
-							height = uv.yMax;
-					}
-				}
+				character.size += glm::vec2(LT_SDF_SPREAD * 2.0f);
+				character.bearing += glm::vec2(-(float)LT_SDF_SPREAD, (float)LT_SDF_SPREAD);
 			}
 		}
 
+		// pack the table into a roughly square region, tallest glyphs first
+		std::vector<uint32_t> packingOrder(LT_FONT_TABLE_SIZE);
+		std::vector<TextureCoordinates> glyphsSpace(LT_FONT_TABLE_SIZE);
+
+		float area = 0.0f;
+		for (uint32_t i = 0; i < LT_FONT_TABLE_SIZE; i++)
+		{
+			packingOrder[i] = i;
+			area += m_Table[i].size.x * m_Table[i].size.y;
+			width = std::max(width, m_Table[i].size.x);
+		}
+
+		std::sort(packingOrder.begin(), packingOrder.end(), [this](uint32_t a, uint32_t b) { return m_Table[a].size.y > m_Table[b].size.y; });
+
+		RectanglePacker packer(std::max((unsigned int)width, (unsigned int)std::ceil(std::sqrt(area) * 1.1f)), textureArray->GetHeight(),
+		                       PackingHeuristic::BottomLeft);
+
+		for (uint32_t i : packingOrder)
+		{
+			glm::uvec2 position;
+			const bool packed = packer.Insert(m_Table[i].size.x, m_Table[i].size.y, position);
+			LT_CORE_ASSERT(packed, "Font::Font: glyphs of '{}' don't fit in a texture slice", name);
+
+			glyphsSpace[i] = TextureCoordinates(position.x, position.y, position.x + m_Table[i].size.x, position.y + m_Table[i].size.y, 0);
+
+			width = std::max(width, glyphsSpace[i].xMax);
+			height = std::max(height, glyphsSpace[i].yMax);
+		}
+
+		// glyph cache grid goes below the table, cells are padded by a texel so filtering doesn't bleed between them
+		m_CellSize = glm::uvec2(font.GetMaxGlyphSize()) + (mode == FontMode::SDF ? LT_SDF_SPREAD * 2u : 0u) + 1u;
+		m_CellsPerRow = std::max(1u, std::min(std::max(cachedGlyphs, 1u), textureArray->GetWidth() / m_CellSize.x));
+		m_Cells.resize(cachedGlyphs);
+		m_CellPixels.resize(m_CellSize.x * m_CellSize.y);
+
+		const unsigned int cacheRows = (cachedGlyphs + m_CellsPerRow - 1u) / m_CellsPerRow;
+		const float tableHeight = std::ceil(height) + 1.0f;
+
+		width = std::max(width, (float)(m_CellsPerRow * m_CellSize.x));
+		height = tableHeight + cacheRows * m_CellSize.y;
+
 		textureArray->AllocateTexture(name, width, height);
 		textureArray->ResolveTextures();
 		TextureCoordinates coords = *textureArray->GetTexture(name)->GetTextureUV();
@@ -58,24 +104,135 @@ namespace Light {
 		float xOffset = coords.xMin * textureArray->GetWidth();
 		float yOffset = coords.yMin * textureArray->GetHeight();
 
+		m_CacheOrigin = glm::uvec2(xOffset, yOffset + tableHeight);
+		m_SliceIndex = coords.sliceIndex;
+
+		// flags the glyphs for the text shader's sdf path
+		const float sliceIndex = coords.sliceIndex + (mode == FontMode::SDF ? LT_SDF_SLICE_FLAG : 0.0f);
+
 		float tcuX = 1.0f / textureArray->GetWidth();  // texture coordinates unit - x axis
 		float tcuY = 1.0f / textureArray->GetHeight(); // texture coordinates unit - y axis
 
-		for (uint8_t i = 0; i < 128; i++)
+		for (uint32_t i = 0; i < LT_FONT_TABLE_SIZE; i++)
 		{
-			font.LoadChar(i);
-
 			// write to texture slice
-			textureArray->UpdateSubTexture(glyphsSpace[i].xMin + xOffset, glyphsSpace[i].yMin + yOffset, coords.sliceIndex,
-			                               glyphsSpace[i].GetWidth(), glyphsSpace[i].GetHeight(),
-			                               font.GetBuffer());
+			if (!glyphsPixels[i].empty())
+				textureArray->UpdateSubTexture(glyphsSpace[i].xMin + xOffset, glyphsSpace[i].yMin + yOffset, coords.sliceIndex,
+				                               glyphsSpace[i].GetWidth(), glyphsSpace[i].GetHeight(),
+				                               glyphsPixels[i].data());
 
 			// figure out and set character's texture coordinates
-			m_CharactersData.at(i).glyphUV = { tcuX * (glyphsSpace[i].xMin + xOffset), tcuY * (glyphsSpace[i].yMin + yOffset), // xMin, yMin
-								          tcuX * (glyphsSpace[i].xMax + xOffset), tcuY * (glyphsSpace[i].yMax + yOffset), // xMax, yMax
-			                              coords.sliceIndex }; // sliceIndex
+			m_Table[i].glyphUV = { tcuX * (glyphsSpace[i].xMin + xOffset), tcuY * (glyphsSpace[i].yMin + yOffset), // xMin, yMin
+			                       tcuX * (glyphsSpace[i].xMax + xOffset), tcuY * (glyphsSpace[i].yMax + yOffset), // xMax, yMax
+			                       sliceIndex }; // sliceIndex
 		}
+
 		textureArray->GenerateMips();
 	}
 
+	Font::Font(std::shared_ptr<Font> face, unsigned int size)
+		: m_Face(face), m_SizeScale((float)size / face->GetSize()), m_Size(size), m_Mode(face->GetMode()),
+		  m_CacheOrigin(0u), m_CellSize(0u), m_CellsPerRow(0u), m_SliceIndex(0u),
+		  m_Ascent(face->GetAscent() * m_SizeScale), m_Descent(face->GetDescent() * m_SizeScale), m_ID(s_NextID++)
+	{
+	}
+
+	void Font::FlushGlyphs()
+	{
+		if (!m_MipsDirty)
+			return;
+
+		m_TextureArray->GenerateMips();
+		m_MipsDirty = false;
+	}
+
+	const FontCharData& Font::GetCachedCharacterData(uint32_t codepoint, uint64_t frame)
+	{
+		auto it = m_CachedGlyphs.find(codepoint);
+		if (it == m_CachedGlyphs.end())
+			return RasterizeGlyph(codepoint, frame);
+
+		m_Cells[it->second.cacheCell].lastUsedFrame = frame;
+		return it->second;
+	}
+
+	const FontCharData& Font::RasterizeGlyph(uint32_t codepoint, uint64_t frame)
+	{
+		LT_PROFILE_FUNC();
+
+		if (m_Cells.empty())
+			return m_Table['?'];
+
+		// first empty cell, otherwise the least recently used one
+		unsigned int cellIndex = 0u;
+		for (unsigned int i = 0; i < m_Cells.size(); i++)
+		{
+			if (!m_Cells[i].codepoint)
+				{ cellIndex = i; break; }
+
+			if (m_Cells[i].lastUsedFrame < m_Cells[cellIndex].lastUsedFrame)
+				cellIndex = i;
+		}
+
+		GlyphCell& cell = m_Cells[cellIndex];
+
+		// every cell is used by a string of this frame, its commands still reference their uvs
+		if (cell.codepoint && cell.lastUsedFrame == frame)
+		{
+			LT_CORE_WARN("Font::RasterizeGlyph: glyph cache is full, U+{:04X} is drawn as '?'", codepoint);
+			return m_Table['?'];
+		}
+
+		// evict
+		if (cell.codepoint)
+		{
+			m_CachedGlyphs.erase(cell.codepoint);
+			m_Generation++;
+		}
+
+		cell.codepoint = codepoint;
+		cell.lastUsedFrame = frame;
+
+		/* locals */
+		FontFileData& font = *m_File;
+		font.LoadChar(codepoint);
+
+		glm::uvec2 bitmapSize = font.GetSize();
+		glm::vec2 bearing = font.GetBearing();
+		std::vector<unsigned char> pixels = font.GetBitmap();
+
+		if (m_Mode == FontMode::SDF)
+		{
+			pixels = GenerateDistanceField(pixels.data(), bitmapSize.x, bitmapSize.y, bitmapSize.x, LT_SDF_SPREAD);
+			bitmapSize += LT_SDF_SPREAD * 2u;
+			bearing += glm::vec2(-(float)LT_SDF_SPREAD, (float)LT_SDF_SPREAD);
+		}
+
+		const glm::uvec2 glyphSize = glm::min(bitmapSize, m_CellSize - 1u); // glyphs larger than the cell are clipped
+		const glm::uvec2 cellPosition = m_CacheOrigin + glm::uvec2(cellIndex % m_CellsPerRow, cellIndex / m_CellsPerRow) * m_CellSize;
+
+		// the whole cell is written so that the evicted glyph's pixels don't linger around the new one
+		std::fill(m_CellPixels.begin(), m_CellPixels.end(), (unsigned char)0u);
+		for (unsigned int y = 0; y < glyphSize.y; y++)
+			std::memcpy(&m_CellPixels[y * m_CellSize.x], &pixels[y * bitmapSize.x], glyphSize.x);
+
+		m_TextureArray->UpdateSubTexture(cellPosition.x, cellPosition.y, m_SliceIndex, m_CellSize.x, m_CellSize.y, m_CellPixels.data());
+		m_MipsDirty = true;
+
+		FontCharData& character = m_CachedGlyphs[codepoint];
+		character.size = glm::vec2(glyphSize);
+		character.bearing = bearing;
+		character.advance = font.GetAdvance();
+		character.cacheCell = cellIndex;
+
+		const float tcuX = 1.0f / m_TextureArray->GetWidth();
+		const float tcuY = 1.0f / m_TextureArray->GetHeight();
+
+		character.glyphUV = { tcuX * cellPosition.x, tcuY * cellPosition.y,
+		                      tcuX * (cellPosition.x + glyphSize.x), tcuY * (cellPosition.y + glyphSize.y),
+		                      m_SliceIndex + (m_Mode == FontMode::SDF ? LT_SDF_SLICE_FLAG : 0.0f) };
+
+		return character;
+	}
+
 }
\ No newline at end of file
@@ -4,10 +4,32 @@
 
 #include <glm/glm.hpp>
 
+#include <atomic>
 #include <unordered_map>
 
+// codepoints below this are rasterized up front and looked up by index
+#define LT_FONT_TABLE_SIZE 128u
+
+// default number of glyph cache cells, codepoints outside of the table are rasterized into them on first use
+#define LT_FONT_CACHED_GLYPHS 256u
+
+// sdf faces are rasterized once at this size and scaled to every other size
+#define LT_SDF_FONT_SIZE 48u
+
+// distance in texels covered by an sdf glyph's falloff, also its padding on every side
+#define LT_SDF_SPREAD 6u
+
+// added to the slice index of sdf glyphs, the text shader picks the sdf path above it
+#define LT_SDF_SLICE_FLAG 128.0f
+
 namespace Light {
 
+	enum class FontMode
+	{
+		Bitmap,
+		SDF, // signed distance field, crisp at any scale
+	};
+
 	struct FontCharData
 	{
 		glm::vec2 size;
@@ -15,18 +37,95 @@ namespace Light {
 		unsigned int advance;
 
 		TextureCoordinates glyphUV;
-		
+
+		// glyph cache cell, -1 for glyphs in the table
+		int cacheCell = -1;
+
 		FontCharData() = default;
 	};
 
+	class Font;
+	using FontHandle = Handle<Font>;
+
 	class Font
 	{
 	private:
-		std::unordered_map<char, FontCharData> m_CharactersData;
+		struct GlyphCell
+		{
+			uint32_t codepoint = 0u; // 0 is in the table, marks an empty cell
+			uint64_t lastUsedFrame = 0u;
+		};
+
+		FontCharData m_Table[LT_FONT_TABLE_SIZE];
+
+		// sizes of a sdf face are aliases that share its glyphs
+		std::shared_ptr<Font> m_Face;
+		float m_SizeScale = 1.0f;
+
+		unsigned int m_Size;
+		FontMode m_Mode;
+
+		std::unordered_map<uint32_t, FontCharData> m_CachedGlyphs;
+		std::vector<GlyphCell> m_Cells;
+		std::vector<unsigned char> m_CellPixels;
+
+		std::unique_ptr<FontFileData> m_File;
+		std::shared_ptr<TextureArray> m_TextureArray;
+
+		// glyph cache region in texels
+		glm::uvec2 m_CacheOrigin;
+		glm::uvec2 m_CellSize;
+		unsigned int m_CellsPerRow;
+		unsigned int m_SliceIndex;
+
+		// incremented whenever a cached glyph is evicted, laid out runs of an older generation are stale
+		uint32_t m_Generation = 0u;
+		bool m_MipsDirty = false;
+
+		// largest extents above and below the baseline
+		float m_Ascent = 0.0f;
+		float m_Descent = 0.0f;
+
+		// never reused, unlike the font's address once it's deleted
+		uint64_t m_ID;
+		static std::atomic<uint64_t> s_NextID;
 	public:
-		Font(const std::string& name, const std::string& path, std::shared_ptr<TextureArray> textureArray, unsigned int size);
+		Font(const std::string& name, const std::string& path, std::shared_ptr<TextureArray> textureArray, unsigned int size,
+		     FontMode mode = FontMode::Bitmap, unsigned int cachedGlyphs = LT_FONT_CACHED_GLYPHS);
+
+		// alias of face drawn at size, doesn't rasterize anything
+		Font(std::shared_ptr<Font> face, unsigned int size);
+
+		// frame is used for lru eviction, glyphs used in the current frame are never evicted
+		inline const FontCharData& GetCharacterData(uint32_t codepoint, uint64_t frame)
+		{
+			return codepoint < LT_FONT_TABLE_SIZE ? m_Table[codepoint] : GetCachedCharacterData(codepoint, frame);
+		}
+
+		// keeps a cached glyph of an already laid out run from being evicted
+		inline void TouchGlyph(int cacheCell, uint64_t frame) { m_Cells[cacheCell].lastUsedFrame = frame; }
 
-		inline const FontCharData& GetCharacterData(char character) const { return m_CharactersData.at(character); }
+		// regenerates the glyph array's mips if glyphs were rasterized since the last call
+		void FlushGlyphs();
+
+		// the font that owns the glyphs, itself unless it's an alias
+		inline Font* GetFace() { return m_Face ? m_Face.get() : this; }
+
+		// multiplies the face's glyph metrics
+		inline float GetSizeScale() const { return m_SizeScale; }
+
+		inline float GetAscent() const { return m_Ascent; }
+		inline float GetDescent() const { return m_Descent; }
+
+		inline unsigned int GetSize() const { return m_Size; }
+		inline FontMode GetMode() const { return m_Mode; }
+
+		inline uint64_t GetID() const { return m_ID; }
+
+		inline uint32_t GetGeneration() const { return m_Generation; }
+	private:
+		const FontCharData& GetCachedCharacterData(uint32_t codepoint, uint64_t frame);
+		const FontCharData& RasterizeGlyph(uint32_t codepoint, uint64_t frame);
 	};
 
 }
\ No newline at end of file
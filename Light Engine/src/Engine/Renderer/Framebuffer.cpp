@@ -7,19 +7,30 @@
 	#include "Platform/DirectX/dxFramebuffer.h"
 #endif
 #include "Platform/Opengl/glFramebuffer.h"
+#include "Platform/Null/nullFramebuffer.h"
+#include "Platform/Software/swFramebuffer.h"
 
 namespace Light {
 
-	std::shared_ptr<Framebuffer> Framebuffer::Create(const std::string& vertex, const std::string& fragment, TextureBindingSlot slot)
+	Framebuffer::Framebuffer(unsigned int width, unsigned int height, FramebufferFormat format)
+		: m_Width(width), m_Height(height), m_Format(format)
+	{
+	}
+
+	std::shared_ptr<Framebuffer> Framebuffer::Create(unsigned int width, unsigned int height, FramebufferFormat format /*= FramebufferFormat::RGBA8*/)
 	{
 		LT_PROFILE_FUNC();
 
 		switch (GraphicsContext::GetAPI())
 		{
 		case GraphicsAPI::Opengl:
-			return std::make_shared<glFramebuffer>(vertex, fragment, GraphicsContext::GetResolution().width, GraphicsContext::GetResolution().height, slot);
+			return std::make_shared<glFramebuffer>(width, height, format);
 		case GraphicsAPI::Directx: LT_DX(
-			return std::make_shared<dxFramebuffer>(vertex, fragment, GraphicsContext::GetResolution().width, GraphicsContext::GetResolution().height, slot);)
+			return std::make_shared<dxFramebuffer>(width, height, format);)
+		case GraphicsAPI::Software:
+			return std::make_shared<swFramebuffer>(width, height, format);
+		case GraphicsAPI::Null:
+			return std::make_shared<nullFramebuffer>(width, height, format);
 		default:
 			LT_CORE_ASSERT(false, "Framebuffer::Create: invalid GraphicsAPI");
 		}
@@ -6,17 +6,32 @@
 
 namespace Light {
 
+	enum class FramebufferFormat
+	{
+		RGBA8, RGBA16F,
+	};
+
+	// color target of the scene and the post process passes, see PostProcessGraph
 	class Framebuffer
 	{
+	protected:
+		unsigned int m_Width, m_Height;
+		FramebufferFormat m_Format;
 	public:
+		Framebuffer(unsigned int width, unsigned int height, FramebufferFormat format);
 		virtual ~Framebuffer() = default;
 
-		static std::shared_ptr<Framebuffer> Create(const std::string& vertex, const std::string& fragment, TextureBindingSlot slot = BINDING_FRAMEBUFFER0);
+		static std::shared_ptr<Framebuffer> Create(unsigned int width, unsigned int height, FramebufferFormat format = FramebufferFormat::RGBA8);
+
+		// the viewport is set to the framebuffer's size, full screen passes overwrite every pixel and don't need the clear
+		virtual void BindAsTarget(bool clear = false) = 0;
+		virtual void BindAsResource(TextureBindingSlot slot = BINDING_FRAMEBUFFER0) = 0;
 
-		virtual void BindAsTarget() = 0;
-		virtual void BindAsResource() = 0;
+		// getters
+		inline unsigned int GetWidth() const { return m_Width; }
+		inline unsigned int GetHeight() const { return m_Height; }
 
-		virtual void Resize(unsigned int width, unsigned int height) = 0;
+		inline FramebufferFormat GetFormat() const { return m_Format; }
 	};
 
 }
\ No newline at end of file
@@ -0,0 +1,161 @@
+#include "ltpch.h"
+#include "GlyphRunCache.h"
+
+#include "Utility/UTF8.h"
+
+#include <cstring>
+
+// runs that weren't drawn or measured for this many frames are evicted
+#define LT_GLYPH_RUN_LIFETIME 120u
+
+namespace Light {
+
+	const GlyphRun& GlyphRunCache::Get(std::string_view text, Font* font, float scale, float angle)
+	{
+		/* locals */
+		uint32_t scaleBits, angleBits;
+		std::memcpy(&scaleBits, &scale, sizeof(float));
+		std::memcpy(&angleBits, &angle, sizeof(float));
+
+		// combine the key's hashes, the font's id isn't reused by a font loaded after it's deleted
+		uint64_t key = std::hash<std::string_view>()(text);
+		key ^= std::hash<uint64_t>()(font->GetID()) + 0x9e3779b97f4a7c15ull + (key << 6) + (key >> 2);
+		key ^= (((uint64_t)scaleBits << 32) | angleBits) + 0x9e3779b97f4a7c15ull + (key << 6) + (key >> 2);
+
+		Font* face = font->GetFace();
+
+		// the whole key is compared, a run with a colliding key is added next to the others
+		const auto range = m_Runs.equal_range(key);
+		for (auto it = range.first; it != range.second; it++)
+		{
+			GlyphRun& run = it->second;
+
+			if (run.fontID != font->GetID() || run.scale != scale || run.angle != angle || run.text != text)
+				continue;
+
+			// glyphs used in this frame aren't evicted, a run already handed out this frame stays valid and isn't rebuilt
+			if (run.fontGeneration != face->GetGeneration() && run.lastUsedFrame != m_Frame)
+				Build(run);
+			else if (run.hasCachedGlyphs)
+			{
+				for (const auto& glyph : run.glyphs)
+					if (glyph.cacheCell >= 0)
+						face->TouchGlyph(glyph.cacheCell, m_Frame);
+			}
+
+			run.lastUsedFrame = m_Frame;
+			return run;
+		}
+
+		GlyphRun& run = m_Runs.emplace(key, GlyphRun())->second;
+
+		run.text = text;
+		run.font = font;
+		run.fontID = font->GetID();
+		run.scale = scale;
+		run.angle = angle;
+
+		Build(run);
+
+		run.lastUsedFrame = m_Frame;
+		return run;
+	}
+
+	void GlyphRunCache::NewFrame()
+	{
+		m_Frame++;
+
+		if (m_Frame % LT_GLYPH_RUN_LIFETIME)
+			return;
+
+		for (auto it = m_Runs.begin(); it != m_Runs.end();)
+		{
+			if (it->second.lastUsedFrame + LT_GLYPH_RUN_LIFETIME < m_Frame)
+				it = m_Runs.erase(it);
+			else
+				it++;
+		}
+	}
+
+	void GlyphRunCache::Build(GlyphRun& run)
+	{
+		LT_PROFILE_FUNC();
+
+		/* locals */
+		glm::vec2 advance(0.0f);
+		glm::vec2 beginning(0.0f);
+
+		// glyphs come from the face, sized by the font
+		Font* face = run.font->GetFace();
+		const float glyphScale = run.scale * run.font->GetSizeScale();
+
+		const float COS = std::cos(run.angle) * glyphScale;
+		const float SIN = std::sin(run.angle) * glyphScale;
+
+		run.glyphs.clear();
+		run.glyphs.reserve(run.text.size());
+		run.hasCachedGlyphs = false;
+
+		// decode and fetch the glyphs once, glyphs missing from the font's cache are rasterized here
+		m_Characters.clear();
+		for (size_t i = 0; i < run.text.size();)
+			m_Characters.push_back(face->GetCharacterData(DecodeUTF8(run.text, i), m_Frame));
+
+		face->FlushGlyphs();
+		run.fontGeneration = face->GetGeneration();
+
+		// calculate beginning, the run is centered on its origin
+		float width = 0.0f;
+		for (const auto& character : m_Characters)
+			width += character.advance;
+
+		beginning.x -= (width * COS) / 2.0f;
+		beginning.y -= (width * SIN) / 2.0f;
+
+		run.size = { width * glyphScale, (run.font->GetAscent() + run.font->GetDescent()) * run.scale };
+
+		run.boundsMin = glm::vec2(std::numeric_limits<float>::max());
+		run.boundsMax = glm::vec2(std::numeric_limits<float>::lowest());
+
+		for (const auto& character : m_Characters)
+		{
+			const glm::vec2 bearing(character.bearing.x * COS + (character.bearing.y) * SIN,
+			                        character.bearing.x * SIN - (character.bearing.y) * COS);
+
+			const glm::vec2 charPosition = beginning + advance + bearing;
+
+			advance.x += (character.advance) * COS;
+			advance.y += (character.advance) * SIN;
+
+			const glm::vec2 charCos = COS * character.size;
+			const glm::vec2 charSin = SIN * character.size;
+
+			GlyphQuad& glyph = run.glyphs.emplace_back();
+
+			// TOP_LEFT [ 0.0, 0.0 ], TOP_RIGHT [ 1.0, 0.0 ], BOTTOM_RIGHT [ 1.0, 1.0 ], BOTTOM_LEFT [ 0.0, 1.0 ]
+			glyph.corners[0] = charPosition;
+			glyph.corners[1] = glm::vec2(charCos.x, charSin.x) + charPosition;
+			glyph.corners[2] = glm::vec2(charCos.x - charSin.y, charSin.x + charCos.y) + charPosition;
+			glyph.corners[3] = glm::vec2(-charSin.y, charCos.y) + charPosition;
+
+			glyph.center = (glyph.corners[0] + glyph.corners[2]) / 2.0f;
+			glyph.halfSize = character.size * glyphScale / 2.0f;
+
+			glyph.uv = character.glyphUV;
+			glyph.cacheCell = character.cacheCell;
+
+			run.hasCachedGlyphs |= character.cacheCell >= 0;
+
+			for (const auto& corner : glyph.corners)
+			{
+				run.boundsMin = glm::min(run.boundsMin, corner);
+				run.boundsMax = glm::max(run.boundsMax, corner);
+			}
+		}
+
+		// empty run
+		if (run.glyphs.empty())
+			run.boundsMin = run.boundsMax = glm::vec2(0.0f);
+	}
+
+}
\ No newline at end of file
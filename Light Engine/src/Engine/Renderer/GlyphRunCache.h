@@ -0,0 +1,81 @@
+#pragma once
+
+#include "Font.h"
+
+#include "Core/Core.h"
+
+#include <glm/glm.hpp>
+
+#include <string_view>
+#include <unordered_map>
+
+namespace Light {
+
+	// a glyph laid out relative to the origin of its run
+	struct GlyphQuad
+	{
+		glm::vec2 corners[4]; // TOP_LEFT, TOP_RIGHT, BOTTOM_RIGHT, BOTTOM_LEFT
+
+		// for the instanced text renderer
+		glm::vec2 center;
+		glm::vec2 halfSize;
+
+		TextureCoordinates uv;
+
+		// glyph cache cell of the font, -1 for glyphs in its table
+		int cacheCell;
+	};
+
+	struct GlyphRun
+	{
+		std::string text; // utf-8
+		Font* font = nullptr;
+		uint64_t fontID = 0u;
+		float scale = 0.0f;
+		float angle = 0.0f;
+
+		// the run is rebuilt once the font evicts any of its cached glyphs
+		uint32_t fontGeneration = 0u;
+		bool hasCachedGlyphs = false;
+
+		std::vector<GlyphQuad> glyphs;
+
+		// advance width and ascent + descent, not rotated
+		glm::vec2 size;
+
+		// bounding box of the rotated glyphs, relative to the origin
+		glm::vec2 boundsMin;
+		glm::vec2 boundsMax;
+
+		uint64_t lastUsedFrame = 0u;
+	};
+
+	// laid out strings keyed by (text, font, scale, angle), drawing a cached run only translates its glyphs
+	// runs are never rebuilt once they're handed out, runs whose keys hash the same are kept side by side
+	class GlyphRunCache
+	{
+	private:
+		// inserting doesn't move the other runs
+		std::unordered_multimap<uint64_t, GlyphRun> m_Runs;
+		uint64_t m_Frame = 0u;
+
+		// scratch
+		std::vector<FontCharData> m_Characters;
+	public:
+		GlyphRunCache() = default;
+
+		// the reference stays valid until the next call to NewFrame or Clear
+		const GlyphRun& Get(std::string_view text, Font* font, float scale, float angle);
+
+		// runs that weren't used for a while are evicted
+		void NewFrame();
+
+		inline void Clear() { m_Runs.clear(); }
+
+		// getters
+		inline unsigned int GetSize() const { return (unsigned int)m_Runs.size(); }
+	private:
+		void Build(GlyphRun& run);
+	};
+
+}
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include "Blender.h"
 #include "RenderCommand.h"
 #include "Renderer.h"
+#include "ShaderCache.h"
 
 #include "UserInterface/UserInterface.h"
 
@@ -11,6 +12,8 @@
 	#include "Platform/DirectX/dxGraphicsContext.h"
 #endif
 #include "Platform/Opengl/glGraphicsContext.h"
+#include "Platform/Null/nullGraphicsContext.h"
+#include "Platform/Software/swGraphicsContext.h"
 
 #include "Utility/ResourceManager.h"
 
@@ -21,6 +24,10 @@ namespace Light {
 	std::unique_ptr<GraphicsContext> GraphicsContext::s_Context = nullptr;
 	GraphicsAPI GraphicsContext::s_Api = GraphicsAPI::Default;
 
+	uint32_t GraphicsContext::s_Generation = 0u;
+
+	std::atomic<std::thread::id> GraphicsContext::s_ContextThread;
+
 	bool GraphicsContext::CreateContext(GraphicsAPI api, const GraphicsConfigurations& configurations)
 	{
 		LT_PROFILE_FUNC();
@@ -48,6 +55,7 @@ namespace Light {
 		Blender::Terminate();
 		UserInterface::Terminate();
 		ResourceManager::Terminate();
+		ShaderCache::Terminate();
 
 		// create GraphicsContext 
 		s_Context.reset();
@@ -56,11 +64,19 @@ namespace Light {
 			s_Context = std::make_unique<glGraphicsContext>(configurations); // opengl
 		LT_DX(else if (s_Api == GraphicsAPI::Directx)
 			s_Context = std::make_unique<dxGraphicsContext>(configurations);) // directx
+		else if (s_Api == GraphicsAPI::Software)
+			s_Context = std::make_unique<swGraphicsContext>(configurations); // software
+		else if (s_Api == GraphicsAPI::Null)
+			s_Context = std::make_unique<nullGraphicsContext>(configurations); // null
 		else
 			LT_CORE_ASSERT(false, "GraphicsContext::CreateContext: invalid GraphicsAPI");
 
+		s_Generation++;
+		s_ContextThread = std::this_thread::get_id();
+
 		// initialize GraphicsContext dependent classes
-		Renderer::Init(configurations.MSAASampleCount, configurations.MSAAEnabled);
+		ShaderCache::Init(configurations.shaderCachePath);
+		Renderer::Init(configurations.MSAASampleCount, configurations.MSAAEnabled, configurations.compactVertices, configurations.instancedQuads);
 		RenderCommand::SetGraphicsContext(s_Context.get());
 		Blender::Init();
 		UserInterface::Init();
@@ -71,8 +87,10 @@ namespace Light {
 
 	void GraphicsContext::ShowDebugWindow()
 	{
-		ImGui::BulletText("graphics api: %s", s_Api == GraphicsAPI::Opengl  ? "opengl"  :
-		                                      s_Api == GraphicsAPI::Directx ? "directx" : "");
+		ImGui::BulletText("graphics api: %s", s_Api == GraphicsAPI::Opengl   ? "opengl"   :
+		                                      s_Api == GraphicsAPI::Directx  ? "directx"  :
+		                                      s_Api == GraphicsAPI::Software ? "software" :
+		                                      s_Api == GraphicsAPI::Null     ? "null"     : "");
 
 		ImGui::BulletText("resolution: [%d x %d]", m_Configurations.resolution.width, m_Configurations.resolution.height);
 		ImGui::BulletText("aspect ratio: %f", m_Configurations.resolution.aspectRatio);
@@ -2,6 +2,9 @@
 
 #include "Core/Core.h"
 
+#include <atomic>
+#include <thread>
+
 struct GLFWmonitor;
 
 namespace Light {
@@ -16,6 +19,12 @@ namespace Light {
 	enum class GraphicsAPI
 	{
 		Default, Opengl, Directx, // #todo: metal
+
+		// tile-based rasterizer on the cpu, see swGraphicsContext
+		Software,
+
+		// records the draw calls without executing them, see nullGraphicsContext
+		Null,
 	};
 
 	struct Resolution
@@ -53,6 +62,15 @@ namespace Light {
 
 		bool MSAAEnabled = false;
 		bool vSync = true;
+
+		// half-float/unorm vertices and 16-bit indices for the quad and text renderers
+		bool compactVertices = false;
+
+		// one instance record per quad, expanded in the vertex shader, takes precedence over compactVertices
+		bool instancedQuads = false;
+
+		// compiled programs are saved here and loaded by the next run, empty to always compile
+		std::string shaderCachePath = "shaders.ltcache";
 	};
 
 	class GraphicsContext
@@ -60,6 +78,14 @@ namespace Light {
 	private:
 		static std::unique_ptr<GraphicsContext> s_Context;
 		static GraphicsAPI s_Api;
+
+		// incremented whenever a context is created, frames recorded for an older generation are stale
+		static uint32_t s_Generation;
+
+		// the thread that created the context, or the one RenderThread handed it to
+		static std::atomic<std::thread::id> s_ContextThread;
+
+		friend class RenderThread;
 	protected:
 		GraphicsConfigurations m_Configurations;
 	public:
@@ -73,10 +99,17 @@ namespace Light {
 
 		virtual void SwapBuffers() = 0;
 
+		// binds the context to the calling thread, or releases it, the main thread and the render thread hand it over
+		// between frames; apis whose context isn't bound to a thread ignore it
+		virtual void MakeCurrent(bool current) {}
+
 		virtual void ClearBackbuffer(float colors[4]) = 0;
 
 		virtual void Draw(unsigned int count) = 0;
-		virtual void DrawIndexed(unsigned int count) = 0;
+		virtual void DrawIndexed(unsigned int count, unsigned int offset, unsigned int baseVertex) = 0;
+
+		// draws 'vertexCount' vertices 'instanceCount' times without an index buffer, starting at instance 'firstInstance'
+		virtual void DrawInstanced(unsigned int vertexCount, unsigned int instanceCount, unsigned int firstInstance) = 0;
 
 		virtual void DefaultRenderBuffer() = 0;
 
@@ -94,6 +127,11 @@ namespace Light {
 		// getters
 		static inline GraphicsAPI GetAPI() { return s_Api; }
 
+		static inline uint32_t GetGeneration() { return s_Generation; }
+
+		// the Renderer's static draws and text layout are only valid on this thread
+		static inline bool IsContextThread() { return std::this_thread::get_id() == s_ContextThread.load(std::memory_order_relaxed); }
+
 		static inline GraphicsConfigurations GetConfigurations() { return s_Context->m_Configurations; }
 
 		static inline Resolution GetResolution() { return s_Context->m_Configurations.resolution; }
@@ -7,6 +7,8 @@
 	#include "Platform/Directx/dxMSAA.h"
 #endif
 #include "Platform/Opengl/glMSAA.h"
+#include "Platform/Null/nullMSAA.h"
+#include "Platform/Software/swMSAA.h"
 
 namespace Light {
 
@@ -18,6 +20,10 @@ namespace Light {
 			return std::make_shared<glMSAA>(samples);
 		case GraphicsAPI::Directx:LT_DX(
 			return std::make_shared<dxMSAA>(samples);)
+		case GraphicsAPI::Software:
+			return std::make_shared<swMSAA>(samples);
+		case GraphicsAPI::Null:
+			return std::make_shared<nullMSAA>(samples);
 		default:
 			LT_CORE_ASSERT(false, "MSAA::Create: invalid GraphicsAPI");
 		}
@@ -0,0 +1,258 @@
+#include "ltpch.h"
+#include "PostProcess.h"
+
+#include "Blender.h"
+#include "Buffers.h"
+#include "GraphicsContext.h"
+#include "RenderCommand.h"
+#include "Shader.h"
+#include "VertexLayout.h"
+
+#include "Shaders/PostProcessShader.h"
+
+namespace Light {
+
+	std::shared_ptr<Framebuffer> FramebufferPool::Acquire(unsigned int width, unsigned int height, FramebufferFormat format)
+	{
+		for (Entry& entry : m_Entries)
+		{
+			if (entry.acquired || entry.framebuffer->GetWidth() != width || entry.framebuffer->GetHeight() != height || entry.framebuffer->GetFormat() != format)
+				continue;
+
+			entry.acquired = true;
+			entry.used = true;
+			return entry.framebuffer;
+		}
+
+		m_Entries.push_back({ Framebuffer::Create(width, height, format), true, true });
+		return m_Entries.back().framebuffer;
+	}
+
+	void FramebufferPool::Release(const std::shared_ptr<Framebuffer>& framebuffer)
+	{
+		for (Entry& entry : m_Entries)
+		{
+			if (entry.framebuffer == framebuffer)
+			{
+				entry.acquired = false;
+				return;
+			}
+		}
+
+		LT_CORE_ERROR("FramebufferPool::Release: framebuffer is not from this pool");
+	}
+
+	void FramebufferPool::Reset()
+	{
+		for (Entry& entry : m_Entries)
+		{
+			entry.acquired = false;
+			entry.used = false;
+		}
+	}
+
+	void FramebufferPool::Trim()
+	{
+		m_Entries.erase(std::remove_if(m_Entries.begin(), m_Entries.end(), [](const Entry& entry) { return !entry.used; }), m_Entries.end());
+	}
+
+	void FramebufferPool::Clear()
+	{
+		m_Entries.clear();
+	}
+
+	PostProcessGraph::PostProcessGraph()
+		: m_Width(0u), m_Height(0u), m_Dirty(false)
+	{
+	}
+
+	void PostProcessGraph::Init()
+	{
+		LT_PROFILE_FUNC();
+
+		Clear();
+
+		float vertices[] =
+		{
+			-1.0f,  1.0f,  0.0f, 1.0f,
+			 1.0f,  1.0f,  1.0f, 1.0f,
+			 1.0f, -1.0f,  1.0f, 0.0f,
+
+			 1.0f, -1.0f,  1.0f, 0.0f,
+			-1.0f, -1.0f,  0.0f, 0.0f,
+			-1.0f,  1.0f,  0.0f, 1.0f,
+		};
+
+		m_Vertices = VertexBuffer::Create(vertices, sizeof(float) * 4, 6);
+		m_Layout = VertexLayout::Create(nullptr, m_Vertices, { { "POSITION" , VertexElementType::Float2 },
+		                                                       { "TEXCOORDS", VertexElementType::Float2 } });
+	}
+
+	void PostProcessGraph::Clear()
+	{
+		m_Effects.clear();
+		m_Passes.clear();
+
+		m_SceneTarget.reset();
+		m_Pool.Clear();
+
+		m_Vertices.reset();
+		m_Layout.reset();
+
+		m_Dirty = false;
+	}
+
+	void PostProcessGraph::AddEffect(const PostProcessEffect& effect)
+	{
+		LT_CORE_ASSERT(!effect.IsPerPixel() || (!effect.glsl.empty() && !effect.hlsl.empty()),
+		               "PostProcessGraph::AddEffect: per-pixel effect is missing its glsl or hlsl source: {}", effect.name);
+
+		auto it = std::find_if(m_Effects.begin(), m_Effects.end(), [&](const PostProcessEffect& other) { return other.name == effect.name; });
+
+		if (it != m_Effects.end())
+			*it = effect;
+		else
+			m_Effects.push_back(effect);
+
+		m_Dirty = true;
+	}
+
+	void PostProcessGraph::RemoveEffect(StringID name)
+	{
+		auto it = std::find_if(m_Effects.begin(), m_Effects.end(), [&](const PostProcessEffect& effect) { return StringID(effect.name) == name; });
+
+		if (it == m_Effects.end())
+		{
+			LT_CORE_ERROR("PostProcessGraph::RemoveEffect: failed to find effect: {}", name.hash);
+			return;
+		}
+
+		m_Effects.erase(it);
+		m_Dirty = true;
+	}
+
+	void PostProcessGraph::Update()
+	{
+		const Resolution resolution = GraphicsContext::GetResolution();
+
+		if (m_Dirty || (!m_Effects.empty() && (resolution.width != m_Width || resolution.height != m_Height)))
+			Build();
+	}
+
+	void PostProcessGraph::Execute()
+	{
+		LT_PROFILE_FUNC();
+
+		// the passes overwrite every pixel of their target
+		Blender* blender = Blender::Get();
+		const bool blenderEnabled = blender->IsEnabled();
+
+		if (blenderEnabled)
+			blender->Disable();
+
+		m_Vertices->Bind();
+		m_Layout->Bind();
+
+		for (const Pass& pass : m_Passes)
+		{
+			if (pass.target)
+				pass.target->BindAsTarget();
+			else
+				RenderCommand::DefaultRenderBuffer();
+
+			pass.shader->Bind();
+			pass.input->BindAsResource();
+
+			RenderCommand::Draw(6);
+		}
+
+		if (blenderEnabled)
+			blender->Enable();
+	}
+
+	void PostProcessGraph::Build()
+	{
+		LT_PROFILE_FUNC();
+
+		const Resolution resolution = GraphicsContext::GetResolution();
+
+		m_Width = resolution.width;
+		m_Height = resolution.height;
+
+		m_Passes.clear();
+		m_SceneTarget.reset();
+
+		m_Pool.Reset();
+
+		if (!m_Effects.empty())
+		{
+			// RGBA8, MSAA resolves into it
+			m_SceneTarget = m_Pool.Acquire(m_Width, m_Height, FramebufferFormat::RGBA8);
+
+			std::shared_ptr<Framebuffer> input = m_SceneTarget;
+
+			for (size_t first = 0u, last; first < m_Effects.size(); first = last)
+			{
+				const PostProcessEffect& effect = m_Effects[first];
+
+				last = first + 1u;
+				if (effect.IsPerPixel())
+				{
+					while (last < m_Effects.size() && m_Effects[last].IsPerPixel() &&
+					       m_Effects[last].scale == effect.scale && m_Effects[last].format == effect.format)
+						last++;
+				}
+
+				/* locals */
+				Pass pass;
+				const unsigned int scale = (unsigned int)effect.scale;
+
+				pass.shader = effect.IsPerPixel() ? CreateFusedShader(first, last) : Shader::Create(PostProcessShaderSrc_VS, effect.pixelShader);
+				pass.input = input;
+				pass.effectCount = (unsigned int)(last - first);
+
+				// the last full resolution pass draws straight to the back buffer
+				// the target is acquired before the input is released, they're never the same framebuffer
+				if (last != m_Effects.size() || effect.scale != PostProcessScale::Full)
+					pass.target = m_Pool.Acquire(std::max(m_Width / scale, 1u), std::max(m_Height / scale, 1u), effect.format);
+
+				m_Pool.Release(input);
+				input = pass.target;
+
+				m_Passes.push_back(pass);
+			}
+
+			// reduced resolution output is upsampled to the back buffer
+			if (input)
+			{
+				m_Passes.push_back({ CreateFusedShader(0u, 0u), input, nullptr, 0u });
+				m_Pool.Release(input);
+			}
+		}
+
+		m_Pool.Trim();
+		m_Dirty = false;
+
+		LT_CORE_INFO("PostProcessGraph::Build: {} effects in {} passes, {} framebuffers", m_Effects.size(), m_Passes.size(), m_Pool.GetCount());
+	}
+
+	std::shared_ptr<Shader> PostProcessGraph::CreateFusedShader(size_t first, size_t last) const
+	{
+		LT_PROFILE_FUNC();
+
+		// each effect is scoped, their locals don't collide
+		std::string source = PostProcessShaderSrc_FS_GLSLHead;
+		for (size_t i = first; i < last; i++)
+			source += "\t{\n" + m_Effects[i].glsl + "\n\t}\n";
+		source += PostProcessShaderSrc_FS_GLSLTail;
+
+		source += PostProcessShaderSrc_FS_HLSLHead;
+		for (size_t i = first; i < last; i++)
+			source += "\t{\n" + m_Effects[i].hlsl + "\n\t}\n";
+		source += PostProcessShaderSrc_FS_HLSLTail;
+
+		// identical passes share their program through ShaderCache
+		return Shader::Create(PostProcessShaderSrc_VS, source);
+	}
+
+}
\ No newline at end of file
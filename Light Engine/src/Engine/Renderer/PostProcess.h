@@ -0,0 +1,124 @@
+#pragma once
+
+#include "Framebuffer.h"
+
+#include "Core/Core.h"
+
+#include "Utility/StringID.h"
+
+namespace Light {
+
+	class Shader;
+	class VertexBuffer;
+	class VertexLayout;
+
+	// size of an effect's output, the resolution divided by the scale
+	// reduced passes are bilinearly upsampled by the pass that reads them
+	enum class PostProcessScale : unsigned int
+	{
+		Full = 1u, Half = 2u, Quarter = 4u,
+	};
+
+	// per-pixel effects only touch the texel they're given, consecutive ones with the same scale and format are fused into a single pass
+	// sampling effects read other texels with a pixel shader of their own (ie. kernels) and always get a pass of their own
+	struct PostProcessEffect
+	{
+		std::string name;
+
+		// per-pixel: statements that modify 'color', the vec4/float4 texel of the input
+		std::string glsl, hlsl;
+
+		// sampling: path to or source of a pixel shader, see PostProcessShaderSrc_VS for its inputs
+		std::string pixelShader;
+
+		PostProcessScale scale = PostProcessScale::Full;
+		FramebufferFormat format = FramebufferFormat::RGBA8;
+
+		inline bool IsPerPixel() const { return pixelShader.empty(); }
+	};
+
+	// framebuffers of a PostProcessGraph, a released framebuffer is handed to the next pass that asks for its size and format
+	class FramebufferPool
+	{
+	private:
+		struct Entry
+		{
+			std::shared_ptr<Framebuffer> framebuffer;
+
+			bool acquired;
+			bool used; // acquired since the last Reset
+		};
+
+		std::vector<Entry> m_Entries;
+	public:
+		std::shared_ptr<Framebuffer> Acquire(unsigned int width, unsigned int height, FramebufferFormat format);
+		void Release(const std::shared_ptr<Framebuffer>& framebuffer);
+
+		// releases every framebuffer, the ones that aren't acquired again before Trim are destroyed
+		void Reset();
+		void Trim();
+
+		void Clear();
+
+		inline unsigned int GetCount() const { return (unsigned int)m_Entries.size(); }
+	};
+
+	// post process effects in the order they're applied to the scene
+	// the passes are built once and rebuilt when the effects or the resolution change, not every frame
+	class PostProcessGraph
+	{
+	private:
+		struct Pass
+		{
+			std::shared_ptr<Shader> shader;
+
+			std::shared_ptr<Framebuffer> input;
+			std::shared_ptr<Framebuffer> target; // null for the back buffer
+
+			unsigned int effectCount;
+		};
+
+		std::vector<PostProcessEffect> m_Effects;
+		std::vector<Pass> m_Passes;
+
+		FramebufferPool m_Pool;
+		std::shared_ptr<Framebuffer> m_SceneTarget;
+
+		std::shared_ptr<VertexBuffer> m_Vertices;
+		std::shared_ptr<VertexLayout> m_Layout;
+
+		unsigned int m_Width, m_Height;
+		bool m_Dirty;
+	public:
+		PostProcessGraph();
+
+		void Init();
+		void Clear();
+
+		// an effect with the same name is replaced in place
+		void AddEffect(const PostProcessEffect& effect);
+		void RemoveEffect(StringID name);
+
+		// rebuilds the passes if the effects or the resolution changed, changes made during a frame apply to the next one
+		void Update();
+
+		// draws the passes, the last one to the back buffer
+		void Execute();
+
+		// getters
+		inline bool IsEmpty() const { return m_Effects.empty(); }
+
+		// the scene is drawn here when the passes were built with effects, null otherwise
+		inline const std::shared_ptr<Framebuffer>& GetSceneTarget() const { return m_SceneTarget; }
+
+		inline unsigned int GetEffectCount() const { return (unsigned int)m_Effects.size(); }
+		inline unsigned int GetPassCount() const { return (unsigned int)m_Passes.size(); }
+		inline unsigned int GetFramebufferCount() const { return m_Pool.GetCount(); }
+	private:
+		void Build();
+
+		// fuses the per-pixel effects in [first, last) into one shader, an empty range only copies or upsamples the input
+		std::shared_ptr<Shader> CreateFusedShader(size_t first, size_t last) const;
+	};
+
+}
\ No newline at end of file
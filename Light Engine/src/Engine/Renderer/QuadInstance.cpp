@@ -0,0 +1,39 @@
+#include "ltpch.h"
+#include "QuadInstance.h"
+
+#include "Texture.h"
+
+#include <glm/gtc/packing.hpp>
+
+#include <cstring>
+
+namespace Light {
+
+	QuadInstance QuadInstance::Pack(const glm::vec3& center, const glm::vec2& halfSize, float angle,
+	                                const TextureCoordinates& texture, const glm::vec4& tint)
+	{
+		QuadInstance instance;
+
+		instance.center = glm::vec4(center, angle);
+		instance.halfSize = halfSize;
+
+		instance.SetTexture(texture);
+
+		const uint32_t packedTint = glm::packUnorm4x8(tint);
+		std::memcpy(instance.tint, &packedTint, sizeof(instance.tint));
+
+		return instance;
+	}
+
+	void QuadInstance::SetTexture(const TextureCoordinates& texture)
+	{
+		texRect[0] = glm::packUnorm1x16(texture.xMin);
+		texRect[1] = glm::packUnorm1x16(texture.yMin);
+		texRect[2] = glm::packUnorm1x16(texture.xMax);
+		texRect[3] = glm::packUnorm1x16(texture.yMax);
+
+		slice[0] = (uint8_t)texture.sliceIndex;
+		slice[1] = slice[2] = slice[3] = 0u;
+	}
+
+}
\ No newline at end of file
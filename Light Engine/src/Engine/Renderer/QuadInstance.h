@@ -0,0 +1,29 @@
+#pragma once
+
+#include "Core/Core.h"
+
+#include <glm/glm.hpp>
+
+namespace Light {
+
+	struct TextureCoordinates;
+
+	// one record per quad in the instanced renderers, 40 bytes instead of 4 vertices, see QuadShaderInstancedLayout
+	struct QuadInstance
+	{
+		glm::vec4 center;     // x, y, z, angle in radians
+		glm::vec2 halfSize;
+		uint16_t texRect[4];  // unorm16 xMin, yMin, xMax, yMax
+		uint8_t slice[4];     // slice index, padding
+		uint8_t tint[4];      // unorm8
+
+		static QuadInstance Pack(const glm::vec3& center, const glm::vec2& halfSize, float angle,
+		                         const TextureCoordinates& texture, const glm::vec4& tint);
+
+		// repacks the texture rect and slice, ie. after the texture was moved by TextureArray::Defragment
+		void SetTexture(const TextureCoordinates& texture);
+	};
+
+	static_assert(sizeof(QuadInstance) == 40u, "QuadInstance: size does not match QuadShaderInstancedLayout");
+
+}
\ No newline at end of file
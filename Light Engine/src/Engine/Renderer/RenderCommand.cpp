@@ -24,9 +24,14 @@ namespace Light {
 		s_GraphicsContextRef->Draw(count);
 	}
 
-	void RenderCommand::DrawIndexed(unsigned int count)
+	void RenderCommand::DrawIndexed(unsigned int count, unsigned int offset, unsigned int baseVertex)
 	{
-		s_GraphicsContextRef->DrawIndexed(count);
+		s_GraphicsContextRef->DrawIndexed(count, offset, baseVertex);
+	}
+
+	void RenderCommand::DrawInstanced(unsigned int vertexCount, unsigned int instanceCount, unsigned int firstInstance)
+	{
+		s_GraphicsContextRef->DrawInstanced(vertexCount, instanceCount, firstInstance);
 	}
 
 	void RenderCommand::DefaultRenderBuffer()
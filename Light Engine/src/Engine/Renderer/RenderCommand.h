@@ -19,7 +19,8 @@ namespace Light {
 		static void ClearBackbuffer();
 
 		static void Draw(unsigned int count);
-		static void DrawIndexed(unsigned int count);
+		static void DrawIndexed(unsigned int count, unsigned int offset = 0u, unsigned int baseVertex = 0u);
+		static void DrawInstanced(unsigned int vertexCount, unsigned int instanceCount, unsigned int firstInstance = 0u);
 
 		static void DefaultRenderBuffer();
 	private:
@@ -0,0 +1,254 @@
+#include "ltpch.h"
+#include "RenderCommandList.h"
+
+#include "Camera.h"
+#include "Font.h"
+#include "StaticBatch.h"
+
+namespace Light {
+
+	RenderCommandList::RenderCommandList()
+		: m_SubmissionMode(SubmissionMode::Immediate), m_SortLayer(0u), m_Blend(false), m_Culling(false),
+		  m_InScene(false), m_SceneFirstQuad(0u), m_SceneFirstString(0u)
+	{
+	}
+
+	void RenderCommandList::Reset()
+	{
+		LT_CORE_ASSERT(!m_InScene, "RenderCommandList::Reset: EndScene wasn't called");
+
+		// the vertex format changes with the graphics context
+		m_Quads.compactVertices = Renderer::s_QuadRenderer.compactVertices;
+		m_Quads.instanced = Renderer::s_QuadRenderer.instanced;
+
+		m_Quads.mapCurrent = m_Staging.data();
+		m_Quads.mapEnd = m_Staging.data() + m_Staging.size();
+		m_Quads.quadCount = 0u;
+
+		m_Strings.clear();
+		m_StringOrder.clear();
+
+		m_RenderQueue.Clear();
+		m_QuadCommands.clear();
+
+		m_DrawRuns.clear();
+		m_Scenes.clear();
+		m_StaticBatches.clear();
+
+		m_SubmissionMode = Renderer::s_SubmissionMode;
+		m_SortLayer = Renderer::s_SortLayer;
+		m_Blend = false;
+		m_Culling = Renderer::s_CullingEnabled;
+
+		m_Stats = {};
+	}
+
+	void RenderCommandList::BeginScene(const std::shared_ptr<Camera>& camera)
+	{
+		LT_CORE_ASSERT(!m_InScene, "RenderCommandList::BeginScene: EndScene wasn't called");
+
+		Scene scene;
+		camera->CalculateViewProjection(scene.view, scene.projection);
+		scene.bounds = camera->GetCameraBounds();
+
+		scene.firstRun = (unsigned int)m_DrawRuns.size();
+		scene.runCount = 0u;
+
+		scene.firstBatch = (unsigned int)m_StaticBatches.size();
+		scene.batchCount = 0u;
+
+		m_Scenes.push_back(scene);
+
+		m_SceneFirstQuad = m_Quads.quadCount;
+		m_SceneFirstString = (unsigned int)m_StringOrder.size();
+
+		m_InScene = true;
+	}
+
+	void RenderCommandList::DrawQuad(const glm::vec3& position, const glm::vec2& size, const TextureCoordinates& texture, const glm::vec4& tint)
+	{
+		LT_CORE_ASSERT(m_InScene, "RenderCommandList::DrawQuad: BeginScene wasn't called");
+
+		m_Stats.quads++;
+		if (m_Culling && Renderer::IsQuadOutside(m_Scenes.back().bounds, position, size, 0.0f))
+		{
+			m_Stats.culledQuads++;
+			return;
+		}
+
+		if (m_SubmissionMode == SubmissionMode::Deferred)
+		{
+			m_RenderQueue.Push(RenderQueueKey::Make(m_SortLayer, position.z, m_Blend, RendererProgramIndex_Quad), (unsigned int)m_QuadCommands.size());
+			m_QuadCommands.push_back({ position, size, 0.0f, texture, tint });
+		}
+		else
+		{
+			ReserveQuads(1u);
+			Renderer::WriteQuad(m_Quads, position, size, texture, tint);
+		}
+	}
+
+	void RenderCommandList::DrawQuad(const glm::vec3& position, const glm::vec2& size, float angle, TextureCoordinates* texture, const glm::vec4& tint)
+	{
+		LT_CORE_ASSERT(m_InScene, "RenderCommandList::DrawQuad: BeginScene wasn't called");
+
+		m_Stats.quads++;
+		if (m_Culling && Renderer::IsQuadOutside(m_Scenes.back().bounds, position, size, angle))
+		{
+			m_Stats.culledQuads++;
+			return;
+		}
+
+		if (m_SubmissionMode == SubmissionMode::Deferred)
+		{
+			m_RenderQueue.Push(RenderQueueKey::Make(m_SortLayer, position.z, m_Blend, RendererProgramIndex_Quad), (unsigned int)m_QuadCommands.size());
+			m_QuadCommands.push_back({ position, size, angle, *texture, tint });
+		}
+		else
+		{
+			ReserveQuads(1u);
+			Renderer::WriteQuad(m_Quads, position, size, angle, *texture, tint);
+		}
+	}
+
+	void RenderCommandList::DrawQuads(unsigned int count, const glm::vec3* positions, const glm::vec2* sizes, const float* angles,
+	                                  TextureCoordinates* const* textures, const glm::vec4* tints)
+	{
+		LT_PROFILE_FUNC();
+		LT_CORE_ASSERT(m_InScene, "RenderCommandList::DrawQuads: BeginScene wasn't called");
+
+		if (m_SubmissionMode == SubmissionMode::Deferred)
+		{
+			for (unsigned int i = 0; i < count; i++)
+				DrawQuad(positions[i], sizes[i], angles[i], textures[i], tints[i]);
+
+			return;
+		}
+
+		m_Stats.quads += count;
+
+		// the staging memory grows once for the whole array
+		ReserveQuads(count);
+
+		unsigned int first = 0u;
+		while (first < count)
+		{
+			// culled quads split the arrays into runs of visible quads, 'last' is culled or past the end
+			unsigned int last = first;
+			while (last < count && !(m_Culling && Renderer::IsQuadOutside(m_Scenes.back().bounds, positions[last], sizes[last], angles[last])))
+				last++;
+
+			Renderer::WriteQuads(m_Quads, last - first, positions + first, sizes + first, angles + first, textures + first, tints + first);
+
+			if (last < count)
+				m_Stats.culledQuads++;
+
+			first = last + 1u;
+		}
+	}
+
+	void RenderCommandList::DrawStaticBatch(const std::shared_ptr<StaticBatch>& batch)
+	{
+		LT_CORE_ASSERT(m_InScene, "RenderCommandList::DrawStaticBatch: BeginScene wasn't called");
+
+		m_StaticBatches.push_back(batch);
+		m_Scenes.back().batchCount++;
+	}
+
+	void RenderCommandList::DrawString(const std::string& text, const std::shared_ptr<Font>& font,
+	                                   const glm::vec3& position, float scale, const glm::vec4& tint)
+	{
+		DrawString(text, font, position, 0.0f, scale, tint);
+	}
+
+	void RenderCommandList::DrawString(const std::string& text, const std::shared_ptr<Font>& font,
+	                                   const glm::vec3& position, float angle, float scale, const glm::vec4& tint)
+	{
+		LT_CORE_ASSERT(m_InScene, "RenderCommandList::DrawString: BeginScene wasn't called");
+
+		// strings are counted and culled by Renderer::Submit, once they're laid out
+		if (m_SubmissionMode == SubmissionMode::Deferred)
+			m_RenderQueue.Push(RenderQueueKey::Make(m_SortLayer, position.z, m_Blend, RendererProgramIndex_Text), (unsigned int)m_Strings.size());
+		else
+			m_StringOrder.push_back((unsigned int)m_Strings.size());
+
+		m_Strings.push_back({ text, font, position, angle, scale, tint });
+	}
+
+	void RenderCommandList::EndScene()
+	{
+		LT_CORE_ASSERT(m_InScene, "RenderCommandList::EndScene: BeginScene wasn't called");
+
+		if (m_SubmissionMode == SubmissionMode::Deferred)
+			ExpandRenderQueue();
+		else
+		{
+			// quads are drawn before text
+			const uint16_t blend = m_Blend ? 1u << 8 : 0u;
+
+			PushDrawRun(blend | RendererProgramIndex_Quad, m_SceneFirstQuad, m_Quads.quadCount - m_SceneFirstQuad);
+			PushDrawRun(blend | RendererProgramIndex_Text, m_SceneFirstString, (unsigned int)m_StringOrder.size() - m_SceneFirstString);
+		}
+
+		Scene& scene = m_Scenes.back();
+		scene.runCount = (unsigned int)m_DrawRuns.size() - scene.firstRun;
+
+		m_InScene = false;
+	}
+
+	void RenderCommandList::ReserveQuads(unsigned int count)
+	{
+		if (m_Quads.GetAvailableQuadCount() >= count)
+			return;
+
+		// the staging memory is kept by Reset, it stops growing once it fits the layer's frame
+		const size_t used = m_Quads.mapCurrent - m_Staging.data();
+		m_Staging.resize(std::max(m_Staging.size() * 2u, used + (size_t)count * m_Quads.GetQuadSize()));
+
+		m_Quads.mapCurrent = m_Staging.data() + used;
+		m_Quads.mapEnd = m_Staging.data() + m_Staging.size();
+	}
+
+	void RenderCommandList::ExpandRenderQueue()
+	{
+		LT_PROFILE_FUNC();
+
+		m_RenderQueue.Sort();
+		ReserveQuads((unsigned int)m_QuadCommands.size());
+
+		// write the sorted commands, a new draw run starts whenever the render state changes
+		const unsigned int firstRun = m_Scenes.back().firstRun;
+		for (const auto& entry : m_RenderQueue)
+		{
+			const uint16_t state = RenderQueueKey::GetState(entry.key);
+			const bool quad = RenderQueueKey::GetProgram(entry.key) == RendererProgramIndex_Quad;
+
+			if (m_DrawRuns.size() == firstRun || m_DrawRuns.back().state != state)
+				m_DrawRuns.push_back({ state, quad ? m_Quads.quadCount : (unsigned int)m_StringOrder.size(), 0u });
+
+			if (quad)
+			{
+				const QuadCommand& command = m_QuadCommands[entry.index];
+
+				if (command.angle == 0.0f)
+					Renderer::WriteQuad(m_Quads, command.position, command.size, command.texture, command.tint);
+				else
+					Renderer::WriteQuad(m_Quads, command.position, command.size, command.angle, command.texture, command.tint);
+			}
+			else
+				m_StringOrder.push_back(entry.index);
+
+			m_DrawRuns.back().count++;
+		}
+
+		m_RenderQueue.Clear();
+		m_QuadCommands.clear();
+	}
+
+	void RenderCommandList::PushDrawRun(uint16_t state, unsigned int first, unsigned int count)
+	{
+		if (count)
+			m_DrawRuns.push_back({ state, first, count });
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,150 @@
+#pragma once
+
+#include "CameraController.h"
+#include "Renderer.h"
+#include "RenderQueue.h"
+#include "Texture.h"
+
+#include "Core/Core.h"
+
+#include <glm/glm.hpp>
+
+namespace Light {
+
+	class Camera;
+
+	class Font;
+
+	class StaticBatch;
+
+	// the draws of a layer, recorded without touching the graphics context so layers can record on several threads,
+	// Renderer::Submit draws them on the main thread
+	// quads are written to the list's own staging memory in the renderer's vertex format while recording,
+	// strings are laid out when they are submitted since their glyphs may have to be rasterized into the font's texture
+	// the blend state is part of the list, it starts disabled and is set with SetBlending instead of the Blender
+	class RenderCommandList
+	{
+	private:
+		struct QuadCommand
+		{
+			glm::vec3 position;
+			glm::vec2 size;
+			float angle;
+
+			TextureCoordinates texture;
+			glm::vec4 tint;
+		};
+
+		struct StringCommand
+		{
+			std::string text;
+			std::shared_ptr<Font> font;
+
+			glm::vec3 position;
+			float angle;
+			float scale;
+
+			glm::vec4 tint;
+		};
+
+		// quads of the staging memory for the quad program, indices into m_StringOrder for the text program
+		struct DrawRun
+		{
+			uint16_t state;
+
+			unsigned int first;
+			unsigned int count;
+		};
+
+		struct Scene
+		{
+			glm::mat4 view, projection;
+			CameraBounds bounds;
+
+			unsigned int firstRun, runCount;
+			unsigned int firstBatch, batchCount;
+		};
+
+		// staging memory
+		QuadStream m_Quads;
+		std::vector<uint8_t> m_Staging;
+
+		// strings, in the order they are drawn
+		std::vector<StringCommand> m_Strings;
+		std::vector<unsigned int> m_StringOrder;
+
+		// SubmissionMode::Deferred
+		RenderQueue m_RenderQueue;
+		std::vector<QuadCommand> m_QuadCommands;
+
+		std::vector<DrawRun> m_DrawRuns;
+		std::vector<Scene> m_Scenes;
+
+		std::vector<std::shared_ptr<StaticBatch>> m_StaticBatches;
+
+		// state, taken from the Renderer by Reset
+		SubmissionMode m_SubmissionMode;
+		uint8_t m_SortLayer;
+		bool m_Blend;
+		bool m_Culling;
+
+		bool m_InScene;
+
+		// the scene being recorded
+		unsigned int m_SceneFirstQuad;
+		unsigned int m_SceneFirstString;
+
+		RendererStats m_Stats;
+	public:
+		RenderCommandList();
+
+		// clears the recorded scenes, the staging memory is kept
+		// the submission mode, culling and vertex format are taken from the Renderer, it has to be called on the main thread
+		void Reset();
+
+		void BeginScene(const std::shared_ptr<Camera>& camera);
+
+		// quad renderer
+		void DrawQuad(const glm::vec3& position, const glm::vec2& size, const TextureCoordinates& texture, const glm::vec4& tint = glm::vec4(1.0f));
+
+		void DrawQuad(const glm::vec3& position, const glm::vec2& size, float angle, TextureCoordinates* texture, const glm::vec4& tint = glm::vec4(1.0f));
+
+		// each pointer refers to an array of 'count' elements, rotations are calculated with SIMD
+		void DrawQuads(unsigned int count, const glm::vec3* positions, const glm::vec2* sizes, const float* angles,
+		               TextureCoordinates* const* textures, const glm::vec4* tints);
+
+		// drawn when the scene is submitted, before its quads and text
+		void DrawStaticBatch(const std::shared_ptr<StaticBatch>& batch);
+
+		// text renderer, text is utf-8
+		void DrawString(const std::string& text, const std::shared_ptr<Font>& font,
+		                const glm::vec3& position, float scale = 1.0f, const glm::vec4& tint = glm::vec4(1.0f));
+
+		void DrawString(const std::string& text, const std::shared_ptr<Font>& font,
+		                const glm::vec3& position, float angle, float scale = 1.0f, const glm::vec4& tint = glm::vec4(1.0f));
+
+		void EndScene();
+
+		// like the Blender, the state at EndScene is used for the scene in SubmissionMode::Immediate
+		inline void SetBlending(bool enabled) { m_Blend = enabled; }
+
+		// most significant part of the sort key, only used in SubmissionMode::Deferred
+		inline void SetSortLayer(uint8_t layer) { m_SortLayer = layer; }
+
+		// getters
+		inline const RendererStats& GetStats() const { return m_Stats; }
+
+		inline bool IsEmpty() const { return m_Scenes.empty(); }
+	private:
+		friend class Renderer;
+
+		// makes room for 'count' more quads in the staging memory
+		void ReserveQuads(unsigned int count);
+
+		// writes the sorted commands of the scene, a new draw run starts whenever the render state changes
+		void ExpandRenderQueue();
+
+		void PushDrawRun(uint16_t state, unsigned int first, unsigned int count);
+	};
+
+}
\ No newline at end of file
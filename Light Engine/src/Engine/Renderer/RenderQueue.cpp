@@ -0,0 +1,69 @@
+#include "ltpch.h"
+#include "RenderQueue.h"
+
+#include <cstring>
+
+namespace Light {
+
+	uint64_t RenderQueueKey::Make(uint8_t layer, float depth, uint8_t blend, uint8_t program)
+	{
+		// map the float's bits to an unsigned integer with the same ordering
+		uint32_t depthBits;
+		std::memcpy(&depthBits, &depth, sizeof(float));
+		depthBits = depthBits & 0x80000000u ? ~depthBits : depthBits | 0x80000000u;
+
+		return ((uint64_t)layer     << 56) |
+		       ((uint64_t)depthBits << 24) |
+		       ((uint64_t)blend     << 16) |
+		       ((uint64_t)program   << 8 );
+	}
+
+	void RenderQueue::Sort()
+	{
+		LT_PROFILE_FUNC();
+
+		const size_t count = m_Entries.size();
+		if (count < 2u)
+			return;
+
+		// build the histograms of all 8 bytes in a single pass
+		unsigned int histograms[8][256] = {};
+		for (const auto& entry : m_Entries)
+			for (unsigned int byte = 0; byte < 8; byte++)
+				histograms[byte][(entry.key >> (byte * 8)) & 0xff]++;
+
+		m_Scratch.resize(count);
+
+		RenderQueueEntry* source = m_Entries.data();
+		RenderQueueEntry* destination = m_Scratch.data();
+
+		for (unsigned int byte = 0; byte < 8; byte++)
+		{
+			unsigned int* histogram = histograms[byte];
+
+			// every key has the same value in this byte, nothing to sort
+			if (histogram[(source->key >> (byte * 8)) & 0xff] == count)
+				continue;
+
+			// prefix sum
+			unsigned int offset = 0u;
+			for (unsigned int i = 0; i < 256; i++)
+			{
+				const unsigned int bucketSize = histogram[i];
+				histogram[i] = offset;
+				offset += bucketSize;
+			}
+
+			// scatter
+			for (size_t i = 0; i < count; i++)
+				destination[histogram[(source[i].key >> (byte * 8)) & 0xff]++] = source[i];
+
+			std::swap(source, destination);
+		}
+
+		// the sorted entries ended up in the scratch buffer
+		if (source != m_Entries.data())
+			m_Entries.swap(m_Scratch);
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "Core/Core.h"
+
+namespace Light {
+
+	// sort key layout, most significant first: [ layer: 8 | depth: 32 | blend: 8 | program: 8 | unused: 8 ]
+	// depth has to come before the render state, otherwise translucent quads and text would be drawn out of order
+	struct RenderQueueKey
+	{
+		static uint64_t Make(uint8_t layer, float depth, uint8_t blend, uint8_t program);
+
+		static inline uint8_t GetBlend  (uint64_t key) { return (uint8_t)(key >> 16); }
+		static inline uint8_t GetProgram(uint64_t key) { return (uint8_t)(key >> 8 ); }
+
+		// render state (blend + program) without layer and depth, used to detect state changes
+		static inline uint16_t GetState(uint64_t key) { return (uint16_t)(key >> 8); }
+	};
+
+	struct RenderQueueEntry
+	{
+		uint64_t key;
+		unsigned int index;
+	};
+
+	class RenderQueue
+	{
+	private:
+		std::vector<RenderQueueEntry> m_Entries;
+		std::vector<RenderQueueEntry> m_Scratch;
+	public:
+		RenderQueue() = default;
+
+		inline void Push(uint64_t key, unsigned int index) { m_Entries.push_back({ key, index }); }
+
+		// stable LSD radix sort, passes over bytes that are the same for every key are skipped
+		void Sort();
+
+		inline void Clear() { m_Entries.clear(); }
+
+		// getters
+		inline std::vector<RenderQueueEntry>::const_iterator begin() const { return m_Entries.begin(); }
+		inline std::vector<RenderQueueEntry>::const_iterator end  () const { return m_Entries.end();   }
+
+		inline unsigned int GetSize() const { return (unsigned int)m_Entries.size(); }
+
+		inline bool IsEmpty() const { return m_Entries.empty(); }
+	};
+
+}
\ No newline at end of file
@@ -1,51 +1,84 @@
 #include "ltpch.h"
 #include "Renderer.h"
 
+#include "Blender.h"
 #include "Camera.h"
-#include "Framebuffer.h"
+#include "GraphicsContext.h"
 #include "MSAA.h"
 #include "RenderCommand.h"
+#include "RenderCommandList.h"
+#include "StaticBatch.h"
 #include "Texture.h"
 
 #include "Font.h"
 #include "Shaders/QuadShader.h"
 #include "Shaders/TextShader.h"
 
+#include "Utility/SIMD.h"
+
+#include <glm/gtc/packing.hpp>
+
+#include <imgui.h>
+
+// layers record on workers and the render thread may be drawing, the static entry points share the renderer's state
+#define LT_ASSERT_CONTEXT_THREAD(function) \
+	LT_CORE_ASSERT(GraphicsContext::IsContextThread(), function ": called off the graphics context's thread, record into a RenderCommandList instead")
+
 namespace Light {
 
+	struct Renderer::QuadCommand
+	{
+		glm::vec3 position;
+		glm::vec2 size;
+		float angle;
+
+		TextureCoordinates texture;
+		glm::vec4 tint;
+	};
+
+	struct Renderer::StringCommand
+	{
+		// valid until the next BeginFrame
+		const GlyphRun* run;
+
+		glm::vec3 position;
+		glm::vec4 tint;
+	};
+
 	Renderer::QuadRenderer Renderer::s_QuadRenderer;
 	Renderer::TextRenderer Renderer::s_TextRenderer;
 
-	std::vector<std::shared_ptr<Framebuffer>> Renderer::s_Framebuffers;
-	std::shared_ptr<VertexBuffer> Renderer::s_FramebufferVertices;
-	std::shared_ptr<VertexLayout> Renderer::s_FramebufferLayout;
+	RenderQueue Renderer::s_RenderQueue;
+	std::vector<Renderer::QuadCommand> Renderer::s_QuadCommands;
+	std::vector<Renderer::StringCommand> Renderer::s_StringCommands;
+
+	std::vector<Renderer::DrawRun> Renderer::s_DrawRuns;
+
+	std::shared_ptr<Shader> Renderer::s_StaticBatchShader;
+
+	SubmissionMode Renderer::s_SubmissionMode = SubmissionMode::Immediate;
+	uint8_t Renderer::s_SortLayer = 0u;
+
+	GlyphRunCache Renderer::s_GlyphRunCache;
+
+	PostProcessGraph Renderer::s_PostProcess;
 
 	std::shared_ptr<ConstantBuffer> Renderer::s_ViewProjBuffer;
 
+	CameraBounds Renderer::s_CullBounds = {};
+	bool Renderer::s_CullingEnabled = false;
+
+	RendererStats Renderer::s_Stats;
+
 	std::shared_ptr<MSAA> Renderer::s_MSAA;
 	bool Renderer::s_MSAAEnabled = false;
 
-	void Renderer::Init(unsigned int MSAASampleCount, bool MSAA)
+	void Renderer::Init(unsigned int MSAASampleCount, bool MSAA, bool compactVertices, bool instancedQuads)
 	{
 		LT_PROFILE_FUNC();
 
-		// framebuffers
-		s_Framebuffers.clear();
-
-		float framebufferVertices[] =
-		{
-			-1.0f,  1.0f,  0.0f, 1.0f,
-			 1.0f,  1.0f,  1.0f, 1.0f,
-			 1.0f, -1.0f,  1.0f, 0.0f,
-
-			 1.0f, -1.0f,  1.0f, 0.0f,
-			-1.0f, -1.0f,  0.0f, 0.0f,
-			-1.0f,  1.0f,  0.0f, 1.0f,
-		};
-
-		s_FramebufferVertices = VertexBuffer::Create(framebufferVertices, sizeof(float) * 4, 6);
-		s_FramebufferLayout = VertexLayout::Create(nullptr, s_FramebufferVertices, { { "POSITION" , VertexElementType::Float2 },
-																					 { "TEXCOORDS", VertexElementType::Float2 } });
+		// post process
+		s_PostProcess.Init();
 
 		// view projection buffer
 		s_ViewProjBuffer = ConstantBuffer::Create(ConstantBufferIndex_ViewProjection, sizeof(glm::mat4) * 2);
@@ -54,57 +87,131 @@ namespace Light {
 		SetMSAA(MSAA);
 		SetMSAASampleCount(MSAASampleCount);
 
+		// instance records are expanded by the vertex shader, there are no vertices to compact
+		compactVertices = compactVertices && !instancedQuads;
+
 		//=============== QUAD RENDERER ===============//
-		s_QuadRenderer.shader = Shader::Create(QuadShaderSrc_VS, QuadShaderSrc_FS);
+		s_QuadRenderer.compactVertices = compactVertices;
+		s_QuadRenderer.instanced = instancedQuads;
 
-		s_QuadRenderer.vertexBuffer = VertexBuffer::Create(nullptr, sizeof(QuadRenderer::QuadVertexData), LT_MAX_BASIC_SPRITES * 4);
-		s_QuadRenderer.indexBuffer = IndexBuffer::Create(nullptr, LT_MAX_BASIC_SPRITES * 6);
+		if (instancedQuads)
+		{
+			s_QuadRenderer.shader = Shader::Create(QuadShaderSrc_Instanced_VS, QuadShaderSrc_FS);
+			s_QuadRenderer.vertexElements = QuadShaderInstancedLayout;
+		}
+		else if (compactVertices)
+		{
+			s_QuadRenderer.shader = Shader::Create(QuadShaderSrc_Compact_VS, QuadShaderSrc_FS);
+			s_QuadRenderer.vertexElements = QuadShaderCompactLayout;
+		}
+		else
+		{
+			s_QuadRenderer.shader = Shader::Create(QuadShaderSrc_VS, QuadShaderSrc_FS);
+			s_QuadRenderer.vertexElements = s_QuadRenderer.shader->GetElements();
+		}
 
-		s_QuadRenderer.vertexLayout = VertexLayout::Create(s_QuadRenderer.shader, s_QuadRenderer.vertexBuffer, s_QuadRenderer.shader->GetElements());
+		AllocateProgram(s_QuadRenderer, s_QuadRenderer.GetInitialQuadCount());
 		//=============== QUAD RENDERER ===============//
 
 		//================== TEXT RENDERER ==================//
-		s_TextRenderer.shader = Shader::Create(TextShaderSrc_VS, TextShaderSrc_FS);
+		s_TextRenderer.compactVertices = compactVertices;
+		s_TextRenderer.instanced = instancedQuads;
+
+		if (instancedQuads)
+		{
+			s_TextRenderer.shader = Shader::Create(TextShaderSrc_Instanced_VS, TextShaderSrc_FS);
+			s_TextRenderer.vertexElements = TextShaderInstancedLayout;
+		}
+		else if (compactVertices)
+		{
+			s_TextRenderer.shader = Shader::Create(TextShaderSrc_Compact_VS, TextShaderSrc_FS);
+			s_TextRenderer.vertexElements = TextShaderCompactLayout;
+		}
+		else
+		{
+			s_TextRenderer.shader = Shader::Create(TextShaderSrc_VS, TextShaderSrc_FS);
+			s_TextRenderer.vertexElements = s_QuadRenderer.shader->GetElements();
+		}
 
-		s_TextRenderer.vertexBuffer = VertexBuffer::Create(nullptr, sizeof(TextRenderer::TextVertexData), LT_MAX_TEXT_SPRITES * 4);
-		s_TextRenderer.indexBuffer = IndexBuffer::Create(nullptr, LT_MAX_TEXT_SPRITES * 6);
-																																						  
-		s_TextRenderer.vertexLayout = VertexLayout::Create(s_TextRenderer.shader, s_TextRenderer.vertexBuffer, s_QuadRenderer.shader->GetElements());
+		AllocateProgram(s_TextRenderer, s_TextRenderer.GetInitialQuadCount());
 		//================== TEXT RENDERER ==================//
+
+		// static batches are always instanced
+		s_StaticBatchShader = instancedQuads ? s_QuadRenderer.shader : Shader::Create(QuadShaderSrc_Instanced_VS, QuadShaderSrc_FS);
+	}
+
+	void Renderer::AllocateProgram(RendererProgram& program, unsigned int quadCapacity)
+	{
+		LT_PROFILE_FUNC();
+
+		program.vertexBuffer = StreamVertexBuffer::Create(program.GetVertexSize(), quadCapacity * program.GetVerticesPerQuad());
+		program.vertexLayout = VertexLayout::Create(program.shader, program.vertexBuffer, program.vertexElements,
+		                                            program.instanced ? VertexInputRate::PerInstance : VertexInputRate::PerVertex);
+
+		// instanced programs don't use an index buffer
+		if (program.instanced)
+			return;
+
+		// draws use a base vertex, so the index buffer only has to cover a single draw;
+		// 16-bit indices can't address more than 16384 quads
+		program.indexedQuadCount = program.compactVertices ? std::min(quadCapacity, (UINT16_MAX + 1u) / 4u) : quadCapacity;
+		program.indexBuffer = IndexBuffer::Create(nullptr, program.indexedQuadCount * 6u,
+		                                          program.compactVertices ? IndexFormat::UInt16 : IndexFormat::UInt32);
 	}
 
 	void Renderer::Terminate()
 	{
 		s_QuadRenderer.Reset();
 		s_TextRenderer.Reset();
+
+		s_RenderQueue.Clear();
+		s_QuadCommands.clear();
+		s_StringCommands.clear();
+		s_DrawRuns.clear();
+
+		s_GlyphRunCache.Clear();
+
+		s_StaticBatchShader.reset();
 		
 		s_ViewProjBuffer.reset();
 		
-		s_Framebuffers.clear();
-		s_FramebufferVertices.reset();
-		s_FramebufferLayout.reset();
+		s_PostProcess.Clear();
 
 		s_MSAA.reset();
 	}
 
 	void Renderer::BeginFrame()
 	{
+		s_Stats = {};
+		s_GlyphRunCache.NewFrame();
+
+		s_PostProcess.Update();
+		const std::shared_ptr<Framebuffer>& sceneTarget = s_PostProcess.GetSceneTarget();
+
 		if (s_MSAAEnabled)
 			s_MSAA->BindFrameBuffer();
-		else if (!s_Framebuffers.empty())
-			s_Framebuffers[0]->BindAsTarget();
+		else if (sceneTarget)
+			sceneTarget->BindAsTarget(true);
 	}
 
 	void Renderer::BeginScene(const std::shared_ptr<Camera>& camera)
 	{
-		// set view projection buffer
+		LT_ASSERT_CONTEXT_THREAD("Renderer::BeginScene");
+
 		camera->CalculateViewProjection();
+		BeginScene(camera->GetView(), camera->GetProjection(), camera->GetCameraBounds());
+	}
 
+	void Renderer::BeginScene(const glm::mat4& view, const glm::mat4& projection, const CameraBounds& bounds)
+	{
+		// set view projection buffer
 		glm::mat4* map = (glm::mat4*)s_ViewProjBuffer->Map();
-		map[0] = camera->GetView();
-		map[1] = camera->GetProjection();
+		map[0] = view;
+		map[1] = projection;
 		s_ViewProjBuffer->UnMap();
 
+		s_CullBounds = bounds;
+
 		// map renderer's vertex buffer
 		s_QuadRenderer.Map();
 		s_TextRenderer.Map();
@@ -112,277 +219,436 @@ namespace Light {
 	
 	void Renderer::DrawQuad(const glm::vec3& position, const glm::vec2& size, const TextureCoordinates& texture, const glm::vec4& tint)
 	{
-		if (s_QuadRenderer.mapCurrent == s_QuadRenderer.mapEnd)
-		{
-			LT_CORE_ERROR("Renderer::DrawQuad: calls to this function exceeded its limit: {}", s_QuadRenderer.GetMaximumQuadCount());
-			EndScene();
+		LT_ASSERT_CONTEXT_THREAD("Renderer::DrawQuad");
 
-			s_QuadRenderer.Map();
-			s_TextRenderer.Map();
-		}
+		s_Stats.quads++;
+		if (s_CullingEnabled && IsQuadCulled(position, size, 0.0f))
+			return;
 
-		/* locals */
-		const float xMin = position.x - size.x / 2.0f;
-		const float xMax = position.x + size.x / 2.0f;
-		const float yMin = position.y - size.y / 2.0f;
-		const float yMax = position.y + size.y / 2.0f;
+		if (s_SubmissionMode == SubmissionMode::Deferred)
+		{
+			s_RenderQueue.Push(RenderQueueKey::Make(s_SortLayer, position.z, Blender::Get()->IsEnabled(), RendererProgramIndex_Quad),
+			                   (unsigned int)s_QuadCommands.size());
+			s_QuadCommands.push_back({ position, size, 0.0f, texture, tint });
+		}
+		else
+		{
+			// the frame's vertices don't fit, draw what's written and continue in a larger vertex buffer
+			if (s_QuadRenderer.mapCurrent == s_QuadRenderer.mapEnd)
+				FlushAndRemap();
 
-		// TOP_LEFT  [ -0.5, -0.5 ]
-		s_QuadRenderer.mapCurrent->position = { xMin, yMin, position.z };
-		s_QuadRenderer.mapCurrent->str = { texture.xMin, texture.yMin, texture.sliceIndex };
-		s_QuadRenderer.mapCurrent->tint = tint;
-		s_QuadRenderer.mapCurrent++;
+			WriteQuad(s_QuadRenderer, position, size, texture, tint);
+		}
+	}
 
-		// TOP_RIGHT [ 0.5, -0.5 ]
-		s_QuadRenderer.mapCurrent->position = { xMax, yMin, position.z };
-		s_QuadRenderer.mapCurrent->str = { texture.xMax, texture.yMin, texture.sliceIndex };
-		s_QuadRenderer.mapCurrent->tint = tint;
-		s_QuadRenderer.mapCurrent++;
+	void Renderer::DrawQuad(const glm::vec3& position, const glm::vec2& size, float angle, TextureCoordinates* texture, const glm::vec4& tint)
+	{
+		LT_ASSERT_CONTEXT_THREAD("Renderer::DrawQuad");
 
-		// BOTTOM_RIGHT [ 0.5, 0.5 ]
-		s_QuadRenderer.mapCurrent->position = { xMax, yMax, position.z };
-		s_QuadRenderer.mapCurrent->str = { texture.xMax, texture.yMax, texture.sliceIndex };
-		s_QuadRenderer.mapCurrent->tint = tint;
-		s_QuadRenderer.mapCurrent++;
+		s_Stats.quads++;
+		if (s_CullingEnabled && IsQuadCulled(position, size, angle))
+			return;
 
-		// BOTTOM_LEFT [ -0.5, 0.5 ]
-		s_QuadRenderer.mapCurrent->position = { xMin, yMax, position.z };
-		s_QuadRenderer.mapCurrent->str = { texture.xMin, texture.yMax, texture.sliceIndex };
-		s_QuadRenderer.mapCurrent->tint = tint;
-		s_QuadRenderer.mapCurrent++;
+		if (s_SubmissionMode == SubmissionMode::Deferred)
+		{
+			s_RenderQueue.Push(RenderQueueKey::Make(s_SortLayer, position.z, Blender::Get()->IsEnabled(), RendererProgramIndex_Quad),
+			                   (unsigned int)s_QuadCommands.size());
+			s_QuadCommands.push_back({ position, size, angle, *texture, tint });
+		}
+		else
+		{
+			// the frame's vertices don't fit, draw what's written and continue in a larger vertex buffer
+			if (s_QuadRenderer.mapCurrent == s_QuadRenderer.mapEnd)
+				FlushAndRemap();
 
-		s_QuadRenderer.quadCount++;
+			WriteQuad(s_QuadRenderer, position, size, angle, *texture, tint);
+		}
 	}
 
-	void Renderer::DrawQuad(const glm::vec3& position, const glm::vec2& size, float angle, TextureCoordinates* texture, const glm::vec4& tint)
+	void Renderer::DrawQuads(unsigned int count, const glm::vec3* positions, const glm::vec2* sizes, const float* angles,
+	                         TextureCoordinates* const* textures, const glm::vec4* tints)
 	{
-		if (s_QuadRenderer.mapCurrent == s_QuadRenderer.mapEnd)
+		LT_PROFILE_FUNC();
+		LT_ASSERT_CONTEXT_THREAD("Renderer::DrawQuads");
+
+		if (s_SubmissionMode == SubmissionMode::Deferred)
 		{
-			LT_CORE_ERROR("Renderer::DrawQuad: calls to this function exceeded its limit: {}", s_QuadRenderer.GetMaximumQuadCount());
-			EndScene();
+			for (unsigned int i = 0; i < count; i++)
+				DrawQuad(positions[i], sizes[i], angles[i], textures[i], tints[i]);
 
-			s_QuadRenderer.Map();
-			s_TextRenderer.Map();
+			return;
 		}
 
-		/* locals */
-		const float COS = std::cos(angle);
-		const float SIN = std::sin(angle);
+		s_Stats.quads += count;
 
-		glm::vec2 quadCos = COS * size / 2.0f;
-		glm::vec2 quadSin = SIN * size / 2.0f;
+		unsigned int first = 0u;
+		while (first < count)
+		{
+			// culled quads split the arrays into runs of visible quads, 'last' is culled or past the end
+			unsigned int last = first;
+			while (last < count && !(s_CullingEnabled && IsQuadCulled(positions[last], sizes[last], angles[last])))
+				last++;
 
-		/* write to the buffer */
-		// TOP_LEFT  [ -0.5, -0.5 ]
-		s_QuadRenderer.mapCurrent->position = glm::vec3(-(quadCos.x - quadSin.y), -(quadSin.x + quadCos.y), 0.0f) + position;
-		s_QuadRenderer.mapCurrent->str = { texture->xMin, texture->yMin, texture->sliceIndex };
-		s_QuadRenderer.mapCurrent->tint = tint;
-		s_QuadRenderer.mapCurrent++;
+			// check the capacity once per batch instead of once per quad
+			while (first < last)
+			{
+				if (!s_QuadRenderer.GetAvailableQuadCount())
+					FlushAndRemap();
 
-		// TOP_RIGHT [ 0.5, -0.5 ]
-		s_QuadRenderer.mapCurrent->position = glm::vec3(quadCos.x - -quadSin.y, quadSin.x + -quadCos.y, 0.0f) + position;
-		s_QuadRenderer.mapCurrent->str = glm::vec3(texture->xMax, texture->yMin, texture->sliceIndex);
-		s_QuadRenderer.mapCurrent->tint = tint;
-		s_QuadRenderer.mapCurrent++;
+				const unsigned int batch = std::min(s_QuadRenderer.GetAvailableQuadCount(), last - first);
+				WriteQuads(s_QuadRenderer, batch, positions + first, sizes + first, angles + first, textures + first, tints + first);
 
-		// BOTTOM_RIGHT [ 0.5, 0.5 ]
-		s_QuadRenderer.mapCurrent->position = glm::vec3(quadCos.x - quadSin.y, quadSin.x + quadCos.y, 0.0f) + position;
-		s_QuadRenderer.mapCurrent->str = { texture->xMax, texture->yMax, texture->sliceIndex };
-		s_QuadRenderer.mapCurrent->tint = tint;
-		s_QuadRenderer.mapCurrent++;
+				first += batch;
+			}
 
-		// BOTTOM_LEFT [ -0.5, 0.5 ]
-		s_QuadRenderer.mapCurrent->position = glm::vec3(-quadCos.x - quadSin.y, -quadSin.x + quadCos.y, 0.0f) + position;
-		s_QuadRenderer.mapCurrent->str = { texture->xMin, texture->yMax, texture->sliceIndex };
-		s_QuadRenderer.mapCurrent->tint = tint;
-		s_QuadRenderer.mapCurrent++;
+			first = last + 1u;
+		}
+	}
+
+	void Renderer::DrawStaticBatch(const std::shared_ptr<StaticBatch>& batch)
+	{
+		LT_PROFILE_FUNC();
+		LT_ASSERT_CONTEXT_THREAD("Renderer::DrawStaticBatch");
 
-		s_QuadRenderer.quadCount++;
+		batch->Upload(s_StaticBatchShader);
+		DrawUploadedBatch(batch);
+	}
+
+	void Renderer::DrawUploadedBatch(const std::shared_ptr<StaticBatch>& batch)
+	{
+		if (!batch->GetUploadedCount())
+			return;
+
+		s_StaticBatchShader->Bind();
+		batch->Bind();
+
+		RenderCommand::DrawInstanced(6u, batch->GetUploadedCount());
 	}
 
 	void Renderer::DrawString(const std::string& text, const std::shared_ptr<Font>& font,
 	                          const glm::vec3& position, float scale, const glm::vec4& tint)
 	{
-		/* locals */
-		glm::vec2 beginning(position);
-		float advance = 0.0f;
+		DrawString(text, font, position, 0.0f, scale, tint);
+	}
 
-		// calculate beginning
-		for (const auto& ch : text)
-			beginning.x -= (font->GetCharacterData(ch).advance) * scale / 2.0f;
+	void Renderer::DrawString(const std::string& text, const std::shared_ptr<Font>& font,
+	                          const glm::vec3& position, float angle, float scale, const glm::vec4& tint)
+	{
+		LT_ASSERT_CONTEXT_THREAD("Renderer::DrawString");
 
-		for (const auto& ch : text)
+		const GlyphRun& run = s_GlyphRunCache.Get(text, font.get(), scale, angle);
+
+		s_Stats.strings++;
+		if (s_CullingEnabled && IsStringCulled(run, position))
+			return;
+
+		if (s_SubmissionMode == SubmissionMode::Deferred)
 		{
-			if (s_TextRenderer.mapCurrent == s_TextRenderer.mapEnd)
-			{
-				LT_CORE_ERROR("Renderer::DrawString: calls to this function exceeded its limit (or string too long): {}", s_TextRenderer.GetMaximumQuadCount());
-				EndScene();
+			s_RenderQueue.Push(RenderQueueKey::Make(s_SortLayer, position.z, Blender::Get()->IsEnabled(), RendererProgramIndex_Text),
+			                   (unsigned int)s_StringCommands.size());
+			s_StringCommands.push_back({ &run, position, tint });
+		}
+		else
+			WriteString(run, position, tint);
+	}
 
-				s_QuadRenderer.Map();
-				s_TextRenderer.Map();
-			}
+	glm::vec2 Renderer::MeasureString(const std::string& text, const std::shared_ptr<Font>& font, float scale)
+	{
+		LT_ASSERT_CONTEXT_THREAD("Renderer::MeasureString");
+
+		return s_GlyphRunCache.Get(text, font.get(), scale, 0.0f).size;
+	}
+
+	void Renderer::PushQuad(QuadStream& stream, const glm::vec3& topLeft, const glm::vec3& topRight,
+	                        const glm::vec3& bottomRight, const glm::vec3& bottomLeft,
+	                        const TextureCoordinates& texture, const glm::vec4& tint)
+	{
+		if (stream.compactVertices)
+		{
+			QuadStream::CompactVertexData* map = (QuadStream::CompactVertexData*)stream.mapCurrent;
 
 			/* locals */
-			const FontCharData character = font->GetCharacterData(ch);
+			const uint16_t uMin = glm::packUnorm1x16(texture.xMin);
+			const uint16_t uMax = glm::packUnorm1x16(texture.xMax);
+			const uint16_t vMin = glm::packUnorm1x16(texture.yMin);
+			const uint16_t vMax = glm::packUnorm1x16(texture.yMax);
+
+			const uint8_t slice = (uint8_t)texture.sliceIndex;
+			const uint32_t packedTint = glm::packUnorm4x8(tint);
 
-			const float xMin = beginning.x + (character.bearing.x * scale) + advance;
-			const float yMin = beginning.y - (character.bearing.y) * scale;
+			const auto writeVertex = [&](QuadStream::CompactVertexData& vertex, const glm::vec3& position, uint16_t u, uint16_t v)
+			{
+				const glm::u16vec4 halfPosition = glm::packHalf(glm::vec4(position, 1.0f));
+				std::memcpy(vertex.position, &halfPosition, sizeof(vertex.position));
+
+				vertex.uv[0] = u;
+				vertex.uv[1] = v;
 
-			const float xMax = xMin + character.size.x * scale;
-			const float yMax = yMin + character.size.y * scale;
+				vertex.slice[0] = slice;
+				vertex.slice[1] = vertex.slice[2] = vertex.slice[3] = 0u;
 
-			advance += (character.advance) * scale;
+				std::memcpy(vertex.tint, &packedTint, sizeof(vertex.tint));
+			};
 
-			/* write to the buffer */
-			// TOP_LEFT [ 0.0, 0.0 ]
-			s_TextRenderer.mapCurrent->position = { xMin, yMin, position.z };
-			s_TextRenderer.mapCurrent->str = { character.glyphUV.xMin, character.glyphUV.yMin, character.glyphUV.sliceIndex };
-			s_TextRenderer.mapCurrent->tint = tint;
-			s_TextRenderer.mapCurrent++;
+			writeVertex(map[0], topLeft    , uMin, vMin);
+			writeVertex(map[1], topRight   , uMax, vMin);
+			writeVertex(map[2], bottomRight, uMax, vMax);
+			writeVertex(map[3], bottomLeft , uMin, vMax);
 
-			// TOP_RIGHT [ 1.0, 0.0 ]
-			s_TextRenderer.mapCurrent->position = { xMax, yMin, position.z };
-			s_TextRenderer.mapCurrent->str = { character.glyphUV.xMax, character.glyphUV.yMin, character.glyphUV.sliceIndex };
-			s_TextRenderer.mapCurrent->tint = tint;
-			s_TextRenderer.mapCurrent++;
+			stream.mapCurrent += sizeof(QuadStream::CompactVertexData) * 4;
+		}
+		else
+		{
+			QuadStream::VertexData* map = (QuadStream::VertexData*)stream.mapCurrent;
 
-			// BOTTOM_RIGHT [ 1.0, 1.0 ]
-			s_TextRenderer.mapCurrent->position = { xMax, yMax, position.z };
-			s_TextRenderer.mapCurrent->str = { character.glyphUV.xMax, character.glyphUV.yMax, character.glyphUV.sliceIndex};
-			s_TextRenderer.mapCurrent->tint = tint;
-			s_TextRenderer.mapCurrent++;
+			// TOP_LEFT
+			map[0].position = topLeft;
+			map[0].str = { texture.xMin, texture.yMin, texture.sliceIndex };
+			map[0].tint = tint;
 
-			// BOTTOM_LEFT [ 0.0, 1.0 ] 
-			s_TextRenderer.mapCurrent->position = { xMin, yMax, position.z };
-			s_TextRenderer.mapCurrent->str = { character.glyphUV.xMin, character.glyphUV.yMax, character.glyphUV.sliceIndex };
-			s_TextRenderer.mapCurrent->tint = tint;
-			s_TextRenderer.mapCurrent++;
+			// TOP_RIGHT
+			map[1].position = topRight;
+			map[1].str = { texture.xMax, texture.yMin, texture.sliceIndex };
+			map[1].tint = tint;
 
-			s_TextRenderer.quadCount++;
+			// BOTTOM_RIGHT
+			map[2].position = bottomRight;
+			map[2].str = { texture.xMax, texture.yMax, texture.sliceIndex };
+			map[2].tint = tint;
+
+			// BOTTOM_LEFT
+			map[3].position = bottomLeft;
+			map[3].str = { texture.xMin, texture.yMax, texture.sliceIndex };
+			map[3].tint = tint;
+
+			stream.mapCurrent += sizeof(QuadStream::VertexData) * 4;
 		}
+
+		stream.quadCount++;
 	}
 
-	void Renderer::DrawString(const std::string& text, const std::shared_ptr<Font>& font,
-	                          const glm::vec3& position, float angle, float scale, const glm::vec4& tint)
+	void Renderer::PushInstance(QuadStream& stream, const glm::vec3& center, const glm::vec2& halfSize, float angle,
+	                            const TextureCoordinates& texture, const glm::vec4& tint)
+	{
+		*(QuadInstance*)stream.mapCurrent = QuadInstance::Pack(center, halfSize, angle, texture, tint);
+
+		stream.mapCurrent += sizeof(QuadInstance);
+		stream.quadCount++;
+	}
+
+	void Renderer::WriteQuad(QuadStream& stream, const glm::vec3& position, const glm::vec2& size, const TextureCoordinates& texture, const glm::vec4& tint)
+	{
+		if (stream.instanced)
+		{
+			PushInstance(stream, position, size / 2.0f, 0.0f, texture, tint);
+			return;
+		}
+
+		/* locals */
+		const float xMin = position.x - size.x / 2.0f;
+		const float xMax = position.x + size.x / 2.0f;
+		const float yMin = position.y - size.y / 2.0f;
+		const float yMax = position.y + size.y / 2.0f;
+
+		// TOP_LEFT [ -0.5, -0.5 ], TOP_RIGHT [ 0.5, -0.5 ], BOTTOM_RIGHT [ 0.5, 0.5 ], BOTTOM_LEFT [ -0.5, 0.5 ]
+		PushQuad(stream, { xMin, yMin, position.z }, { xMax, yMin, position.z },
+		                 { xMax, yMax, position.z }, { xMin, yMax, position.z }, texture, tint);
+	}
+
+	void Renderer::WriteQuad(QuadStream& stream, const glm::vec3& position, const glm::vec2& size, float angle, const TextureCoordinates& texture, const glm::vec4& tint)
 	{
+		// the rotation is done by the vertex shader
+		if (stream.instanced)
+		{
+			PushInstance(stream, position, size / 2.0f, angle, texture, tint);
+			return;
+		}
+
 		/* locals */
-		glm::vec2 advance(0.0f);
-		glm::vec2 beginning(position);
+		const float COS = std::cos(angle);
+		const float SIN = std::sin(angle);
 
-		const float COS = std::cos(angle) * scale;
-		const float SIN = std::sin(angle) * scale;
+		glm::vec2 quadCos = COS * size / 2.0f;
+		glm::vec2 quadSin = SIN * size / 2.0f;
+
+		// TOP_LEFT [ -0.5, -0.5 ], TOP_RIGHT [ 0.5, -0.5 ], BOTTOM_RIGHT [ 0.5, 0.5 ], BOTTOM_LEFT [ -0.5, 0.5 ]
+		PushQuad(stream, glm::vec3(-(quadCos.x - quadSin.y), -(quadSin.x + quadCos.y), 0.0f) + position,
+		                 glm::vec3(quadCos.x - -quadSin.y, quadSin.x + -quadCos.y, 0.0f) + position,
+		                 glm::vec3(quadCos.x - quadSin.y, quadSin.x + quadCos.y, 0.0f) + position,
+		                 glm::vec3(-quadCos.x - quadSin.y, -quadSin.x + quadCos.y, 0.0f) + position,
+		                 texture, tint);
+	}
 
-		// calculate beginning
-		for (const auto& ch : text)
+	void Renderer::WriteQuads(QuadStream& stream, unsigned int count, const glm::vec3* positions, const glm::vec2* sizes, const float* angles,
+	                          TextureCoordinates* const* textures, const glm::vec4* tints)
+	{
+		// the rotation is done by the vertex shader
+		if (stream.instanced)
 		{
-			beginning.x -= ((font->GetCharacterData(ch).advance) * COS) / 2.0f;
-			beginning.y -= ((font->GetCharacterData(ch).advance) * SIN) / 2.0f;
+			for (unsigned int i = 0; i < count; i++)
+				PushInstance(stream, positions[i], sizes[i] / 2.0f, angles[i], *textures[i], tints[i]);
+
+			return;
 		}
 
-		for (const auto& ch : text)
+		// with [cx, cy] and [sx, sy] being the half size scaled by cos/sin of the angle:
+		//     a = cx - sy, b = sx + cy, d = cx + sy, e = sx - cy
+		const auto writeVertices = [&stream](const glm::vec3& position, float a, float b, float d, float e,
+		                                     const TextureCoordinates& texture, const glm::vec4& tint)
 		{
-			if (s_TextRenderer.mapCurrent == s_TextRenderer.mapEnd)
-			{
-				LT_CORE_ERROR("Renderer::DrawString: calls to this function exceeded its limit (or string too long): {}", s_TextRenderer.GetMaximumQuadCount());
-				EndScene();
+			// TOP_LEFT [ -0.5, -0.5 ], TOP_RIGHT [ 0.5, -0.5 ], BOTTOM_RIGHT [ 0.5, 0.5 ], BOTTOM_LEFT [ -0.5, 0.5 ]
+			PushQuad(stream, { position.x - a, position.y - b, position.z }, { position.x + d, position.y + e, position.z },
+			                 { position.x + a, position.y + b, position.z }, { position.x - d, position.y - e, position.z },
+			                 texture, tint);
+		};
 
-				s_QuadRenderer.Map();
-				s_TextRenderer.Map();
-			}
+		unsigned int i = 0u;
 
-			/* locals */
-			const auto& character = font->GetCharacterData(ch);
-			 
-			const glm::vec2 bearing(character.bearing.x  * COS + (character.bearing.y) * SIN,
-			                        character.bearing.x  * SIN - (character.bearing.y) * COS);
+#ifdef LT_SIMD_AVX
+		alignas(32) float a8[8], b8[8], d8[8], e8[8];
+		for (; i + 8u <= count; i += 8u)
+		{
+			__m256 sin, cos;
+			SinCos(_mm256_loadu_ps(angles + i), sin, cos);
+
+			// deinterleave [x, y] pairs into half widths and half heights
+			const __m256 sizes0 = _mm256_loadu_ps((const float*)(sizes + i));
+			const __m256 sizes1 = _mm256_loadu_ps((const float*)(sizes + i + 4u));
+
+			const __m256 sizesLow  = _mm256_permute2f128_ps(sizes0, sizes1, 0x20);
+			const __m256 sizesHigh = _mm256_permute2f128_ps(sizes0, sizes1, 0x31);
 
-			const glm::vec3 charPosition = glm::vec3(beginning + advance + bearing, position.z);
+			const __m256 half = _mm256_set1_ps(0.5f);
+			const __m256 halfWidth  = _mm256_mul_ps(_mm256_shuffle_ps(sizesLow, sizesHigh, _MM_SHUFFLE(2, 0, 2, 0)), half);
+			const __m256 halfHeight = _mm256_mul_ps(_mm256_shuffle_ps(sizesLow, sizesHigh, _MM_SHUFFLE(3, 1, 3, 1)), half);
 
-			advance.x += (character.advance) * COS;
-			advance.y += (character.advance) * SIN;
+			const __m256 cx = _mm256_mul_ps(cos, halfWidth);
+			const __m256 cy = _mm256_mul_ps(cos, halfHeight);
+			const __m256 sx = _mm256_mul_ps(sin, halfWidth);
+			const __m256 sy = _mm256_mul_ps(sin, halfHeight);
 
-			const glm::vec2 charCos = COS * character.size;
-			const glm::vec2 charSin = SIN * character.size;
+			_mm256_store_ps(a8, _mm256_sub_ps(cx, sy));
+			_mm256_store_ps(b8, _mm256_add_ps(sx, cy));
+			_mm256_store_ps(d8, _mm256_add_ps(cx, sy));
+			_mm256_store_ps(e8, _mm256_sub_ps(sx, cy));
 
-			/* write to the buffer  */	
-			// TOP_LEFT [ 0.0, 0.0 ]
-			s_TextRenderer.mapCurrent->position = charPosition;
-			s_TextRenderer.mapCurrent->str = { character.glyphUV.xMin, character.glyphUV.yMin, character.glyphUV.sliceIndex };
-			s_TextRenderer.mapCurrent->tint = tint;
-			s_TextRenderer.mapCurrent++;
+			for (unsigned int lane = 0u; lane < 8u; lane++)
+				writeVertices(positions[i + lane], a8[lane], b8[lane], d8[lane], e8[lane], *textures[i + lane], tints[i + lane]);
+		}
+#endif
+
+#ifdef LT_SIMD_SSE
+		alignas(16) float a4[4], b4[4], d4[4], e4[4];
+		for (; i + 4u <= count; i += 4u)
+		{
+			__m128 sin, cos;
+			SinCos(_mm_loadu_ps(angles + i), sin, cos);
 
-			// TOP_RIGHT [ 1.0, 0.0 ]
-			s_TextRenderer.mapCurrent->position = glm::vec3(charCos.x, charSin.x, 0.0f) + charPosition;
-			s_TextRenderer.mapCurrent->str = { character.glyphUV.xMax, character.glyphUV.yMin, character.glyphUV.sliceIndex };
-			s_TextRenderer.mapCurrent->tint = tint;
-			s_TextRenderer.mapCurrent++;
+			// deinterleave [x, y] pairs into half widths and half heights
+			const __m128 sizes0 = _mm_loadu_ps((const float*)(sizes + i));
+			const __m128 sizes1 = _mm_loadu_ps((const float*)(sizes + i + 2u));
 
-			// BOTTOM_RIGHT [ 1.0, 1.0 ]
-			s_TextRenderer.mapCurrent->position = glm::vec3(charCos.x - charSin.y, charSin.x + charCos.y, 0.0f) + charPosition;
-			s_TextRenderer.mapCurrent->str = { character.glyphUV.xMax, character.glyphUV.yMax, character.glyphUV.sliceIndex };
-			s_TextRenderer.mapCurrent->tint = tint;
-			s_TextRenderer.mapCurrent++;
+			const __m128 half = _mm_set1_ps(0.5f);
+			const __m128 halfWidth  = _mm_mul_ps(_mm_shuffle_ps(sizes0, sizes1, _MM_SHUFFLE(2, 0, 2, 0)), half);
+			const __m128 halfHeight = _mm_mul_ps(_mm_shuffle_ps(sizes0, sizes1, _MM_SHUFFLE(3, 1, 3, 1)), half);
 
-			// BOTTOM_LEFT [ 0.0, 1.0 ] 
-			s_TextRenderer.mapCurrent->position = glm::vec3(-charSin.y, charCos.y, 0.0f) + charPosition;
-			s_TextRenderer.mapCurrent->str = { character.glyphUV.xMin, character.glyphUV.yMax, character.glyphUV.sliceIndex };
-			s_TextRenderer.mapCurrent->tint = tint;
-			s_TextRenderer.mapCurrent++;
+			const __m128 cx = _mm_mul_ps(cos, halfWidth);
+			const __m128 cy = _mm_mul_ps(cos, halfHeight);
+			const __m128 sx = _mm_mul_ps(sin, halfWidth);
+			const __m128 sy = _mm_mul_ps(sin, halfHeight);
 
-			s_TextRenderer.quadCount++;
+			_mm_store_ps(a4, _mm_sub_ps(cx, sy));
+			_mm_store_ps(b4, _mm_add_ps(sx, cy));
+			_mm_store_ps(d4, _mm_add_ps(cx, sy));
+			_mm_store_ps(e4, _mm_sub_ps(sx, cy));
+
+			for (unsigned int lane = 0u; lane < 4u; lane++)
+				writeVertices(positions[i + lane], a4[lane], b4[lane], d4[lane], e4[lane], *textures[i + lane], tints[i + lane]);
 		}
+#endif
+
+		// remainder
+		for (; i < count; i++)
+		{
+			const float sin = std::sin(angles[i]);
+			const float cos = std::cos(angles[i]);
+
+			const glm::vec2 halfSize = sizes[i] / 2.0f;
+
+			writeVertices(positions[i], cos * halfSize.x - sin * halfSize.y, sin * halfSize.x + cos * halfSize.y,
+			                            cos * halfSize.x + sin * halfSize.y, sin * halfSize.x - cos * halfSize.y,
+			              *textures[i], tints[i]);
+		}
+
 	}
 
-	void Renderer::EndScene()
+	void Renderer::WriteString(const GlyphRun& run, const glm::vec3& position, const glm::vec4& tint)
 	{
-		s_TextRenderer.vertexBuffer->UnMap();
-		s_QuadRenderer.vertexBuffer->UnMap();
-
-		//=============== QUAD RENDERER ===============//
-		if (s_QuadRenderer.quadCount)
+		for (const auto& glyph : run.glyphs)
 		{
-			s_QuadRenderer.Bind();
-				
-			RenderCommand::DrawIndexed(s_QuadRenderer.quadCount * 6);
-			s_QuadRenderer.quadCount = 0;
+			if (s_TextRenderer.mapCurrent == s_TextRenderer.mapEnd)
+				FlushAndRemap();
+
+			if (s_TextRenderer.instanced)
+			{
+				PushInstance(s_TextRenderer, glm::vec3(glm::vec2(position) + glyph.center, position.z), glyph.halfSize, run.angle, glyph.uv, tint);
+				continue;
+			}
+
+			// TOP_LEFT [ 0.0, 0.0 ], TOP_RIGHT [ 1.0, 0.0 ], BOTTOM_RIGHT [ 1.0, 1.0 ], BOTTOM_LEFT [ 0.0, 1.0 ]
+			PushQuad(s_TextRenderer, glm::vec3(glm::vec2(position) + glyph.corners[0], position.z),
+			                         glm::vec3(glm::vec2(position) + glyph.corners[1], position.z),
+			                         glm::vec3(glm::vec2(position) + glyph.corners[2], position.z),
+			                         glm::vec3(glm::vec2(position) + glyph.corners[3], position.z),
+			                         glyph.uv, tint);
 		}
-		//=============== QUAD RENDERER ===============//
+	}
 
-		//================== TEXT RENDERER ==================//
-		if (s_TextRenderer.quadCount)
+	void Renderer::CopyQuads(const uint8_t* quads, unsigned int count)
+	{
+		/* locals */
+		const unsigned int quadSize = s_QuadRenderer.GetQuadSize();
+
+		while (count)
 		{
-			s_TextRenderer.Bind();
+			if (!s_QuadRenderer.GetAvailableQuadCount())
+				FlushAndRemap();
 
-			RenderCommand::DrawIndexed(s_TextRenderer.quadCount * 6);
-			s_TextRenderer.quadCount = 0;
+			const unsigned int batch = std::min(s_QuadRenderer.GetAvailableQuadCount(), count);
+			std::memcpy(s_QuadRenderer.mapCurrent, quads, (size_t)batch * quadSize);
+
+			s_QuadRenderer.mapCurrent += (size_t)batch * quadSize;
+			s_QuadRenderer.quadCount += batch;
+
+			quads += (size_t)batch * quadSize;
+			count -= batch;
 		}
-		//================== TEXT RENDERER ==================//
+	}
+
+	void Renderer::EndScene()
+	{
+		if (!s_RenderQueue.IsEmpty())
+			ExpandRenderQueue();
+
+		FlushScene();
 	}
 
 	void Renderer::EndFrame()
 	{
-		
-		if (!s_Framebuffers.empty())
+		// the frame's vertices were drawn, the next frame writes to the next regions
+		s_QuadRenderer.vertexBuffer->EndFrame();
+		s_TextRenderer.vertexBuffer->EndFrame();
+
+		// the passes built in BeginFrame, the scene was drawn to their target
+		if (const std::shared_ptr<Framebuffer>& sceneTarget = s_PostProcess.GetSceneTarget())
 		{
 			if (s_MSAAEnabled)
 			{
-				s_Framebuffers[0]->BindAsTarget();
+				sceneTarget->BindAsTarget();
 				s_MSAA->Resolve();
 			}
 
-			s_FramebufferVertices->Bind();
-			s_FramebufferLayout->Bind();
-
-			for (int i = 1; i < s_Framebuffers.size(); i++)
-			{
-				s_Framebuffers[i]->BindAsTarget();
-				s_Framebuffers[i - 1]->BindAsResource();
-				RenderCommand::Draw(6);
-			}
-
-			RenderCommand::DefaultRenderBuffer();
-			s_Framebuffers.back()->BindAsResource();
-			RenderCommand::Draw(6);
+			s_PostProcess.Execute();
 		}
 		else
 		{
@@ -394,24 +660,304 @@ namespace Light {
 		}
 	}
 
-	void Renderer::AddFramebuffer(std::shared_ptr<Framebuffer> framebuffer)
+	void Renderer::UploadStaticBatches(const RenderCommandList& commands)
+	{
+		LT_PROFILE_FUNC();
+		LT_ASSERT_CONTEXT_THREAD("Renderer::UploadStaticBatches");
+
+		for (const auto& batch : commands.m_StaticBatches)
+			batch->Upload(s_StaticBatchShader);
+	}
+
+	void Renderer::Submit(const RenderCommandList& commands)
+	{
+		LT_PROFILE_FUNC();
+
+		LT_CORE_ASSERT(!commands.m_InScene, "Renderer::Submit: EndScene wasn't called on the list");
+		LT_CORE_ASSERT(commands.m_Quads.compactVertices == s_QuadRenderer.compactVertices && commands.m_Quads.instanced == s_QuadRenderer.instanced,
+		               "Renderer::Submit: the list's vertex format doesn't match, it has to be reset after changing the graphics context");
+
+		s_Stats.quads += commands.m_Stats.quads;
+		s_Stats.culledQuads += commands.m_Stats.culledQuads;
+
+		/* locals */
+		const unsigned int quadSize = s_QuadRenderer.GetQuadSize();
+
+		for (const auto& scene : commands.m_Scenes)
+		{
+			BeginScene(scene.view, scene.projection, scene.bounds);
+
+			for (unsigned int i = scene.firstBatch; i < scene.firstBatch + scene.batchCount; i++)
+				DrawUploadedBatch(commands.m_StaticBatches[i]);
+
+			// the runs are replayed as they are, the list's draw runs are the scene's draw runs
+			for (unsigned int i = scene.firstRun; i < scene.firstRun + scene.runCount; i++)
+			{
+				const auto& run = commands.m_DrawRuns[i];
+				OpenDrawRun(run.state);
+
+				if ((uint8_t)run.state == RendererProgramIndex_Quad)
+				{
+					CopyQuads(commands.m_Staging.data() + (size_t)run.first * quadSize, run.count);
+					continue;
+				}
+
+				for (unsigned int j = run.first; j < run.first + run.count; j++)
+				{
+					const auto& command = commands.m_Strings[commands.m_StringOrder[j]];
+					const GlyphRun& glyphs = s_GlyphRunCache.Get(command.text, command.font.get(), command.scale, command.angle);
+
+					s_Stats.strings++;
+					if (commands.m_Culling && IsStringCulled(glyphs, command.position))
+						continue;
+
+					WriteString(glyphs, command.position, command.tint);
+				}
+			}
+
+			FlushScene();
+		}
+	}
+
+	void Renderer::SetSubmissionMode(SubmissionMode mode)
 	{
-		auto it = std::find(s_Framebuffers.begin(), s_Framebuffers.end(), framebuffer);
+		s_SubmissionMode = mode;
+	}
 
-		if (it == s_Framebuffers.end())
-			s_Framebuffers.push_back(framebuffer);
-		else
-			LT_CORE_ERROR("Renderer::AddFramebuffer: cannot add the same framebuffer twice");
+	void Renderer::ShowDebugWindow()
+	{
+		bool cullingEnabled = s_CullingEnabled;
+		if (ImGui::Checkbox("culling", &cullingEnabled))
+			SetCulling(cullingEnabled);
+
+		ImGui::BulletText("quads: %u (%u culled)", s_Stats.quads, s_Stats.culledQuads);
+		ImGui::BulletText("strings: %u (%u culled)", s_Stats.strings, s_Stats.culledStrings);
+
+		ImGui::BulletText("post process: %u effects in %u passes, %u framebuffers", s_PostProcess.GetEffectCount(),
+		                  s_PostProcess.GetPassCount(), s_PostProcess.GetFramebufferCount());
+	}
+
+	bool Renderer::IsOutsideCullBounds(const CameraBounds& bounds, const glm::vec2& center, const glm::vec2& halfExtent)
+	{
+		return center.x + halfExtent.x < bounds.left || center.x - halfExtent.x > bounds.right ||
+		       center.y + halfExtent.y < bounds.top  || center.y - halfExtent.y > bounds.bottom;
+	}
+
+	bool Renderer::IsQuadOutside(const CameraBounds& bounds, const glm::vec3& position, const glm::vec2& size, float angle)
+	{
+		/* locals */
+		glm::vec2 halfExtent = size / 2.0f;
+
+		// bounding box of the rotated quad
+		if (angle != 0.0f)
+		{
+			const float COS = std::abs(std::cos(angle));
+			const float SIN = std::abs(std::sin(angle));
+
+			halfExtent = { COS * halfExtent.x + SIN * halfExtent.y, SIN * halfExtent.x + COS * halfExtent.y };
+		}
+
+		return IsOutsideCullBounds(bounds, position, halfExtent);
+	}
+
+	bool Renderer::IsQuadCulled(const glm::vec3& position, const glm::vec2& size, float angle)
+	{
+		if (!IsQuadOutside(s_CullBounds, position, size, angle))
+			return false;
+
+		s_Stats.culledQuads++;
+		return true;
 	}
 
-	void Renderer::RemoveFramebuffer(std::shared_ptr<Framebuffer> framebuffer)
+	bool Renderer::IsStringCulled(const GlyphRun& run, const glm::vec3& position)
 	{
-		auto it = std::find(s_Framebuffers.begin(), s_Framebuffers.end(), framebuffer);
+		if (!IsOutsideCullBounds(s_CullBounds, glm::vec2(position) + (run.boundsMin + run.boundsMax) / 2.0f, (run.boundsMax - run.boundsMin) / 2.0f))
+			return false;
 
-		if (it != s_Framebuffers.end())
-			s_Framebuffers.erase(it);
+		s_Stats.culledStrings++;
+		return true;
+	}
+
+	void Renderer::ExpandRenderQueue()
+	{
+		LT_PROFILE_FUNC();
+
+		s_RenderQueue.Sort();
+
+		// vertices written in SubmissionMode::Immediate before the queue gets expanded
+		const uint16_t blend = Blender::Get()->IsEnabled() ? 1u << 8 : 0u;
+
+		if (s_QuadRenderer.quadCount)
+			s_DrawRuns.push_back({ (uint16_t)(blend | RendererProgramIndex_Quad), 0u, s_QuadRenderer.quadCount });
+
+		if (s_TextRenderer.quadCount)
+			s_DrawRuns.push_back({ (uint16_t)(blend | RendererProgramIndex_Text), 0u, s_TextRenderer.quadCount });
+
+		// write the sorted commands, a new draw run starts whenever the render state changes
+		for (const auto& entry : s_RenderQueue)
+		{
+			const uint16_t state = RenderQueueKey::GetState(entry.key);
+
+			if (s_DrawRuns.empty() || s_DrawRuns.back().state != state)
+				OpenDrawRun(state);
+
+			if (RenderQueueKey::GetProgram(entry.key) == RendererProgramIndex_Quad)
+			{
+				const QuadCommand& command = s_QuadCommands[entry.index];
+
+				if (s_QuadRenderer.mapCurrent == s_QuadRenderer.mapEnd)
+					FlushAndRemap();
+
+				if (command.angle == 0.0f)
+					WriteQuad(s_QuadRenderer, command.position, command.size, command.texture, command.tint);
+				else
+					WriteQuad(s_QuadRenderer, command.position, command.size, command.angle, command.texture, command.tint);
+			}
+			else
+			{
+				const StringCommand& command = s_StringCommands[entry.index];
+				WriteString(*command.run, command.position, command.tint);
+			}
+		}
+
+		s_RenderQueue.Clear();
+		s_QuadCommands.clear();
+		s_StringCommands.clear();
+	}
+
+	void Renderer::OpenDrawRun(uint16_t state)
+	{
+		CloseDrawRun();
+		s_DrawRuns.push_back({ state, GetProgram((uint8_t)state).quadCount, 0u });
+	}
+
+	void Renderer::CloseDrawRun()
+	{
+		if (!s_DrawRuns.empty())
+		{
+			DrawRun& run = s_DrawRuns.back();
+			run.quadCount = GetProgram((uint8_t)run.state).quadCount - run.firstQuad;
+		}
+	}
+
+	RendererProgram& Renderer::GetProgram(uint8_t program)
+	{
+		if (program == RendererProgramIndex_Quad)
+			return s_QuadRenderer;
 		else
-			LT_CORE_ERROR("Renderer::RemoveFramebuffer: failed to find framebuffer");
+			return s_TextRenderer;
+	}
+
+	void Renderer::DrawProgram(const RendererProgram& program, unsigned int firstQuad, unsigned int quadCount)
+	{
+		// 'firstQuad' is relative to the program's current map
+		if (program.instanced)
+		{
+			RenderCommand::DrawInstanced(6u, quadCount, program.firstVertex + firstQuad);
+			return;
+		}
+
+		while (quadCount)
+		{
+			const unsigned int count = std::min(quadCount, program.indexedQuadCount);
+			RenderCommand::DrawIndexed(count * 6u, 0u, program.firstVertex + firstQuad * 4u);
+
+			firstQuad += count;
+			quadCount -= count;
+		}
+	}
+
+	void Renderer::FlushScene()
+	{
+		s_TextRenderer.UnMap();
+		s_QuadRenderer.UnMap();
+
+		// SubmissionMode::Immediate, quads are drawn before text
+		if (s_DrawRuns.empty())
+		{
+			//=============== QUAD RENDERER ===============//
+			if (s_QuadRenderer.quadCount)
+			{
+				s_QuadRenderer.Bind();
+
+				DrawProgram(s_QuadRenderer, 0u, s_QuadRenderer.quadCount);
+				s_QuadRenderer.quadCount = 0;
+			}
+			//=============== QUAD RENDERER ===============//
+
+			//================== TEXT RENDERER ==================//
+			if (s_TextRenderer.quadCount)
+			{
+				s_TextRenderer.Bind();
+
+				DrawProgram(s_TextRenderer, 0u, s_TextRenderer.quadCount);
+				s_TextRenderer.quadCount = 0;
+			}
+			//================== TEXT RENDERER ==================//
+
+			return;
+		}
+
+		// SubmissionMode::Deferred, draw runs in sorted order
+		CloseDrawRun();
+
+		Blender* blender = Blender::Get();
+		const bool blenderEnabled = blender->IsEnabled();
+
+		uint8_t boundProgram = 0xff;
+		for (const auto& run : s_DrawRuns)
+		{
+			if (!run.quadCount)
+				continue;
+
+			const bool blend = run.state >> 8;
+			if (blend != blender->IsEnabled())
+				blend ? blender->Enable() : blender->Disable();
+
+			RendererProgram& program = GetProgram((uint8_t)run.state);
+			if (boundProgram != (uint8_t)run.state)
+			{
+				program.Bind();
+				boundProgram = (uint8_t)run.state;
+			}
+
+			DrawProgram(program, run.firstQuad, run.quadCount);
+		}
+
+		// restore the blender's state
+		if (blenderEnabled != blender->IsEnabled())
+			blenderEnabled ? blender->Enable() : blender->Disable();
+
+		s_DrawRuns.clear();
+		s_QuadRenderer.quadCount = 0;
+		s_TextRenderer.quadCount = 0;
+	}
+
+	void Renderer::FlushAndRemap()
+	{
+		// keep writing the current draw run after remapping
+		const bool reopen = !s_DrawRuns.empty();
+		const uint16_t state = reopen ? s_DrawRuns.back().state : 0u;
+
+		FlushScene();
+
+		// a program that filled its region needs a larger vertex buffer, this only happens
+		// until the buffer fits a whole frame
+		RendererProgram* programs[] = { &s_QuadRenderer, &s_TextRenderer };
+		for (RendererProgram* program : programs)
+		{
+			if (!program->vertexBuffer->GetAvailableCount())
+			{
+				LT_CORE_INFO("Renderer::FlushAndRemap: growing vertex buffer to {} quads per frame", program->GetQuadCapacity() * 2u);
+				AllocateProgram(*program, program->GetQuadCapacity() * 2u);
+			}
+		}
+
+		s_QuadRenderer.Map();
+		s_TextRenderer.Map();
+
+		if (reopen)
+			OpenDrawRun(state);
 	}
 
 	void Renderer::SetMSAA(bool enabled)
@@ -1,6 +1,11 @@
 #pragma once
 
 #include "Buffers.h"
+#include "CameraController.h"
+#include "GlyphRunCache.h"
+#include "PostProcess.h"
+#include "QuadInstance.h"
+#include "RenderQueue.h"
 #include "Shader.h"
 #include "VertexLayout.h"
 
@@ -8,27 +13,144 @@
 
 #include <glm/glm.hpp>
 
-#define LT_MAX_BASIC_SPRITES    10000
-#define LT_MAX_TEXT_SPRITES     2000
+// quads per frame the vertex streams start with, they grow when a frame needs more
+#define LT_INITIAL_BASIC_SPRITES    10000u
+#define LT_INITIAL_TEXT_SPRITES     2000u
 
 namespace Light {
 
-	class Framebuffer;
 	class MSAA;
 
 	class Font;
 
+	class StaticBatch;
+
 	class Camera;
 
+	class RenderCommandList;
+
 	struct TextureCoordinates;
 
-	struct RendererProgram
+	// Immediate: Draw calls write their vertices right away, quads are drawn before text
+	// Deferred : Draw calls are queued and sorted by layer, depth and render state in EndScene
+	enum class SubmissionMode
+	{
+		Immediate, Deferred,
+	};
+
+	// low byte of a render state, see RenderQueueKey::GetState
+	enum RendererProgramIndex : uint8_t
+	{
+		RendererProgramIndex_Quad = 0,
+		RendererProgramIndex_Text = 1,
+	};
+
+	// counted from BeginFrame, culled primitives are included in the submitted counts
+	struct RendererStats
 	{
-		virtual void Reset() = 0;
-		virtual void Bind() = 0;
-		virtual void Map() = 0;
+		unsigned int quads = 0u;
+		unsigned int culledQuads = 0u;
 
-		virtual inline unsigned int GetMaximumQuadCount() = 0;
+		unsigned int strings = 0u;
+		unsigned int culledStrings = 0u;
+	};
+
+	// quads are written at mapCurrent, in the vertex format of a renderer program
+	// it's a program's mapped vertex buffer, or the staging memory of a RenderCommandList
+	struct QuadStream
+	{
+		// 40 bytes per vertex
+		struct VertexData
+		{
+			glm::vec3 position;
+			glm::vec3 str;
+			glm::vec4 tint;
+		};
+
+		// 20 bytes per vertex, see QuadShaderCompactLayout
+		struct CompactVertexData
+		{
+			uint16_t position[4]; // half-float x, y, z, 1.0
+			uint16_t uv[2];       // unorm16
+			uint8_t slice[4];     // slice index, padding
+			uint8_t tint[4];      // unorm8
+		};
+
+		uint8_t* mapCurrent = nullptr;
+		uint8_t* mapEnd     = nullptr;
+
+		unsigned int quadCount = 0;
+
+		bool compactVertices = false;
+		bool instanced = false;
+
+		// size of a vertex, or of an instance record if instanced
+		inline unsigned int GetVertexSize() const
+		{
+			return instanced ? sizeof(QuadInstance) : compactVertices ? sizeof(CompactVertexData) : sizeof(VertexData);
+		}
+
+		inline unsigned int GetVerticesPerQuad() const { return instanced ? 1u : 4u; }
+
+		inline unsigned int GetQuadSize() const { return GetVertexSize() * GetVerticesPerQuad(); }
+
+		inline unsigned int GetAvailableQuadCount() const { return (unsigned int)(mapEnd - mapCurrent) / GetQuadSize(); }
+	};
+
+	struct RendererProgram : public QuadStream
+	{
+		std::shared_ptr<Shader>             shader;
+		std::shared_ptr<VertexLayout>       vertexLayout;
+		std::shared_ptr<StreamVertexBuffer> vertexBuffer;
+		std::shared_ptr<IndexBuffer>        indexBuffer;
+
+		// kept to recreate the vertex layout when the vertex buffer grows
+		std::vector<std::pair<std::string, VertexElementType>> vertexElements;
+
+		unsigned int firstVertex = 0u; // vertex buffer offset of the current map, in vertices or instances
+
+		unsigned int indexedQuadCount = 0u; // quads covered by the index buffer, larger draws are split
+
+		void Reset()
+		{
+			shader.reset();
+			vertexLayout.reset();
+			vertexBuffer.reset();
+			indexBuffer.reset();
+
+			vertexElements.clear();
+		}
+
+		// maps the rest of the frame's region, written quads are committed on UnMap
+		void Map()
+		{
+			firstVertex = vertexBuffer->GetFirstVertex();
+
+			mapCurrent = (uint8_t*)vertexBuffer->Map();
+			mapEnd = mapCurrent + vertexBuffer->GetAvailableCount() * GetVertexSize();
+		}
+
+		void UnMap()
+		{
+			vertexBuffer->UnMap();
+			vertexBuffer->Commit(quadCount * GetVerticesPerQuad());
+		}
+
+		void Bind()
+		{
+			shader->Bind();
+			vertexLayout->Bind();
+			vertexBuffer->Bind();
+
+			// instanced programs don't use an index buffer
+			if (indexBuffer)
+				indexBuffer->Bind();
+		}
+
+		// quads per frame the vertex buffer can hold
+		inline unsigned int GetQuadCapacity() const { return vertexBuffer->GetRegionCount() / GetVerticesPerQuad(); }
+
+		virtual inline unsigned int GetInitialQuadCount() = 0;
 	};
 		
 	class Renderer
@@ -37,92 +159,14 @@ namespace Light {
 		//=============== QUAD RENDERER ===============//
 		struct QuadRenderer : public RendererProgram
 		{
-			std::shared_ptr<Shader>       shader;
-			std::shared_ptr<VertexLayout> vertexLayout;
-			std::shared_ptr<VertexBuffer> vertexBuffer;
-			std::shared_ptr<IndexBuffer>  indexBuffer;
-
-			struct QuadVertexData
-			{
-				glm::vec3 position;
-				glm::vec3 str;
-				glm::vec4 tint;
-			};
-
-			QuadVertexData* mapCurrent = nullptr;
-			QuadVertexData* mapEnd     = nullptr;
-
-			unsigned int quadCount = 0;
-
-			void Reset() override
-			{
-				shader.reset();
-				vertexLayout.reset();
-				vertexBuffer.reset();
-				indexBuffer.reset();
-			}
-
-			void Map() override
-			{
-				mapCurrent = (QuadVertexData*)vertexBuffer->Map();
-				mapEnd = mapCurrent + LT_MAX_BASIC_SPRITES * 4;
-			}
-
-			void Bind() override
-			{
-				shader->Bind();
-				vertexLayout->Bind();
-				vertexBuffer->Bind();
-				indexBuffer->Bind();
-			}
-
-			inline unsigned int GetMaximumQuadCount() override { return LT_MAX_BASIC_SPRITES; }
+			inline unsigned int GetInitialQuadCount() override { return LT_INITIAL_BASIC_SPRITES; }
 		};
 		//=============== QUAD RENDERER ===============//
 
 		//=============== TEXT RENDERER ===============//
 		struct TextRenderer : public RendererProgram
 		{
-			std::shared_ptr<Shader> shader;
-			std::shared_ptr<VertexLayout> vertexLayout;
-			std::shared_ptr<VertexBuffer> vertexBuffer;
-			std::shared_ptr<IndexBuffer> indexBuffer;
-
-			struct TextVertexData
-			{
-				glm::vec3 position;
-				glm::vec3 str;
-				glm::vec4 tint;
-			};
-
-			TextVertexData* mapCurrent = nullptr;
-			TextVertexData* mapEnd = nullptr;
-
-			unsigned int quadCount = 0;
-
-			void Reset() override
-			{
-				shader.reset();
-				vertexLayout.reset();
-				vertexBuffer.reset();
-				indexBuffer.reset();
-			}
-
-			void Map() override
-			{
-				mapCurrent = (TextVertexData*)vertexBuffer->Map();
-				mapEnd = mapCurrent + LT_MAX_TEXT_SPRITES * 4;
-			}
-			
-			void Bind() override
-			{
-				shader->Bind();
-				vertexLayout->Bind();
-				vertexBuffer->Bind();
-				indexBuffer->Bind();
-			}
-
-			inline unsigned int GetMaximumQuadCount() override { return LT_MAX_TEXT_SPRITES; }
+			inline unsigned int GetInitialQuadCount() override { return LT_INITIAL_TEXT_SPRITES; }
 		};
 		//=============== TEXT RENDERER ===============//
 
@@ -131,13 +175,44 @@ namespace Light {
 		static QuadRenderer s_QuadRenderer;
 		static TextRenderer s_TextRenderer;
 
+		// render queue
+		struct QuadCommand;
+		struct StringCommand;
+
+		struct DrawRun
+		{
+			uint16_t state;
+
+			unsigned int firstQuad;
+			unsigned int quadCount;
+		};
+
+		static RenderQueue s_RenderQueue;
+		static std::vector<QuadCommand> s_QuadCommands;
+		static std::vector<StringCommand> s_StringCommands;
+
+		static std::vector<DrawRun> s_DrawRuns;
+
+		// static batches
+		static std::shared_ptr<Shader> s_StaticBatchShader;
+
+		static SubmissionMode s_SubmissionMode;
+		static uint8_t s_SortLayer;
+
+		// text layout
+		static GlyphRunCache s_GlyphRunCache;
+
 		// camera
 		static std::shared_ptr<ConstantBuffer> s_ViewProjBuffer;
 
-		// framebuffers
-		static std::vector<std::shared_ptr<Framebuffer>> s_Framebuffers;
-		static std::shared_ptr<VertexBuffer> s_FramebufferVertices;
-		static std::shared_ptr<VertexLayout> s_FramebufferLayout;
+		// culling
+		static CameraBounds s_CullBounds;
+		static bool s_CullingEnabled;
+
+		static RendererStats s_Stats;
+
+		// post process
+		static PostProcessGraph s_PostProcess;
 
 		// MSAA
 		static std::shared_ptr<MSAA> s_MSAA;
@@ -151,24 +226,108 @@ namespace Light {
 
 		static void DrawQuad(const glm::vec3& position, const glm::vec2& size, float angle, TextureCoordinates* texture, const glm::vec4& tint = glm::vec4(1.0f));
 
-		// text renderer
+		// each pointer refers to an array of 'count' elements, rotations are calculated with SIMD
+		static void DrawQuads(unsigned int count, const glm::vec3* positions, const glm::vec2* sizes, const float* angles,
+		                      TextureCoordinates* const* textures, const glm::vec4* tints);
+
+		// drawn with a single call right away, before the quads and text of the scene
+		static void DrawStaticBatch(const std::shared_ptr<StaticBatch>& batch);
+
+		// text renderer, text is utf-8
 		static void DrawString(const std::string& text, const std::shared_ptr<Font>& font,
 		                       const glm::vec3& position, float scale = 1.0f, const glm::vec4& tint = glm::vec4(1.0f));
 		
 		static void DrawString(const std::string& text, const std::shared_ptr<Font>& font,
 		                       const glm::vec3& position, float angle, float scale = 1.0f, const glm::vec4& tint = glm::vec4(1.0f));
 
+		// advance width and height (ascent + descent) of the string, laid out through the same cache as DrawString
+		// like the draws, only on the graphics context's thread (see GraphicsContext::IsContextThread)
+		static glm::vec2 MeasureString(const std::string& text, const std::shared_ptr<Font>& font, float scale = 1.0f);
+
 		static void EndScene();
 		static void EndFrame();
 
-		// frame buffers
-		static void AddFramebuffer(std::shared_ptr<Framebuffer> framebuffer);
-		static void RemoveFramebuffer(std::shared_ptr<Framebuffer> framebuffer);
+		// uploads the static batches recorded to a list, on the thread that edits them before the list is submitted
+		static void UploadStaticBatches(const RenderCommandList& commands);
+
+		// draws the scenes of a list recorded since its Reset, call between BeginFrame and EndFrame outside of a scene
+		// static batches are drawn as of their last upload, their sprites aren't read (see UploadStaticBatches)
+		static void Submit(const RenderCommandList& commands);
+
+		// render queue
+		static void SetSubmissionMode(SubmissionMode mode);
+
+		// most significant part of the sort key, only used in SubmissionMode::Deferred
+		static inline void SetSortLayer(uint8_t layer) { s_SortLayer = layer; }
+
+		// culling, primitives entirely outside of the scene's camera bounds are skipped
+		static inline void SetCulling(bool enabled) { s_CullingEnabled = enabled; }
+
+		static inline bool IsCullingEnabled() { return s_CullingEnabled; }
+
+		static inline const RendererStats& GetStats() { return s_Stats; }
+
+		static void ShowDebugWindow();
+
+		// post process, applied in the order they're added
+		static inline void AddPostProcessEffect(const PostProcessEffect& effect) { s_PostProcess.AddEffect(effect); }
+		static inline void RemovePostProcessEffect(StringID name) { s_PostProcess.RemoveEffect(name); }
 	private:
 		friend class GraphicsContext;
-		static void Init(unsigned int MSAASampleCount, bool MSAA);
+		friend class RenderCommandList;
+
+		static void Init(unsigned int MSAASampleCount, bool MSAA, bool compactVertices, bool instancedQuads);
 		static void Terminate();
 
+		// (re)creates the program's vertex buffer, vertex layout and index buffer
+		static void AllocateProgram(RendererProgram& program, unsigned int quadCapacity);
+
+		static void BeginScene(const glm::mat4& view, const glm::mat4& projection, const CameraBounds& bounds);
+
+		// vertex writes, the stream has to have room for the quads
+		static void PushQuad(QuadStream& stream, const glm::vec3& topLeft, const glm::vec3& topRight,
+		                     const glm::vec3& bottomRight, const glm::vec3& bottomLeft,
+		                     const TextureCoordinates& texture, const glm::vec4& tint);
+
+		static void PushInstance(QuadStream& stream, const glm::vec3& center, const glm::vec2& halfSize, float angle,
+		                         const TextureCoordinates& texture, const glm::vec4& tint);
+
+		static void WriteQuad(QuadStream& stream, const glm::vec3& position, const glm::vec2& size, const TextureCoordinates& texture, const glm::vec4& tint);
+		static void WriteQuad(QuadStream& stream, const glm::vec3& position, const glm::vec2& size, float angle, const TextureCoordinates& texture, const glm::vec4& tint);
+
+		static void WriteQuads(QuadStream& stream, unsigned int count, const glm::vec3* positions, const glm::vec2* sizes, const float* angles,
+		                       TextureCoordinates* const* textures, const glm::vec4* tints);
+
+		// draws the sprites uploaded by the batch's last Upload
+		static void DrawUploadedBatch(const std::shared_ptr<StaticBatch>& batch);
+
+		// remaps when the text renderer runs out of room
+		static void WriteString(const GlyphRun& run, const glm::vec3& position, const glm::vec4& tint);
+
+		// quads written to a RenderCommandList's staging memory, remaps when the quad renderer runs out of room
+		static void CopyQuads(const uint8_t* quads, unsigned int count);
+
+		// culling
+		static bool IsOutsideCullBounds(const CameraBounds& bounds, const glm::vec2& center, const glm::vec2& halfExtent);
+
+		static bool IsQuadOutside(const CameraBounds& bounds, const glm::vec3& position, const glm::vec2& size, float angle);
+
+		static bool IsQuadCulled(const glm::vec3& position, const glm::vec2& size, float angle);
+		static bool IsStringCulled(const GlyphRun& run, const glm::vec3& position);
+
+		// render queue
+		static void ExpandRenderQueue();
+
+		static void OpenDrawRun(uint16_t state);
+		static void CloseDrawRun();
+
+		static RendererProgram& GetProgram(uint8_t program);
+
+		static void DrawProgram(const RendererProgram& program, unsigned int firstQuad, unsigned int quadCount);
+
+		static void FlushScene();
+		static void FlushAndRemap();
+
 		static void SetMSAA(bool enabled);
 		static void SetMSAASampleCount(unsigned int sampleCount);
 	};
@@ -2,14 +2,10 @@
 #include "Shader.h"
 
 #include "GraphicsContext.h"
+#include "ShaderCache.h"
 
 #include "Utility/FileManager.h"
 
-#ifdef LIGHT_PLATFORM_WINDOWS
-	#include "Platform/DirectX/dxShader.h"
-#endif
-#include "Platform/Opengl/glShader.h"
-
 namespace Light {
 
 	std::shared_ptr<Light::Shader> Shader::Create(const std::string& vertex, const std::string& fragment)
@@ -31,20 +27,23 @@ namespace Light {
 		switch (GraphicsContext::GetAPI())
 		{
 		case GraphicsAPI::Opengl:
+		case GraphicsAPI::Software: // see swShader
+		case GraphicsAPI::Null:
 			ExtractShaderSource(vertex_source, "GLSL");
 			ExtractShaderSource(fragment_source, "GLSL");
-
-			return std::make_shared<glShader>(vertex_source, fragment_source);
+			break;
 
 		case GraphicsAPI::Directx: LT_DX(
 			ExtractShaderSource(vertex_source, "HLSL");
 			ExtractShaderSource(fragment_source, "HLSL");
-
-			return std::make_shared<dxShader>(vertex_source, fragment_source); )
+			break; )
 
 		default:
 			LT_CORE_ASSERT(false, "Shader::Create: invalid GraphicsAPI");
 		}
+
+		// compiled by ShaderCache's compiler, unless the same program is alive or was saved by a previous run
+		return ShaderCache::GetShader(vertex_source, fragment_source);
 	}
 
 	void Shader::ExtractShaderSource(std::string& src, const std::string& delim)
@@ -0,0 +1,282 @@
+#include "ltpch.h"
+#include "ShaderCache.h"
+
+#include "GraphicsContext.h"
+#include "Shader.h"
+
+#ifdef LIGHT_PLATFORM_WINDOWS
+	#include "Platform/DirectX/dxShader.h"
+#endif
+#include "Platform/Opengl/glShader.h"
+#include "Platform/Null/nullShader.h"
+#include "Platform/Software/swShader.h"
+
+#include <cstring>
+
+namespace Light {
+
+	std::unique_ptr<ShaderCompiler> ShaderCache::s_Compiler;
+	uint64_t ShaderCache::s_DeviceHash = 0u;
+
+	std::string ShaderCache::s_Path;
+	std::unordered_map<uint64_t, ShaderCache::Entry> ShaderCache::s_Entries;
+	bool ShaderCache::s_Dirty = false;
+
+	std::unordered_map<uint64_t, ShaderCache::Program> ShaderCache::s_Programs;
+
+	namespace {
+
+		// FNV-1a
+		constexpr uint64_t HASH_OFFSET = 14695981039346656037ull;
+		constexpr uint64_t HASH_PRIME = 1099511628211ull;
+
+		inline void HashString(uint64_t& hash, const std::string& string)
+		{
+			const uint32_t size = (uint32_t)string.size();
+			for (size_t i = 0; i < sizeof(size); i++)
+				hash = (hash ^ ((const uint8_t*)&size)[i]) * HASH_PRIME;
+
+			for (char c : string)
+				hash = (hash ^ (uint8_t)c) * HASH_PRIME;
+		}
+
+		template<typename T>
+		inline void Write(std::vector<uint8_t>& file, const T& value)
+		{
+			file.insert(file.end(), (const uint8_t*)&value, (const uint8_t*)&value + sizeof(T));
+		}
+
+		template<typename T>
+		inline bool Read(const std::vector<uint8_t>& file, size_t& offset, T& value)
+		{
+			if (file.size() - offset < sizeof(T))
+				return false;
+
+			std::memcpy(&value, file.data() + offset, sizeof(T));
+			offset += sizeof(T);
+			return true;
+		}
+
+		inline void WriteString(std::vector<uint8_t>& file, const std::string& string)
+		{
+			Write(file, (uint32_t)string.size());
+			file.insert(file.end(), string.begin(), string.end());
+		}
+
+		inline bool ReadString(const std::vector<uint8_t>& file, size_t& offset, std::string& string)
+		{
+			uint32_t size;
+			if (!Read(file, offset, size) || file.size() - offset < size)
+				return false;
+
+			string.assign((const char*)file.data() + offset, size);
+			offset += size;
+			return true;
+		}
+
+	}
+
+	std::unique_ptr<ShaderCompiler> ShaderCompiler::Create()
+	{
+		switch (GraphicsContext::GetAPI())
+		{
+		case GraphicsAPI::Opengl:
+			return std::make_unique<glShaderCompiler>();
+		case GraphicsAPI::Directx: LT_DX(
+			return std::make_unique<dxShaderCompiler>();)
+		case GraphicsAPI::Software:
+			return std::make_unique<swShaderCompiler>();
+		case GraphicsAPI::Null:
+			return std::make_unique<nullShaderCompiler>();
+		default:
+			LT_CORE_ASSERT(false, "ShaderCompiler::Create: invalid GraphicsAPI");
+		}
+	}
+
+	void ShaderCache::Init(const std::string& path, std::unique_ptr<ShaderCompiler> compiler /*= nullptr*/)
+	{
+		LT_PROFILE_FUNC();
+
+		s_Compiler = compiler ? std::move(compiler) : ShaderCompiler::Create();
+
+		s_DeviceHash = HASH_OFFSET;
+		HashString(s_DeviceHash, s_Compiler->GetDeviceName());
+
+		s_Path = path;
+		Load();
+	}
+
+	void ShaderCache::Terminate()
+	{
+		LT_PROFILE_FUNC();
+
+		Save();
+
+		s_Entries.clear();
+		s_Programs.clear();
+		s_Path.clear();
+
+		s_Compiler.reset();
+	}
+
+	std::shared_ptr<Shader> ShaderCache::GetShader(const std::string& vertexSource, const std::string& fragmentSource)
+	{
+		LT_PROFILE_FUNC();
+		LT_CORE_ASSERT(s_Compiler, "ShaderCache::GetShader: ShaderCache is not initialized");
+
+		uint64_t key = s_DeviceHash;
+		HashString(key, vertexSource);
+		HashString(key, fragmentSource);
+
+		// shared with the live program built from the same sources
+		Program& program = s_Programs[key];
+		if (std::shared_ptr<Shader> shader = program.shader.lock())
+		{
+			if (program.vertexSource == vertexSource && program.fragmentSource == fragmentSource)
+				return shader;
+
+			// the live program's key collides with this one's, it's compiled without being shared or saved
+			LT_CORE_WARN("ShaderCache::GetShader: program key collides with a live program, compiling it uncached: {}", key);
+
+			std::vector<uint8_t> binary;
+			return s_Compiler->Compile(vertexSource, fragmentSource, binary);
+		}
+
+		std::shared_ptr<Shader> shader;
+
+		// a binary saved for colliding sources is replaced by this program's
+		auto entry = s_Entries.find(key);
+		if (entry != s_Entries.end() && (entry->second.vertexSource != vertexSource || entry->second.fragmentSource != fragmentSource))
+		{
+			s_Entries.erase(entry);
+			entry = s_Entries.end();
+			s_Dirty = true;
+		}
+
+		if (entry != s_Entries.end())
+		{
+			shader = s_Compiler->Load(vertexSource, fragmentSource, entry->second.binary);
+
+			if (shader)
+				entry->second.used = true;
+			else
+			{
+				// ie. the driver was updated
+				LT_CORE_WARN("ShaderCache::GetShader: program binary was rejected, recompiling: {}", key);
+
+				s_Entries.erase(entry);
+				s_Dirty = true;
+			}
+		}
+
+		if (!shader)
+		{
+			std::vector<uint8_t> binary;
+			shader = s_Compiler->Compile(vertexSource, fragmentSource, binary);
+
+			if (!binary.empty())
+			{
+				s_Entries[key] = { s_DeviceHash, vertexSource, fragmentSource, std::move(binary), true };
+				s_Dirty = true;
+			}
+		}
+
+		program = { vertexSource, fragmentSource, shader };
+		return shader;
+	}
+
+	void ShaderCache::Save()
+	{
+		LT_PROFILE_FUNC();
+
+		if (s_Path.empty())
+			return;
+
+		/* locals */
+		std::vector<uint8_t> file;
+		uint32_t count = 0u;
+
+		file.insert(file.end(), { 'L', 'T', 'S', 'C' });
+		Write(file, (uint32_t)LT_SHADER_CACHE_VERSION);
+		Write(file, count);
+
+		// other devices' entries are kept for when their api is used again
+		for (const auto& [key, entry] : s_Entries)
+		{
+			if (entry.device == s_DeviceHash && !entry.used)
+				continue;
+
+			Write(file, key);
+			Write(file, entry.device);
+			WriteString(file, entry.vertexSource);
+			WriteString(file, entry.fragmentSource);
+			Write(file, (uint32_t)entry.binary.size());
+			file.insert(file.end(), entry.binary.begin(), entry.binary.end());
+
+			count++;
+		}
+
+		if (!s_Dirty && count == s_Entries.size())
+			return;
+
+		std::memcpy(file.data() + 8u, &count, sizeof(count));
+
+		std::ofstream stream(s_Path, std::ios::binary | std::ios::trunc);
+		if (!stream.write((const char*)file.data(), file.size()))
+		{
+			LT_CORE_ERROR("ShaderCache::Save: failed to write shader cache: {}", s_Path);
+			return;
+		}
+
+		s_Dirty = false;
+	}
+
+	void ShaderCache::Load()
+	{
+		LT_PROFILE_FUNC();
+
+		s_Entries.clear();
+		s_Dirty = false;
+
+		if (s_Path.empty())
+			return;
+
+		std::ifstream stream(s_Path, std::ios::binary);
+		if (!stream.is_open())
+			return;
+
+		std::vector<uint8_t> file((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+
+		/* locals */
+		size_t offset = 4u;
+		uint32_t version, count;
+
+		if (file.size() < 4u || std::memcmp(file.data(), "LTSC", 4u) || !Read(file, offset, version) || version != LT_SHADER_CACHE_VERSION || !Read(file, offset, count))
+		{
+			LT_CORE_WARN("ShaderCache::Load: shader cache is corrupt or outdated, discarding it: {}", s_Path);
+			return;
+		}
+
+		for (uint32_t i = 0u; i < count; i++)
+		{
+			uint64_t key, device;
+			std::string vertexSource, fragmentSource;
+			uint32_t size;
+
+			if (!Read(file, offset, key) || !Read(file, offset, device) || !ReadString(file, offset, vertexSource) || !ReadString(file, offset, fragmentSource) ||
+			    !Read(file, offset, size) || file.size() - offset < size)
+			{
+				LT_CORE_WARN("ShaderCache::Load: shader cache is truncated, discarding it: {}", s_Path);
+
+				s_Entries.clear();
+				return;
+			}
+
+			s_Entries[key] = { device, std::move(vertexSource), std::move(fragmentSource), std::vector<uint8_t>(file.begin() + offset, file.begin() + offset + size), false };
+			offset += size;
+		}
+
+		LT_CORE_INFO("ShaderCache::Load: loaded {} program binaries: {}", s_Entries.size(), s_Path);
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "Core/Core.h"
+
+#define LT_SHADER_CACHE_VERSION 2u
+
+namespace Light {
+
+	class Shader;
+
+	// builds programs for the graphics api, ShaderCache decides when
+	class ShaderCompiler
+	{
+	public:
+		virtual ~ShaderCompiler() = default;
+
+		static std::unique_ptr<ShaderCompiler> Create();
+
+		// binaries are only handed back to the device they were built by (ie. opengl binaries are driver specific)
+		virtual std::string GetDeviceName() = 0;
+
+		// 'binary' is left empty if the api can't hand the program back
+		virtual std::shared_ptr<Shader> Compile(const std::string& vertexSource, const std::string& fragmentSource, std::vector<uint8_t>& binary) = 0;
+
+		// null if the binary is rejected, the sources are still needed for the vertex elements and sampler slots
+		virtual std::shared_ptr<Shader> Load(const std::string& vertexSource, const std::string& fragmentSource, const std::vector<uint8_t>& binary) = 0;
+	};
+
+	// programs are keyed by a hash of their preprocessed sources:
+	// identical programs are shared while they're alive and the binaries are saved to disk, so the next run skips compiling
+	// the sources are kept next to the programs and binaries and compared on a hit, a colliding key never hands out the wrong program
+	//
+	// layout: magic | version | count | entries of (key, device, vertex size, vertex source, fragment size, fragment source, size, binary)
+	class ShaderCache
+	{
+	private:
+		struct Entry
+		{
+			uint64_t device;
+			std::string vertexSource, fragmentSource;
+			std::vector<uint8_t> binary;
+
+			bool used; // entries of the current device that go unused are dropped on Save
+		};
+
+		struct Program
+		{
+			std::string vertexSource, fragmentSource;
+			std::weak_ptr<Shader> shader;
+		};
+
+		static std::unique_ptr<ShaderCompiler> s_Compiler;
+		static uint64_t s_DeviceHash;
+
+		static std::string s_Path;
+		static std::unordered_map<uint64_t, Entry> s_Entries;
+		static bool s_Dirty;
+
+		static std::unordered_map<uint64_t, Program> s_Programs;
+	public:
+		ShaderCache() = delete;
+
+		// an empty path disables persistence, the compiler is created for the current GraphicsAPI if null
+		static void Init(const std::string& path, std::unique_ptr<ShaderCompiler> compiler = nullptr);
+		static void Terminate();
+
+		static std::shared_ptr<Shader> GetShader(const std::string& vertexSource, const std::string& fragmentSource);
+
+		// writes the binaries if anything changed since they were loaded
+		static void Save();
+	private:
+		static void Load();
+	};
+
+}
\ No newline at end of file
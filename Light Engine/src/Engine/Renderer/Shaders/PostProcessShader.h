@@ -0,0 +1,79 @@
+#pragma once
+
+// full screen triangle pair of PostProcessGraph, sampling effects' pixel shaders take the same inputs:
+//     GLSL: in vec2 VSOutTexCoords;
+//     HLSL: float2 TexCoords : TEXCOORDS
+#define PostProcessShaderSrc_VS \
+R"(
++GLSL
+#version 450 core
+
+layout(location = 0) in vec2 InPosition;
+layout(location = 1) in vec2 InTexCoords;
+
+out vec2 VSOutTexCoords;
+
+void main()
+{
+	gl_Position = vec4(InPosition, 0.0, 1.0);
+	VSOutTexCoords = InTexCoords;
+}
+-GLSL
+
++HLSL
+struct VertexOut
+{
+	float2 TexCoords : TEXCOORDS;
+	float4 Position : SV_Position;
+};
+
+VertexOut main(float2 InPosition : POSITION, float2 InTexCoords : TEXCOORDS)
+{
+	VertexOut vso;
+	vso.Position = float4(InPosition, 0.0, 1.0);
+	vso.TexCoords = InTexCoords;
+	return vso;
+}
+-HLSL)"
+
+// fused pixel shader, the per-pixel effects of a pass are pasted in order between the head and the tail
+// each effect reads and writes 'color', the texel of the pass' input
+#define PostProcessShaderSrc_FS_GLSLHead \
+R"(
++GLSL
+#version 450 core
+
+out vec4 FSOutFragmentColor;
+
+in vec2 VSOutTexCoords;
+
+uniform sampler2D u_Texture; // #BINDING_FRAMEBUFFER0
+
+void main()
+{
+	vec4 color = texture(u_Texture, VSOutTexCoords);
+)"
+
+#define PostProcessShaderSrc_FS_GLSLTail \
+R"(
+	FSOutFragmentColor = color;
+}
+-GLSL
+)"
+
+#define PostProcessShaderSrc_FS_HLSLHead \
+R"(
++HLSL
+SamplerState linearSampler : register(s0);
+Texture2D frameTexture : register(BINDING_FRAMEBUFFER0);
+
+float4 main(float2 TexCoords : TEXCOORDS) : SV_Target
+{
+	float4 color = frameTexture.Sample(linearSampler, float2(TexCoords.x, 1.0 - TexCoords.y));
+)"
+
+#define PostProcessShaderSrc_FS_HLSLTail \
+R"(
+	return color;
+}
+-HLSL)"
\ No newline at end of file
@@ -86,4 +86,157 @@ float4 main(float4 Color : COLOR, float3 TexCoords : TEXCOORDS) : SV_Target
 {
 	return textureArray.Sample(samplerState, TexCoords) * Color;
 }
+-HLSL)"
+
+// compact vertex layout, 20 bytes per vertex: half-float position, unorm16 uv, uint8 slice index, unorm8 tint
+#define QuadShaderCompactLayout \
+{ { "POSITION" , VertexElementType::Half4       }, \
+  { "TEXCOORDS", VertexElementType::UShort2Norm }, \
+  { "SLICE"    , VertexElementType::UByte4      }, \
+  { "COLOR"    , VertexElementType::UByte4Norm  } }
+
+#define QuadShaderSrc_Compact_VS \
+R"(
++GLSL
+#version 450 core
+
+layout(location = 0) in vec4 InPosition;
+layout(location = 1) in vec2 InTexCoords;
+layout(location = 2) in uvec4 InSlice;
+layout(location = 3) in vec4 InColor;
+
+layout(std140, binding = 6) uniform ViewProjectionVSUniform
+{
+	mat4 ViewMatrix;
+	mat4 ProjectionMatrix;
+};
+
+out VS_OUT
+{
+	vec3 TexCoords;
+	vec4 Color;
+} VertexOut;
+
+void main()
+{
+	gl_Position = ProjectionMatrix * ViewMatrix * vec4(InPosition.xyz, 1.0);
+	VertexOut.TexCoords = vec3(InTexCoords, float(InSlice.x));
+	VertexOut.Color = InColor;
+}
+-GLSL
+
++HLSL
+struct VertexOut
+{
+	float4 Color : COLOR;
+	float3 TexCoords : TEXCOORDS;
+	float4 Position : SV_Position;
+};
+
+cbuffer	ViewVSConstant : register(b6)
+{
+	row_major matrix ViewMatrix;
+	row_major matrix ProjectionMatrix;
+}
+
+VertexOut main(float4 InPosition : POSITION, float2 InTexCoords : TEXCOORDS, uint4 InSlice : SLICE, float4 InColor : COLOR)
+{
+	VertexOut vso;
+
+	vso.Position = mul(float4(InPosition.xyz, 1.0), mul(ViewMatrix, ProjectionMatrix));
+
+	vso.TexCoords = float3(InTexCoords, (float)InSlice.x);
+	vso.Color = InColor;
+
+	return vso;
+}
+-HLSL)"
+
+// instanced layout, 40 bytes per quad: center and angle, half size, unorm16 uv rect, uint8 slice index, unorm8 tint
+// see QuadInstance, the vertex shader builds the 6 vertices of the quad from the vertex id
+#define QuadShaderInstancedLayout \
+{ { "CENTER"  , VertexElementType::Float4      }, \
+  { "HALFSIZE", VertexElementType::Float2      }, \
+  { "TEXRECT" , VertexElementType::UShort4Norm }, \
+  { "SLICE"   , VertexElementType::UByte4      }, \
+  { "COLOR"   , VertexElementType::UByte4Norm  } }
+
+#define QuadShaderSrc_Instanced_VS \
+R"(
++GLSL
+#version 450 core
+
+layout(location = 0) in vec4 InCenter; // xyz: center, w: angle
+layout(location = 1) in vec2 InHalfSize;
+layout(location = 2) in vec4 InTexRect; // xMin, yMin, xMax, yMax
+layout(location = 3) in uvec4 InSlice;
+layout(location = 4) in vec4 InColor;
+
+layout(std140, binding = 6) uniform ViewProjectionVSUniform
+{
+	mat4 ViewMatrix;
+	mat4 ProjectionMatrix;
+};
+
+out VS_OUT
+{
+	vec3 TexCoords;
+	vec4 Color;
+} VertexOut;
+
+// TOP_LEFT, TOP_RIGHT, BOTTOM_RIGHT, BOTTOM_RIGHT, BOTTOM_LEFT, TOP_LEFT
+const vec2 corners[6] = vec2[6](vec2(-1.0, -1.0), vec2(1.0, -1.0), vec2(1.0, 1.0), vec2(1.0, 1.0), vec2(-1.0, 1.0), vec2(-1.0, -1.0));
+
+void main()
+{
+	vec2 corner = corners[gl_VertexID];
+
+	float s = sin(InCenter.w);
+	float c = cos(InCenter.w);
+
+	vec2 offset = corner * InHalfSize;
+	offset = vec2(offset.x * c - offset.y * s, offset.x * s + offset.y * c);
+
+	gl_Position = ProjectionMatrix * ViewMatrix * vec4(InCenter.xy + offset, InCenter.z, 1.0);
+	VertexOut.TexCoords = vec3(mix(InTexRect.xy, InTexRect.zw, corner * 0.5 + 0.5), float(InSlice.x));
+	VertexOut.Color = InColor;
+}
+-GLSL
+
++HLSL
+struct VertexOut
+{
+	float4 Color : COLOR;
+	float3 TexCoords : TEXCOORDS;
+	float4 Position : SV_Position;
+};
+
+cbuffer	ViewVSConstant : register(b6)
+{
+	row_major matrix ViewMatrix;
+	row_major matrix ProjectionMatrix;
+}
+
+// TOP_LEFT, TOP_RIGHT, BOTTOM_RIGHT, BOTTOM_RIGHT, BOTTOM_LEFT, TOP_LEFT
+static const float2 corners[6] = { float2(-1.0, -1.0), float2(1.0, -1.0), float2(1.0, 1.0), float2(1.0, 1.0), float2(-1.0, 1.0), float2(-1.0, -1.0) };
+
+VertexOut main(uint VertexID : SV_VertexID, float4 InCenter : CENTER, float2 InHalfSize : HALFSIZE, float4 InTexRect : TEXRECT, uint4 InSlice : SLICE, float4 InColor : COLOR)
+{
+	VertexOut vso;
+
+	float2 corner = corners[VertexID];
+
+	float s, c;
+	sincos(InCenter.w, s, c);
+
+	float2 offset = corner * InHalfSize;
+	offset = float2(offset.x * c - offset.y * s, offset.x * s + offset.y * c);
+
+	vso.Position = mul(float4(InCenter.xy + offset, InCenter.z, 1.0), mul(ViewMatrix, ProjectionMatrix));
+
+	vso.TexCoords = float3(lerp(InTexRect.xy, InTexRect.zw, corner * 0.5 + 0.5), (float)InSlice.x);
+	vso.Color = InColor;
+
+	return vso;
+}
 -HLSL)"
\ No newline at end of file
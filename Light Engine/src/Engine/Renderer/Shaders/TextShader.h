@@ -71,7 +71,15 @@ uniform sampler2DArray u_TextureArray; // #BINDING_FONTGLYPHARRAY0
 
 void main()
 {
-	FSOutFragColor = vec4(FragmentIn.Color.xyz, FragmentIn.Color.a * texture(u_TextureArray, FragmentIn.TexCoords).r);
+	// slices of signed distance field glyphs are offset by 128 (LT_SDF_SLICE_FLAG)
+	bool sdf = FragmentIn.TexCoords.z > 127.5;
+	float value = texture(u_TextureArray, vec3(FragmentIn.TexCoords.xy, sdf ? FragmentIn.TexCoords.z - 128.0 : FragmentIn.TexCoords.z)).r;
+
+	// the outline is at 0.5, smoothed over a screen pixel so the edge stays crisp at any scale
+	float width = fwidth(value);
+	float coverage = sdf ? smoothstep(0.5 - width, 0.5 + width, value) : value;
+
+	FSOutFragColor = vec4(FragmentIn.Color.xyz, FragmentIn.Color.a * coverage);
 }
 -GLSL
 
@@ -81,6 +89,167 @@ Texture2DArray textureArray : register(BINDING_FONTGLYPHARRAY0);
 
 float4 main(float4 Color : COLOR, float3 TexCoords : TEXCOORDS) : SV_Target
 {
-	return float4(Color.rgb, Color.a * textureArray.Sample(samplerState, TexCoords).r);
+	// slices of signed distance field glyphs are offset by 128 (LT_SDF_SLICE_FLAG)
+	bool sdf = TexCoords.z > 127.5;
+	float value = textureArray.Sample(samplerState, float3(TexCoords.xy, sdf ? TexCoords.z - 128.0 : TexCoords.z)).r;
+
+	// the outline is at 0.5, smoothed over a screen pixel so the edge stays crisp at any scale
+	float width = fwidth(value);
+	float coverage = sdf ? smoothstep(0.5 - width, 0.5 + width, value) : value;
+
+	return float4(Color.rgb, Color.a * coverage);
+}
+-HLSL)"
+
+// compact vertex layout, 20 bytes per vertex: half-float position, unorm16 uv, uint8 slice index, unorm8 tint
+#define TextShaderCompactLayout \
+{ { "POSITION" , VertexElementType::Half4       }, \
+  { "TEXCOORDS", VertexElementType::UShort2Norm }, \
+  { "SLICE"    , VertexElementType::UByte4      }, \
+  { "COLOR"    , VertexElementType::UByte4Norm  } }
+
+#define TextShaderSrc_Compact_VS \
+R"(
++GLSL
+#version 450 core
+
+layout(location = 0) in vec4 InPosition;
+layout(location = 1) in vec2 InTexCoords;
+layout(location = 2) in uvec4 InSlice;
+layout(location = 3) in vec4 InColor;
+
+layout(std140, binding = 6) uniform ViewProjectionVSUniform
+{
+	mat4 ViewMatrix;
+	mat4 ProjectionMatrix;
+};
+
+out VS_OUT
+{
+	vec4 Color;
+	vec3 TexCoords;
+} VertexOut;
+
+void main()
+{
+	gl_Position = ProjectionMatrix * ViewMatrix * vec4(InPosition.xyz, 1.0);
+	VertexOut.Color = InColor;
+	VertexOut.TexCoords = vec3(InTexCoords, float(InSlice.x));
+}
+-GLSL
+
++HLSL
+struct VertexOut
+{
+	float4 Color : COLOR;
+	float3 TexCoords : TEXCOORDS;
+	float4 Position : SV_Position;
+};
+
+cbuffer	ViewVSConstant : register(b6)
+{
+	row_major matrix ViewMatrix;
+	row_major matrix ProjectionMatrix;
+}
+
+VertexOut main(float4 InPosition : POSITION, float2 InTexCoords : TEXCOORDS, uint4 InSlice : SLICE, float4 InColor : COLOR)
+{
+	VertexOut vso;
+
+	vso.Position = mul(float4(InPosition.xyz, 1.0), mul(ViewMatrix, ProjectionMatrix));
+
+	vso.Color = InColor;
+	vso.TexCoords = float3(InTexCoords, (float)InSlice.x);
+
+	return vso;
+}
+-HLSL)"
+
+// instanced layout, 40 bytes per quad: center and angle, half size, unorm16 uv rect, uint8 slice index, unorm8 tint
+// see QuadInstance, the vertex shader builds the 6 vertices of the quad from the vertex id
+#define TextShaderInstancedLayout \
+{ { "CENTER"  , VertexElementType::Float4      }, \
+  { "HALFSIZE", VertexElementType::Float2      }, \
+  { "TEXRECT" , VertexElementType::UShort4Norm }, \
+  { "SLICE"   , VertexElementType::UByte4      }, \
+  { "COLOR"   , VertexElementType::UByte4Norm  } }
+
+#define TextShaderSrc_Instanced_VS \
+R"(
++GLSL
+#version 450 core
+
+layout(location = 0) in vec4 InCenter; // xyz: center, w: angle
+layout(location = 1) in vec2 InHalfSize;
+layout(location = 2) in vec4 InTexRect; // xMin, yMin, xMax, yMax
+layout(location = 3) in uvec4 InSlice;
+layout(location = 4) in vec4 InColor;
+
+layout(std140, binding = 6) uniform ViewProjectionVSUniform
+{
+	mat4 ViewMatrix;
+	mat4 ProjectionMatrix;
+};
+
+out VS_OUT
+{
+	vec4 Color;
+	vec3 TexCoords;
+} VertexOut;
+
+// TOP_LEFT, TOP_RIGHT, BOTTOM_RIGHT, BOTTOM_RIGHT, BOTTOM_LEFT, TOP_LEFT
+const vec2 corners[6] = vec2[6](vec2(-1.0, -1.0), vec2(1.0, -1.0), vec2(1.0, 1.0), vec2(1.0, 1.0), vec2(-1.0, 1.0), vec2(-1.0, -1.0));
+
+void main()
+{
+	vec2 corner = corners[gl_VertexID];
+
+	float s = sin(InCenter.w);
+	float c = cos(InCenter.w);
+
+	vec2 offset = corner * InHalfSize;
+	offset = vec2(offset.x * c - offset.y * s, offset.x * s + offset.y * c);
+
+	gl_Position = ProjectionMatrix * ViewMatrix * vec4(InCenter.xy + offset, InCenter.z, 1.0);
+	VertexOut.Color = InColor;
+	VertexOut.TexCoords = vec3(mix(InTexRect.xy, InTexRect.zw, corner * 0.5 + 0.5), float(InSlice.x));
+}
+-GLSL
+
++HLSL
+struct VertexOut
+{
+	float4 Color : COLOR;
+	float3 TexCoords : TEXCOORDS;
+	float4 Position : SV_Position;
+};
+
+cbuffer	ViewVSConstant : register(b6)
+{
+	row_major matrix ViewMatrix;
+	row_major matrix ProjectionMatrix;
+}
+
+// TOP_LEFT, TOP_RIGHT, BOTTOM_RIGHT, BOTTOM_RIGHT, BOTTOM_LEFT, TOP_LEFT
+static const float2 corners[6] = { float2(-1.0, -1.0), float2(1.0, -1.0), float2(1.0, 1.0), float2(1.0, 1.0), float2(-1.0, 1.0), float2(-1.0, -1.0) };
+
+VertexOut main(uint VertexID : SV_VertexID, float4 InCenter : CENTER, float2 InHalfSize : HALFSIZE, float4 InTexRect : TEXRECT, uint4 InSlice : SLICE, float4 InColor : COLOR)
+{
+	VertexOut vso;
+
+	float2 corner = corners[VertexID];
+
+	float s, c;
+	sincos(InCenter.w, s, c);
+
+	float2 offset = corner * InHalfSize;
+	offset = float2(offset.x * c - offset.y * s, offset.x * s + offset.y * c);
+
+	vso.Position = mul(float4(InCenter.xy + offset, InCenter.z, 1.0), mul(ViewMatrix, ProjectionMatrix));
+
+	vso.Color = InColor;
+	vso.TexCoords = float3(lerp(InTexRect.xy, InTexRect.zw, corner * 0.5 + 0.5), (float)InSlice.x);
+
+	return vso;
 }
 -HLSL)"
\ No newline at end of file
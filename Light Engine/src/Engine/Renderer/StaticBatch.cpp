@@ -0,0 +1,157 @@
+#include "ltpch.h"
+#include "StaticBatch.h"
+
+#include "Buffers.h"
+#include "Texture.h"
+#include "VertexLayout.h"
+
+#include "Shaders/QuadShader.h"
+
+namespace Light {
+
+	StaticBatch::StaticBatch(unsigned int reserve)
+	{
+		m_Sprites.reserve(reserve);
+		m_SpriteTextures.reserve(reserve);
+	}
+
+	unsigned int StaticBatch::AddSprite(const glm::vec3& position, const glm::vec2& size, float angle,
+	                                    const std::shared_ptr<Texture>& texture, const TextureCoordinates* uv, const glm::vec4& tint)
+	{
+		m_Sprites.push_back(QuadInstance::Pack(position, size / 2.0f, angle, *uv, tint));
+		m_SpriteTextures.push_back({ GetTextureIndex(texture), uv });
+		MarkDirty(GetSpriteCount() - 1u);
+
+		return GetSpriteCount() - 1u;
+	}
+
+	void StaticBatch::SetSprite(unsigned int index, const glm::vec3& position, const glm::vec2& size, float angle,
+	                            const std::shared_ptr<Texture>& texture, const TextureCoordinates* uv, const glm::vec4& tint)
+	{
+		LT_CORE_ASSERT(index < GetSpriteCount(), "StaticBatch::SetSprite: index out of range: {} >= {}", index, GetSpriteCount());
+
+		m_Sprites[index] = QuadInstance::Pack(position, size / 2.0f, angle, *uv, tint);
+		m_SpriteTextures[index] = { GetTextureIndex(texture), uv };
+		MarkDirty(index);
+	}
+
+	void StaticBatch::Clear()
+	{
+		m_Sprites.clear();
+		m_SpriteTextures.clear();
+
+		m_Textures.clear();
+		m_TextureIndices.clear();
+
+		m_DirtyRanges.clear();
+	}
+
+	void StaticBatch::MarkDirty(unsigned int index)
+	{
+		// extend the last range if the sprite touches it, edits usually come in runs
+		if (!m_DirtyRanges.empty())
+		{
+			auto& range = m_DirtyRanges.back();
+
+			if (index + 1u >= range.first && index <= range.second)
+			{
+				range.first = std::min(range.first, index);
+				range.second = std::max(range.second, index + 1u);
+				return;
+			}
+		}
+
+		m_DirtyRanges.push_back({ index, index + 1u });
+	}
+
+	unsigned int StaticBatch::GetTextureIndex(const std::shared_ptr<Texture>& texture)
+	{
+		auto it = m_TextureIndices.find(texture.get());
+		if (it != m_TextureIndices.end())
+			return it->second;
+
+		m_Textures.push_back({ texture, texture->GetRelocationCount() });
+		m_TextureIndices[texture.get()] = (unsigned int)m_Textures.size() - 1u;
+
+		return (unsigned int)m_Textures.size() - 1u;
+	}
+
+	void StaticBatch::RepackMovedTextures()
+	{
+		/* locals */
+		bool moved = false;
+
+		for (auto& [texture, relocationCount] : m_Textures)
+			moved |= texture->GetRelocationCount() != relocationCount;
+
+		if (!moved)
+			return;
+
+		LT_PROFILE_FUNC();
+
+		for (unsigned int i = 0; i < GetSpriteCount(); i++)
+		{
+			const auto& [texture, relocationCount] = m_Textures[m_SpriteTextures[i].texture];
+
+			if (texture->GetRelocationCount() != relocationCount)
+			{
+				m_Sprites[i].SetTexture(*m_SpriteTextures[i].uv);
+				MarkDirty(i);
+			}
+		}
+
+		for (auto& [texture, relocationCount] : m_Textures)
+			relocationCount = texture->GetRelocationCount();
+	}
+
+	void StaticBatch::Upload(const std::shared_ptr<Shader>& shader)
+	{
+		LT_PROFILE_FUNC();
+
+		RepackMovedTextures();
+
+		m_UploadedCount = GetSpriteCount();
+
+		if (m_DirtyRanges.empty())
+			return;
+
+		// reallocate and upload everything
+		if (GetSpriteCount() > m_Capacity)
+		{
+			m_Capacity = std::max(GetSpriteCount(), m_Capacity * 2u);
+
+			m_VertexBuffer = VertexBuffer::Create(nullptr, sizeof(QuadInstance), m_Capacity, BufferUsage::Static);
+			m_VertexLayout = VertexLayout::Create(shader, m_VertexBuffer, QuadShaderInstancedLayout, VertexInputRate::PerInstance);
+
+			m_VertexBuffer->Update(m_Sprites.data(), 0u, GetSpriteCount() * sizeof(QuadInstance));
+			m_DirtyRanges.clear();
+
+			return;
+		}
+
+		// merge overlapping and adjacent ranges
+		std::sort(m_DirtyRanges.begin(), m_DirtyRanges.end());
+
+		std::pair<unsigned int, unsigned int> merged = m_DirtyRanges.front();
+		for (const auto& range : m_DirtyRanges)
+		{
+			if (range.first <= merged.second)
+				merged.second = std::max(merged.second, range.second);
+			else
+			{
+				m_VertexBuffer->Update(&m_Sprites[merged.first], merged.first * sizeof(QuadInstance), (merged.second - merged.first) * sizeof(QuadInstance));
+				merged = range;
+			}
+		}
+
+		m_VertexBuffer->Update(&m_Sprites[merged.first], merged.first * sizeof(QuadInstance), (merged.second - merged.first) * sizeof(QuadInstance));
+		m_DirtyRanges.clear();
+	}
+
+	void StaticBatch::Bind()
+	{
+		m_VertexLayout->Bind();
+		m_VertexBuffer->Bind();
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "QuadInstance.h"
+
+#include "Core/Core.h"
+
+#include <glm/glm.hpp>
+
+#include <unordered_map>
+
+namespace Light {
+
+	class Shader;
+	class VertexBuffer;
+	class VertexLayout;
+
+	class Texture;
+	struct TextureCoordinates;
+
+	// retained sprites with their own vertex buffer, drawn with Renderer::DrawStaticBatch
+	// or recorded to a RenderCommandList, which draws what Renderer::UploadStaticBatches uploaded
+	// only the ranges of sprites that were added or changed since the last draw are uploaded
+	// sprites keep their textures alive and are repacked when TextureArray::Defragment moves them
+	class StaticBatch
+	{
+	private:
+		// where a sprite's coordinates are read from again once its texture moves
+		struct SpriteTexture
+		{
+			unsigned int texture;
+			const TextureCoordinates* uv;
+		};
+
+		std::vector<QuadInstance> m_Sprites;
+		std::vector<SpriteTexture> m_SpriteTextures;
+
+		// the textures of the sprites, with their relocation count when the sprites were packed
+		std::vector<std::pair<std::shared_ptr<Texture>, unsigned int>> m_Textures;
+		std::unordered_map<const Texture*, unsigned int> m_TextureIndices;
+
+		std::shared_ptr<VertexBuffer> m_VertexBuffer;
+		std::shared_ptr<VertexLayout> m_VertexLayout;
+		unsigned int m_Capacity = 0u;
+
+		// sprites in the vertex buffer as of the last Upload, the only state read when a submitted list draws the batch
+		unsigned int m_UploadedCount = 0u;
+
+		// [first, last) sprite ranges waiting to be uploaded
+		std::vector<std::pair<unsigned int, unsigned int>> m_DirtyRanges;
+	public:
+		StaticBatch(unsigned int reserve = 0u);
+
+		// 'uv' points into the texture's coordinates (GetTextureUV or GetSubTextureUV), they're updated in place when it moves
+		// returns the sprite's index for SetSprite
+		unsigned int AddSprite(const glm::vec3& position, const glm::vec2& size, float angle,
+		                       const std::shared_ptr<Texture>& texture, const TextureCoordinates* uv, const glm::vec4& tint = glm::vec4(1.0f));
+
+		void SetSprite(unsigned int index, const glm::vec3& position, const glm::vec2& size, float angle,
+		               const std::shared_ptr<Texture>& texture, const TextureCoordinates* uv, const glm::vec4& tint = glm::vec4(1.0f));
+
+		void Clear();
+
+		// getters
+		inline unsigned int GetSpriteCount() const { return (unsigned int)m_Sprites.size(); }
+
+		inline const QuadInstance& GetSprite(unsigned int index) const { return m_Sprites[index]; }
+	private:
+		friend class Renderer;
+
+		void MarkDirty(unsigned int index);
+
+		unsigned int GetTextureIndex(const std::shared_ptr<Texture>& texture);
+
+		// repacks the sprites of the textures moved since they were packed
+		void RepackMovedTextures();
+
+		// uploads the dirty ranges, the buffer is reallocated if sprites were added past its capacity
+		void Upload(const std::shared_ptr<Shader>& shader);
+
+		void Bind();
+
+		inline unsigned int GetUploadedCount() const { return m_UploadedCount; }
+	};
+
+}
\ No newline at end of file
@@ -2,23 +2,53 @@
 #include "Texture.h"
 
 #include "GraphicsContext.h"
+#include "TextureCache.h"
+
+#include "Utility/ImageUtility.h"
+#include "Utility/JobSystem.h"
 
 #ifdef LIGHT_PLATFORM_WINDOWS
 	#include "Platform/DirectX/dxTexture.h"
 #endif
 #include "Platform/Opengl/glTexture.h"
+#include "Platform/Null/nullTexture.h"
+#include "Platform/Software/swTexture.h"
 
 namespace Light {
 	
 	Texture::Texture(const std::string& atlasPath, const TextureCoordinates& texture, const TextureCoordinates& slice)
-		: m_OccupiedSpace(texture), m_TextureUV(texture)
+		: Texture(texture, slice, LoadAtlas(atlasPath, texture, slice))
 	{
-		LT_PROFILE_FUNC();
+	}
 
+	Texture::Texture(const TextureCoordinates& texture, const TextureCoordinates& slice)
+		: m_OccupiedSpace(texture), m_TextureUV(texture), m_Pinned(false)
+	{
 		m_TextureUV.xMin *= 1.0f / slice.xMax;
 		m_TextureUV.xMax *= 1.0f / slice.xMax;
 		m_TextureUV.yMin *= 1.0f / slice.yMax;
 		m_TextureUV.yMax *= 1.0f / slice.yMax;
+	}
+
+	Texture::Texture(const TextureCoordinates& texture, const TextureCoordinates& slice, const std::unordered_map<std::string, TextureCoordinates>& subTextures)
+		: Texture(texture, slice)
+	{
+		m_SubTextures.reserve(subTextures.size());
+
+		for (const auto& [name, uv] : subTextures)
+		{
+			const bool inserted = m_SubTextureIndices.emplace(StringID(name), (unsigned int)m_SubTextures.size()).second;
+			LT_CORE_ASSERT(inserted, "Texture::Texture: sub texture name's hash collides with another one: {}", name);
+
+			m_SubTextures.push_back(uv);
+		}
+	}
+
+	std::unordered_map<std::string, TextureCoordinates> Texture::LoadAtlas(const std::string& atlasPath, const TextureCoordinates& texture, const TextureCoordinates& slice)
+	{
+		LT_PROFILE_FUNC();
+
+		std::unordered_map<std::string, TextureCoordinates> subTextures;
 
 		std::string atlas = FileManager::LoadTextFile(atlasPath);
 
@@ -28,8 +58,8 @@ namespace Light {
 		float xRatio = (texture.xMax - texture.xMin) / slice.xMax;
 		float yRatio = (texture.yMax - texture.yMin) / slice.yMax;
 
-		float xOffset = texture.xMin * xRatio;
-		float yOffset = texture.yMin * yRatio;
+		float xOffset = texture.xMin / slice.xMax;
+		float yOffset = texture.yMin / slice.yMax;
 
 		// note: I'm using (CodeAndWeb)TexturePacker with a custom exporter
 		while (std::getline(stream, line))
@@ -46,26 +76,53 @@ namespace Light {
 			std::getline(lineStream, temp, ' '); xMax = std::stof(temp); xMax += xMin;
 			std::getline(lineStream, temp, ' '); yMax = std::stof(temp); yMax += yMin;
 
-			m_SubTextures[name] = { xMin * xRatio + xOffset,
-			                        yMin * yRatio + yOffset,
-			                        xMax * xRatio + xOffset,
-			                        yMax * yRatio + yOffset,
-			                        texture.sliceIndex };
+			subTextures[name] = { xMin * xRatio + xOffset,
+			                      yMin * yRatio + yOffset,
+			                      xMax * xRatio + xOffset,
+			                      yMax * yRatio + yOffset,
+			                      texture.sliceIndex };
 		}
+
+		return subTextures;
 	}
 
-	Texture::Texture(const TextureCoordinates& texture, const TextureCoordinates& slice)
-		: m_OccupiedSpace(texture), m_TextureUV(texture)
+	void Texture::Relocate(const TextureCoordinates& texture, const TextureCoordinates& slice)
 	{
+		const float xDelta = (texture.xMin - m_OccupiedSpace.xMin) / slice.xMax;
+		const float yDelta = (texture.yMin - m_OccupiedSpace.yMin) / slice.yMax;
+
+		for (auto& uv : m_SubTextures)
+		{
+			uv.xMin += xDelta;
+			uv.xMax += xDelta;
+			uv.yMin += yDelta;
+			uv.yMax += yDelta;
+			uv.sliceIndex = texture.sliceIndex;
+		}
+
+		m_OccupiedSpace = texture;
+		m_TextureUV = texture;
+
 		m_TextureUV.xMin *= 1.0f / slice.xMax;
 		m_TextureUV.xMax *= 1.0f / slice.xMax;
 		m_TextureUV.yMin *= 1.0f / slice.yMax;
 		m_TextureUV.yMax *= 1.0f / slice.yMax;
+
+		m_RelocationCount++;
+	}
+
+	unsigned int Texture::GetSubTextureIndex(StringID name) const
+	{
+		auto it = m_SubTextureIndices.find(name);
+		LT_CORE_ASSERT(it != m_SubTextureIndices.end(), "Texture::GetSubTextureIndex: failed to find sub texture with hash: {}", name.hash);
+
+		return it->second;
 	}
 
 	TextureArray::TextureArray(unsigned int width, unsigned int height, unsigned int depth, unsigned int channels)
-		: m_Width(width), m_Height(height), m_Depth(depth), m_Channels(channels)
+		: m_Width(width), m_Height(height), m_Depth(depth), m_Channels(channels), m_MipLevels(GetMipLevelCount(width, height)), m_Fragmented(false)
 	{
+		m_Packers.resize(depth, RectanglePacker(width, height));
 	}
 
 	std::shared_ptr<Light::TextureArray> TextureArray::Create(unsigned int width, unsigned int height, unsigned int depth, unsigned int channels /*= 4*/)
@@ -78,6 +135,10 @@ namespace Light {
 			return std::make_shared<glTextureArray>(width, height, depth, channels);
 		case GraphicsAPI::Directx: LT_DX(
 			return std::make_shared<dxTextureArray>(width, height, depth, channels);)
+		case GraphicsAPI::Software:
+			return std::make_shared<swTextureArray>(width, height, depth, channels);
+		case GraphicsAPI::Null:
+			return std::make_shared<nullTextureArray>(width, height, depth, channels);
 		default:
 			LT_CORE_ASSERT(false, "TextureArray::Create: invalid GraphicsAPI");
 		}
@@ -86,13 +147,17 @@ namespace Light {
 	void TextureArray::LoadTextureAtlas(const std::string& name, const std::string& texturePath, const std::string& atlasPath)
 	{
 		LT_PROFILE_FUNC();
-		m_UnresolvedTextures.push_back({ name, atlasPath, FileManager::LoadTextureFile(texturePath) });
+		m_UnresolvedTextures.push_back({ name, texturePath, atlasPath, TextureFileData(),
+		                                 m_CachePath.empty() ? JobSystem::Submit([texturePath]() { return FileManager::LoadTextureFile(texturePath); })
+		                                                     : std::future<TextureFileData>() });
 	}
 
 	void TextureArray::LoadTexture(const std::string& name, const std::string& texturePath)
 	{
 		LT_PROFILE_FUNC();
-		m_UnresolvedTextures.push_back( { name, "", FileManager::LoadTextureFile(texturePath)} );
+		m_UnresolvedTextures.push_back({ name, texturePath, "", TextureFileData(),
+		                                 m_CachePath.empty() ? JobSystem::Submit([texturePath]() { return FileManager::LoadTextureFile(texturePath); })
+		                                                     : std::future<TextureFileData>() });
 	}
 
 	void TextureArray::AllocateTexture(const std::string& name, unsigned width, unsigned int height)
@@ -100,73 +165,341 @@ namespace Light {
 		LT_PROFILE_FUNC();
 		LT_CORE_ASSERT(std::max(width, height) <= LT_MAX_TEXTURE_DIMENSIONS,
 		               "TextureArray::AllocateTexture: dimensions too large for texture: {}, {} > {}", name, std::max(width, height), LT_MAX_TEXTURE_DIMENSIONS);
-		m_UnresolvedTextures.push_back({ name, "", TextureFileData(nullptr, width, height, m_Channels) });
+		m_UnresolvedTextures.push_back({ name, "", "", TextureFileData(nullptr, width, height, m_Channels), {} });
+	}
+
+	void TextureArray::SetCachePath(const std::string& path)
+	{
+		m_CachePath = path;
 	}
 
 	void TextureArray::ResolveTextures()
 	{
 		LT_PROFILE_FUNC();
-		std::sort(m_UnresolvedTextures.begin(), m_UnresolvedTextures.end(), std::greater());
+
+		if (!m_CachePath.empty() && ResolveFromCache())
+			return;
+
+		// only the outstanding decodes are waited on, the rest finished in the background
+		for (auto& data : m_UnresolvedTextures)
+			if (data.decoding.valid())
+				data.texture = data.decoding.get();
+			else if (!data.texture.pixels && !data.texturePath.empty())
+				data.texture = FileManager::LoadTextureFile(data.texturePath);
+
+		std::stable_sort(m_UnresolvedTextures.begin(), m_UnresolvedTextures.end(), std::greater());
 
 		for (auto& data : m_UnresolvedTextures)
 		{
-			bool found = false;
+			/* locals */
 			auto& t = data.texture;
-		
-			for (uint16_t z = 0; z < m_Depth && !found; z++)
+			glm::uvec2 position;
+
+			// first slice with enough space left
+			uint16_t z = 0;
+			while (z < m_Depth && !m_Packers[z].Insert(t.width, t.height, position))
+				z++;
+
+			LT_CORE_ASSERT(z < m_Depth, "TextureArray::ResolveTextures: could not find a valid space for texture");
+
+			const TextureCoordinates uv(position.x, position.y, position.x + t.width, position.y + t.height, z);
+			m_OccupiedSpace.push_back(uv);
+
+			// mipped straight from the decoded pixels, they're freed right after
+			if (t.pixels)
 			{
-				found = false;
-				for (uint16_t y = 0; y < m_Height - t.height && !found; y++)
-				{
-					for (uint16_t x = 0; x <= m_Width - t.width; x++)
-					{
-						const TextureCoordinates uv(x, y, x + t.width, y + t.height, z);
-		
-						bool valid = true;
-						for (const auto& subt : m_OccupiedSpace)
-							if(subt.Intersects(uv))
-								{ valid = false; break; }
-		
-						if (valid)
-						{
-							found = true;
-							m_OccupiedSpace.push_back(uv);
-		
-							if (t.pixels)
-							{
-								UpdateSubTexture(uv, t.pixels);
-								t.Free();
-							}
-		
-							if (!data.atlasPath.empty())
-								m_Textures[data.name] = std::make_shared<Texture>(data.atlasPath, uv,
-									                                              TextureCoordinates(0, 0, m_Width, m_Height, z));
-							else
-								m_Textures[data.name] = std::make_shared<Texture>(uv, TextureCoordinates(0, 0, m_Width, m_Height, z));
-		
-							break;
-						}
-					}
-				}
+				const ImageRegion region = { position.x, position.y, (unsigned int)t.width, (unsigned int)t.height };
+
+				UploadRegion(z, 0u, region, t.pixels);
+				GenerateRegionMips(z, region, t.pixels);
+				t.Free();
 			}
-		
-			LT_CORE_ASSERT(found, "TextureArray::ResolveTextures: could not find a valid space for texture");
-			found = false;
+
+			if (!data.atlasPath.empty())
+				AddTexture(data.name, std::make_shared<Texture>(data.atlasPath, uv, TextureCoordinates(0, 0, m_Width, m_Height, z)));
+			else
+				AddTexture(data.name, std::make_shared<Texture>(uv, TextureCoordinates(0, 0, m_Width, m_Height, z)), data.texturePath.empty());
 		}
 		
 		m_UnresolvedTextures.clear();
-		GenerateMips();
 	}
 
-	void TextureArray::DeleteTexture(const std::string& name)
+	bool TextureArray::ResolveFromCache()
 	{
-		LT_CORE_ASSERT(m_Textures.find(name) != m_Textures.end(), "TextureArray::DeleteTexture: failed to find texture: {}", name);
+		LT_PROFILE_FUNC();
+
+		// the cache holds the whole array, it can't be merged into one that already has textures
+		if (m_UnresolvedTextures.empty() || !m_OccupiedSpace.empty())
+			return false;
 
-		auto it = std::find(m_OccupiedSpace.begin(), m_OccupiedSpace.end(), *m_Textures[name]->GetOccupiedSpace());
-		LT_CORE_ASSERT(it != m_OccupiedSpace.end(), "TextureArray::DeleteTexture: occupied space of '{}' doesn't match any of TextureArray's", name);
+		std::vector<TextureSource> sources;
+		sources.reserve(m_UnresolvedTextures.size());
+
+		for (const auto& data : m_UnresolvedTextures)
+		{
+			// allocated textures have nothing to bake
+			if (data.texturePath.empty())
+				return false;
+
+			sources.push_back({ data.name, data.texturePath, data.atlasPath });
+		}
+
+		const uint64_t hash = TextureCache::Hash(sources, m_Width, m_Height, m_Depth, m_Channels);
+		auto cache = std::make_unique<TextureCache>(m_CachePath, hash);
+
+		if (!cache->IsValid())
+		{
+			LT_CORE_INFO("TextureArray::ResolveFromCache: texture cache is missing or stale, rebaking: {}", m_CachePath);
+			cache.reset(); // the old file can't be rewritten while it's mapped
+
+			if (!TextureCache::Bake(sources, m_Width, m_Height, m_Depth, m_Channels, m_CachePath))
+				return false;
+
+			cache = std::make_unique<TextureCache>(m_CachePath, hash);
+			if (!cache->IsValid())
+				return false;
+		}
+
+		// decodes submitted before the cache path was set
+		for (auto& data : m_UnresolvedTextures)
+			if (data.decoding.valid())
+				data.decoding.get().Free();
+
+		for (unsigned int z = 0u; z < cache->GetUsedSlices(); z++)
+			for (unsigned int level = 0u; level < m_MipLevels; level++)
+				UpdateMip(z, level, cache->GetPixels(z, level));
+
+		for (const auto& entry : cache->GetEntries())
+		{
+			const TextureCoordinates& uv = entry.occupiedSpace;
+
+			m_OccupiedSpace.push_back(uv);
+			m_Packers[(unsigned int)uv.sliceIndex].Reserve({ (unsigned int)uv.xMin, (unsigned int)uv.yMin,
+			                                                (unsigned int)uv.GetWidth(), (unsigned int)uv.GetHeight() });
+
+			AddTexture(entry.name, std::make_shared<Texture>(uv, TextureCoordinates(0, 0, m_Width, m_Height, uv.sliceIndex), entry.subTextures));
+		}
+
+		m_UnresolvedTextures.clear();
+		return true;
+	}
+
+	void TextureArray::DeleteTexture(StringID name)
+	{
+		auto handle = m_TextureHandles.find(name);
+		LT_CORE_ASSERT(handle != m_TextureHandles.end(), "TextureArray::DeleteTexture: failed to find texture with hash: {}", name.hash);
+
+		std::shared_ptr<Texture> texture = m_Textures.Get(handle->second);
+
+		auto it = std::find(m_OccupiedSpace.begin(), m_OccupiedSpace.end(), *texture->GetOccupiedSpace());
+		LT_CORE_ASSERT(it != m_OccupiedSpace.end(), "TextureArray::DeleteTexture: occupied space of texture with hash {} doesn't match any of TextureArray's", name.hash);
 		
+		const unsigned int slice = it->sliceIndex;
 		m_OccupiedSpace.erase(it);
-		m_Textures.erase(name);
+
+		// freed space merges with the free space around it
+		RebuildPacker(slice);
+		m_Fragmented = true;
+
+		// outstanding handles go stale
+		m_Textures.Remove(handle->second);
+		m_TextureHandles.erase(handle);
+	}
+
+	TextureHandle TextureArray::GetTextureHandle(StringID name) const
+	{
+		auto it = m_TextureHandles.find(name);
+		return it != m_TextureHandles.end() ? it->second : TextureHandle();
+	}
+
+	std::shared_ptr<Texture> TextureArray::GetTexture(StringID name) const
+	{
+		auto it = m_TextureHandles.find(name);
+		if (it == m_TextureHandles.end())
+		{
+			LT_CORE_ERROR("TextureArray::GetTexture: failed to find texture with hash: {}", name.hash);
+			return nullptr;
+		}
+
+		return m_Textures.Get(it->second);
+	}
+
+	void TextureArray::Defragment(uint64_t texelBudget /*= LT_DEFRAGMENT_TEXELS_PER_FRAME*/)
+	{
+		if (!m_Fragmented)
+			return;
+
+		LT_PROFILE_FUNC();
+
+		// sparsest slices are evacuated first
+		std::vector<unsigned int> slices;
+		for (unsigned int z = 0u; z < m_Depth; z++)
+			if (m_Packers[z].GetOccupancy() > 0.0f)
+				slices.push_back(z);
+
+		std::sort(slices.begin(), slices.end(), [this](unsigned int a, unsigned int b) { return m_Packers[a].GetOccupancy() < m_Packers[b].GetOccupancy(); });
+
+		/* locals */
+		uint64_t movedTexels = 0u;
+		bool moved = false;
+
+		for (unsigned int source : slices)
+		{
+			const float sourceOccupancy = m_Packers[source].GetOccupancy();
+			if (sourceOccupancy >= LT_DEFRAGMENT_OCCUPANCY)
+				break;
+
+			// largest first, they're the hardest to fit
+			std::vector<std::shared_ptr<Texture>> textures;
+			for (const auto& [name, handle] : m_TextureHandles)
+			{
+				std::shared_ptr<Texture>& texture = m_Textures.Get(handle);
+				if (texture->GetSliceIndex() == source && !texture->IsPinned() && texture->GetWidth() && texture->GetHeight())
+					textures.push_back(texture);
+			}
+
+			std::sort(textures.begin(), textures.end(), [](const std::shared_ptr<Texture>& a, const std::shared_ptr<Texture>& b)
+			{
+				return (uint64_t)a->GetWidth() * a->GetHeight() > (uint64_t)b->GetWidth() * b->GetHeight();
+			});
+
+			for (auto& texture : textures)
+			{
+				if (movedTexels && movedTexels + (uint64_t)texture->GetWidth() * texture->GetHeight() > texelBudget)
+					break;
+
+				// only into fuller slices, so textures never move back and forth
+				glm::uvec2 position;
+				unsigned int destination = 0u;
+
+				for (; destination < m_Depth; destination++)
+					if (destination != source && m_Packers[destination].GetOccupancy() > sourceOccupancy &&
+					    m_Packers[destination].Insert(texture->GetWidth(), texture->GetHeight(), position))
+						break;
+
+				if (destination == m_Depth)
+					continue;
+
+				const TextureCoordinates from = *texture->GetOccupiedSpace();
+				const TextureCoordinates to(position.x, position.y, position.x + texture->GetWidth(), position.y + texture->GetHeight(), destination);
+
+				CopySubTexture(from, position.x, position.y, destination);
+
+				*std::find(m_OccupiedSpace.begin(), m_OccupiedSpace.end(), from) = to;
+				texture->Relocate(to, TextureCoordinates(0, 0, m_Width, m_Height, destination));
+
+				movedTexels += (uint64_t)texture->GetWidth() * texture->GetHeight();
+				moved = true;
+			}
+
+			if (moved)
+			{
+				RebuildPacker(source);
+				break;
+			}
+		}
+
+		if (!moved)
+			m_Fragmented = false;
+	}
+
+	void TextureArray::UpdateSubTexture(unsigned int xoffset, unsigned int yoffset, unsigned int zoffset, unsigned int width, unsigned int height, const void* pixels)
+	{
+		LT_PROFILE_FUNC();
+
+		if (!width || !height)
+			return;
+
+		const ImageRegion region = { xoffset, yoffset, width, height };
+		UploadRegion(zoffset, 0u, region, pixels);
+
+		const uint8_t* bytes = (const uint8_t*)pixels;
+		m_DirtyRegions.push_back({ region, zoffset, std::vector<uint8_t>(bytes, bytes + (size_t)width * height * m_Channels) });
+	}
+
+	void TextureArray::UpdateSubTexture(const TextureCoordinates& uv, const void* pixels)
+	{
+		UpdateSubTexture(uv.xMin, uv.yMin, uv.sliceIndex, uv.GetWidth(), uv.GetHeight(), pixels);
+	}
+
+	void TextureArray::CopySubTexture(const TextureCoordinates& source, unsigned int x, unsigned int y, unsigned int slice)
+	{
+		LT_PROFILE_FUNC();
+
+		const unsigned int sourceX = source.xMin, sourceY = source.yMin;
+		const unsigned int width = source.GetWidth(), height = source.GetHeight();
+
+		for (unsigned int level = 0u; level < m_MipLevels; level++)
+		{
+			// texels of the level the region covers, at both ends, the smaller of the two is copied
+			// so that a region that isn't aligned the same way doesn't spill into its new neighbours
+			const unsigned int sourceWidth = ((sourceX + width - 1u) >> level) - (sourceX >> level) + 1u;
+			const unsigned int sourceHeight = ((sourceY + height - 1u) >> level) - (sourceY >> level) + 1u;
+
+			const unsigned int destinationWidth = ((x + width - 1u) >> level) - (x >> level) + 1u;
+			const unsigned int destinationHeight = ((y + height - 1u) >> level) - (y >> level) + 1u;
+
+			CopyRegion(source.sliceIndex, slice, level, { sourceX >> level, sourceY >> level, std::min(sourceWidth, destinationWidth), std::min(sourceHeight, destinationHeight) },
+			           x >> level, y >> level);
+		}
+	}
+
+	void TextureArray::UpdateMip(unsigned int slice, unsigned int level, const void* pixels)
+	{
+		UploadRegion(slice, level, { 0u, 0u, GetMipSize(m_Width, level), GetMipSize(m_Height, level) }, pixels);
+	}
+
+	void TextureArray::GenerateMips()
+	{
+		if (m_DirtyRegions.empty())
+			return;
+
+		LT_PROFILE_FUNC();
+
+		for (const auto& dirty : m_DirtyRegions)
+			GenerateRegionMips(dirty.slice, dirty.region, dirty.pixels.data());
+
+		m_DirtyRegions.clear();
+	}
+
+	void TextureArray::GenerateRegionMips(unsigned int slice, const ImageRegion& region, const uint8_t* pixels)
+	{
+		/* locals */
+		ImageRegion sourceRegion = region;
+		const uint8_t* source = pixels;
+
+		for (unsigned int level = 1u; level < m_MipLevels; level++)
+		{
+			const ImageRegion mipRegion = GetMipRegion(sourceRegion, GetMipSize(m_Width, level), GetMipSize(m_Height, level));
+
+			std::vector<uint8_t>& destination = m_MipScratch[level & 1u];
+			destination.resize((size_t)mipRegion.width * mipRegion.height * m_Channels);
+
+			DownsampleRegion(source, sourceRegion, m_Channels, destination.data(), mipRegion);
+			UploadRegion(slice, level, mipRegion, destination.data());
+
+			sourceRegion = mipRegion;
+			source = destination.data();
+		}
+	}
+
+	void TextureArray::RebuildPacker(unsigned int slice)
+	{
+		m_Packers[slice].Reset();
+
+		for (const auto& uv : m_OccupiedSpace)
+			if ((unsigned int)uv.sliceIndex == slice)
+				m_Packers[slice].Reserve({ (unsigned int)uv.xMin, (unsigned int)uv.yMin, (unsigned int)uv.GetWidth(), (unsigned int)uv.GetHeight() });
+	}
+
+	void TextureArray::AddTexture(const std::string& name, std::shared_ptr<Texture> texture, bool pinned /*= false*/)
+	{
+		texture->m_Pinned = pinned;
+
+		auto [it, inserted] = m_TextureHandles.emplace(StringID(name), TextureHandle());
+		LT_CORE_ASSERT(inserted, "TextureArray::AddTexture: name is already in use or its hash collides with another one: {}", name);
+
+		it->second = m_Textures.Insert(std::move(texture));
 	}
 	
-}	
\ No newline at end of file
+}
\ No newline at end of file
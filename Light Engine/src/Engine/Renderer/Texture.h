@@ -3,11 +3,22 @@
 #include "Core/Core.h"
 
 #include "Utility/FileManager.h"
+#include "Utility/ImageUtility.h"
+#include "Utility/RectanglePacker.h"
+#include "Utility/SlotMap.h"
+#include "Utility/StringID.h"
 
+#include <future>
 #include <unordered_map>
 
 #include <glm/glm.hpp>
 
+// texels moved by TextureArray::Defragment per frame, at least one texture is moved regardless
+#define LT_DEFRAGMENT_TEXELS_PER_FRAME (512u * 512u)
+
+// slices less occupied than this are evacuated into fuller ones
+#define LT_DEFRAGMENT_OCCUPANCY 0.5f
+
 namespace Light {
 
 	struct TextureCoordinates
@@ -43,42 +54,97 @@ namespace Light {
 		}
 	};
 
+	class Texture;
+	using TextureHandle = Handle<Texture>;
+
 	class Texture
 	{
 	protected:
-		std::unordered_map<std::string, TextureCoordinates> m_SubTextures;
+		std::vector<TextureCoordinates> m_SubTextures;
+		std::unordered_map<StringID, unsigned int> m_SubTextureIndices;
+
 		TextureCoordinates m_OccupiedSpace;
 		TextureCoordinates m_TextureUV;
+
+		// written to after being resolved (ie. glyph pages), can't be moved by the defragmenter
+		bool m_Pinned;
+
+		// incremented by Relocate, copies of the coordinates (ie. StaticBatch's) are stale once it changes
+		unsigned int m_RelocationCount = 0u;
 	public:
 		Texture(const std::string& atlasPath, const TextureCoordinates& texture, const TextureCoordinates& slice);
 		Texture(const TextureCoordinates& texture, const TextureCoordinates& slice);
+		Texture(const TextureCoordinates& texture, const TextureCoordinates& slice, const std::unordered_map<std::string, TextureCoordinates>& subTextures);
+
+		// sub texture coordinates of an atlas file placed at 'texture'
+		static std::unordered_map<std::string, TextureCoordinates> LoadAtlas(const std::string& atlasPath, const TextureCoordinates& texture, const TextureCoordinates& slice);
+
+		// look the index up once, the coordinates are then a plain array access
+		unsigned int GetSubTextureIndex(StringID name) const;
+
+		inline TextureCoordinates* GetSubTextureUV(unsigned int index) { return &m_SubTextures[index]; }
+		inline TextureCoordinates* GetSubTextureUV(StringID name) { return &m_SubTextures[GetSubTextureIndex(name)]; }
 
-		inline TextureCoordinates* GetSubTextureUV(const std::string& name) { return &m_SubTextures[name]; }
 		inline TextureCoordinates* GetTextureUV() { return &m_TextureUV; }
 		inline TextureCoordinates* GetOccupiedSpace() { return &m_OccupiedSpace; }
 
 		inline unsigned int GetWidth() const { return m_OccupiedSpace.xMax - m_OccupiedSpace.xMin; }
 		inline unsigned int GetHeight() const { return m_OccupiedSpace.yMax - m_OccupiedSpace.yMin; }
 		inline unsigned int GetSliceIndex() const { return m_OccupiedSpace.sliceIndex; }
+
+		inline bool IsPinned() const { return m_Pinned; }
+
+		inline unsigned int GetRelocationCount() const { return m_RelocationCount; }
+	private:
+		friend class TextureArray;
+
+		// moves the texture and its sub textures to a new place, pointers to the coordinates stay valid
+		void Relocate(const TextureCoordinates& texture, const TextureCoordinates& slice);
 	};
 
 	class TextureArray
 	{
 	protected:
-		std::unordered_map<std::string, std::shared_ptr<Texture>> m_Textures;
-		unsigned int m_Width, m_Height, m_Depth, m_Channels;
+		SlotMap<std::shared_ptr<Texture>, Texture> m_Textures;
+		std::unordered_map<StringID, TextureHandle> m_TextureHandles;
+		unsigned int m_Width, m_Height, m_Depth, m_Channels, m_MipLevels;
+
+		// baked layout and mips, see TextureCache
+		std::string m_CachePath;
 
 		struct UnresolvedTextureData {
 			std::string name;
+			std::string texturePath;
 			std::string atlasPath;
 			TextureFileData texture;
 
+			// decoding on the job system, moved into texture by ResolveTextures
+			std::future<TextureFileData> decoding;
+
 			bool operator>(const UnresolvedTextureData& other) const { // to be used by std::sort
 				return texture > other.texture;
 			}
 		};
 		std::vector<UnresolvedTextureData> m_UnresolvedTextures;
 		std::vector<TextureCoordinates> m_OccupiedSpace;
+
+		// free space of every slice
+		std::vector<RectanglePacker> m_Packers;
+
+		// set by DeleteTexture, cleared once Defragment has nothing left to move
+		bool m_Fragmented;
+
+		// regions written to mip 0 since the last GenerateMips, with a copy of their pixels
+		struct DirtyRegion
+		{
+			ImageRegion region;
+			unsigned int slice;
+			std::vector<uint8_t> pixels;
+		};
+		std::vector<DirtyRegion> m_DirtyRegions;
+
+		// ping-ponged between mip levels
+		std::vector<uint8_t> m_MipScratch[2];
 	public:
 		TextureArray(unsigned int width, unsigned int height, unsigned int depth, unsigned int channels);
 		virtual ~TextureArray() = default;
@@ -89,24 +155,60 @@ namespace Light {
 		void LoadTexture(const std::string& name, const std::string& texturePath);
 		void AllocateTexture(const std::string& name, unsigned width, unsigned int height);
 
+		// decodes are deferred to ResolveTextures, which loads the cache or rebakes it if it's stale
+		// only used when every texture of the array is loaded from a file and resolved at once
+		void SetCachePath(const std::string& path);
+
 		void ResolveTextures();
 
-		void DeleteTexture(const std::string& name);
+		void DeleteTexture(StringID name);
+
+		// evacuates sparse slices into fuller ones a few textures at a time, call once per frame
+		// moved textures are copied on the gpu and their coordinates are updated in place
+		void Defragment(uint64_t texelBudget = LT_DEFRAGMENT_TEXELS_PER_FRAME);
+
+		// writes to mip 0, the region's mips are rebuilt by the next GenerateMips
+		void UpdateSubTexture(unsigned int xoffset, unsigned int yoffset, unsigned int zoffset, unsigned int width, unsigned int height, const void* pixels);
+		void UpdateSubTexture(const TextureCoordinates& uv, const void* pixels);
 
-		virtual void UpdateSubTexture(unsigned int xoffset, unsigned int yoffset, unsigned int zoffset, unsigned int width, unsigned int height, void* pixels) = 0;
-		virtual void UpdateSubTexture(const TextureCoordinates& uv, void* pixels) = 0;
+		// copies a region and its mips to another slice
+		void CopySubTexture(const TextureCoordinates& source, unsigned int x, unsigned int y, unsigned int slice);
 
-		virtual void GenerateMips() = 0;
+		// replaces a whole mip level of a slice
+		void UpdateMip(unsigned int slice, unsigned int level, const void* pixels);
+
+		// rebuilds the mips of the regions written to since the last call, the rest of the array isn't touched
+		void GenerateMips();
 
 		virtual void Bind(unsigned int slot = 0) = 0;
 			
 		// getters
-		inline std::shared_ptr<Texture> GetTexture(const std::string& name) { return m_Textures[name]; }
+		// null if there's no texture with the name
+		TextureHandle GetTextureHandle(StringID name) const;
+
+		std::shared_ptr<Texture> GetTexture(StringID name) const;
+		inline std::shared_ptr<Texture> GetTexture(TextureHandle handle) const { return m_Textures.Get(handle); }
 
 		inline const glm::vec2& GetSize() const { return { m_Width, m_Height }; }
 
 		inline unsigned int GetWidth() const { return m_Width; }
 		inline unsigned int GetHeight() const { return m_Height; }
+	protected:
+		// tightly packed pixels of a region of a mip level
+		virtual void UploadRegion(unsigned int slice, unsigned int level, const ImageRegion& region, const void* pixels) = 0;
+
+		// a region of a mip level to (x, y) of the same level of another slice
+		virtual void CopyRegion(unsigned int sourceSlice, unsigned int slice, unsigned int level, const ImageRegion& source, unsigned int x, unsigned int y) = 0;
+	private:
+		bool ResolveFromCache();
+
+		// downsamples a region of mip 0 through every level, on the cpu
+		void GenerateRegionMips(unsigned int slice, const ImageRegion& region, const uint8_t* pixels);
+
+		void AddTexture(const std::string& name, std::shared_ptr<Texture> texture, bool pinned = false);
+
+		// recomputes the free space of a slice from the textures left in it
+		void RebuildPacker(unsigned int slice);
 	};
 
 }
\ No newline at end of file
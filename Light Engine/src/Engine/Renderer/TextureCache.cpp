@@ -0,0 +1,406 @@
+#include "ltpch.h"
+#include "TextureCache.h"
+
+#include "Utility/ImageUtility.h"
+#include "Utility/JobSystem.h"
+
+#include <cstring>
+
+namespace Light {
+
+	namespace {
+
+		// FNV-1a
+		constexpr uint64_t HASH_OFFSET = 14695981039346656037ull;
+		constexpr uint64_t HASH_PRIME = 1099511628211ull;
+
+		inline void HashBytes(uint64_t& hash, const void* data, size_t size)
+		{
+			const uint8_t* bytes = (const uint8_t*)data;
+			for (size_t i = 0; i < size; i++)
+				hash = (hash ^ bytes[i]) * HASH_PRIME;
+		}
+
+		inline void HashString(uint64_t& hash, const std::string& string)
+		{
+			const uint32_t size = (uint32_t)string.size();
+			HashBytes(hash, &size, sizeof(size));
+			HashBytes(hash, string.data(), string.size());
+		}
+
+		void HashFile(uint64_t& hash, const std::string& path)
+		{
+			std::ifstream stream(path, std::ios::binary);
+			if (!stream.is_open())
+			{
+				// a missing source still changes the hash, the bake reports it
+				HashString(hash, "missing");
+				return;
+			}
+
+			char buffer[16384];
+			while (stream.read(buffer, sizeof(buffer)) || stream.gcount())
+				HashBytes(hash, buffer, (size_t)stream.gcount());
+		}
+
+		inline void WriteString(std::vector<uint8_t>& table, const std::string& string)
+		{
+			const uint32_t size = (uint32_t)string.size();
+			table.insert(table.end(), (const uint8_t*)&size, (const uint8_t*)&size + sizeof(size));
+			table.insert(table.end(), string.begin(), string.end());
+		}
+
+		inline void WriteCoordinates(std::vector<uint8_t>& table, const TextureCoordinates& uv)
+		{
+			const float values[5] = { uv.xMin, uv.yMin, uv.xMax, uv.yMax, uv.sliceIndex };
+			table.insert(table.end(), (const uint8_t*)values, (const uint8_t*)values + sizeof(values));
+		}
+
+		// reads the table written by Bake, fails instead of reading past the end
+		class TableReader
+		{
+		private:
+			const uint8_t* m_Cursor;
+			const uint8_t* m_End;
+		public:
+			TableReader(const uint8_t* data, size_t size) : m_Cursor(data), m_End(data + size) {}
+
+			bool Read(void* destination, size_t size)
+			{
+				if ((size_t)(m_End - m_Cursor) < size)
+					return false;
+
+				std::memcpy(destination, m_Cursor, size);
+				m_Cursor += size;
+				return true;
+			}
+
+			bool ReadString(std::string& string)
+			{
+				uint32_t size;
+				if (!Read(&size, sizeof(size)) || (size_t)(m_End - m_Cursor) < size)
+					return false;
+
+				string.assign((const char*)m_Cursor, size);
+				m_Cursor += size;
+				return true;
+			}
+
+			bool ReadCoordinates(TextureCoordinates& uv)
+			{
+				float values[5];
+				if (!Read(values, sizeof(values)))
+					return false;
+
+				uv = TextureCoordinates(values[0], values[1], values[2], values[3], values[4]);
+				return true;
+			}
+		};
+
+	}
+
+	TextureCache::TextureCache(const std::string& path, uint64_t expectedHash)
+		: m_File(path), m_Header(nullptr), m_SliceSize(0u)
+	{
+		LT_PROFILE_FUNC();
+
+		if (m_File.IsOpen() && !ReadTable(expectedHash))
+		{
+			m_Header = nullptr;
+			m_Entries.clear();
+		}
+	}
+
+	uint64_t TextureCache::Hash(const std::vector<TextureSource>& sources, unsigned int width, unsigned int height, unsigned int depth, unsigned int channels)
+	{
+		LT_PROFILE_FUNC();
+
+		uint64_t hash = HASH_OFFSET;
+
+		const uint32_t parameters[5] = { LT_TEXTURE_CACHE_VERSION, width, height, depth, channels };
+		HashBytes(hash, parameters, sizeof(parameters));
+
+		for (const auto& source : sources)
+		{
+			HashString(hash, source.name);
+			HashString(hash, source.texturePath);
+			HashString(hash, source.atlasPath);
+
+			HashFile(hash, source.texturePath);
+			if (!source.atlasPath.empty())
+				HashFile(hash, source.atlasPath);
+		}
+
+		return hash;
+	}
+
+	bool TextureCache::Bake(const std::vector<TextureSource>& sources, unsigned int width, unsigned int height, unsigned int depth, unsigned int channels, const std::string& path)
+	{
+		LT_PROFILE_FUNC();
+
+		struct BakedTexture
+		{
+			const TextureSource* source;
+			TextureFileData data;
+			TextureCoordinates occupiedSpace;
+		};
+
+		/* locals */
+		std::vector<std::future<TextureFileData>> decodes;
+		std::vector<BakedTexture> textures;
+		bool succeeded = true;
+
+		decodes.reserve(sources.size());
+		for (const auto& source : sources)
+			decodes.push_back(JobSystem::Submit([path = source.texturePath]() { return FileManager::LoadTextureFile(path); }));
+
+		textures.reserve(sources.size());
+		for (unsigned int i = 0; i < sources.size(); i++)
+		{
+			textures.push_back({ &sources[i], decodes[i].get(), {} });
+			succeeded &= (bool)textures.back().data;
+		}
+
+		auto freeTextures = [&textures]()
+		{
+			for (auto& texture : textures)
+				texture.data.Free();
+		};
+
+		if (!succeeded)
+		{
+			LT_CORE_ERROR("TextureCache::Bake: failed to decode one or more sources of: {}", path);
+			freeTextures();
+			return false;
+		}
+
+		// same order and placement as TextureArray::ResolveTextures
+		std::stable_sort(textures.begin(), textures.end(), [](const BakedTexture& a, const BakedTexture& b) { return a.data > b.data; });
+
+		std::vector<RectanglePacker> packers(depth, RectanglePacker(width, height));
+		unsigned int usedSlices = 0u;
+
+		for (auto& texture : textures)
+		{
+			/* locals */
+			const auto& t = texture.data;
+			glm::uvec2 position;
+
+			unsigned int z = 0u;
+			while (z < depth && !packers[z].Insert(t.width, t.height, position))
+				z++;
+
+			if (z == depth)
+			{
+				LT_CORE_ERROR("TextureCache::Bake: could not find a valid space for texture: {}", texture.source->name);
+				freeTextures();
+				return false;
+			}
+
+			texture.occupiedSpace = TextureCoordinates(position.x, position.y, position.x + t.width, position.y + t.height, z);
+			usedSlices = std::max(usedSlices, z + 1u);
+		}
+
+		// table
+		std::vector<uint8_t> table;
+		for (const auto& texture : textures)
+		{
+			WriteString(table, texture.source->name);
+			WriteCoordinates(table, texture.occupiedSpace);
+
+			std::unordered_map<std::string, TextureCoordinates> subTextures;
+			if (!texture.source->atlasPath.empty())
+				subTextures = Texture::LoadAtlas(texture.source->atlasPath, texture.occupiedSpace,
+				                                 TextureCoordinates(0, 0, width, height, texture.occupiedSpace.sliceIndex));
+
+			const uint32_t subTextureCount = (uint32_t)subTextures.size();
+			table.insert(table.end(), (const uint8_t*)&subTextureCount, (const uint8_t*)&subTextureCount + sizeof(subTextureCount));
+
+			for (const auto& [name, uv] : subTextures)
+			{
+				WriteString(table, name);
+				WriteCoordinates(table, uv);
+			}
+		}
+
+		// header
+		Header header;
+		std::memcpy(header.magic, "LTTC", 4u);
+		header.version = LT_TEXTURE_CACHE_VERSION;
+		header.hash = Hash(sources, width, height, depth, channels);
+		header.width = width;
+		header.height = height;
+		header.depth = depth;
+		header.channels = channels;
+		header.mipLevels = GetMipLevelCount(width, height);
+		header.usedSlices = usedSlices;
+		header.textureCount = (uint32_t)textures.size();
+		header.tableSize = (uint32_t)table.size();
+
+		// pixels start on a page boundary
+		header.pixelsOffset = (sizeof(Header) + table.size() + 4095u) & ~4095ull;
+
+		std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+		if (!stream.is_open())
+		{
+			LT_CORE_ERROR("TextureCache::Bake: failed to open file for writing: {}", path);
+			freeTextures();
+			return false;
+		}
+
+		stream.write((const char*)&header, sizeof(Header));
+		stream.write((const char*)table.data(), table.size());
+
+		const std::vector<char> padding(header.pixelsOffset - sizeof(Header) - table.size(), 0);
+		stream.write(padding.data(), padding.size());
+
+		// pixels, one slice at a time
+		std::vector<uint8_t> level((size_t)width * height * channels);
+		std::vector<uint8_t> nextLevel(level.size());
+
+		for (unsigned int z = 0u; z < usedSlices; z++)
+		{
+			std::fill(level.begin(), level.end(), 0u);
+
+			for (const auto& texture : textures)
+			{
+				if (texture.occupiedSpace.sliceIndex != z)
+					continue;
+
+				const auto& t = texture.data;
+				const size_t rowSize = (size_t)t.width * channels;
+
+				for (int y = 0; y < t.height; y++)
+					std::memcpy(level.data() + (((size_t)texture.occupiedSpace.yMin + y) * width + (size_t)texture.occupiedSpace.xMin) * channels,
+					            t.pixels + y * rowSize, rowSize);
+			}
+
+			for (unsigned int mip = 0u; mip < header.mipLevels; mip++)
+			{
+				const unsigned int mipWidth = GetMipSize(width, mip);
+				const unsigned int mipHeight = GetMipSize(height, mip);
+
+				stream.write((const char*)level.data(), (size_t)mipWidth * mipHeight * channels);
+
+				if (mip + 1u < header.mipLevels)
+				{
+					DownsampleBox(level.data(), mipWidth, mipHeight, channels, nextLevel.data());
+					level.swap(nextLevel);
+				}
+			}
+		}
+
+		freeTextures();
+
+		if (!stream)
+		{
+			LT_CORE_ERROR("TextureCache::Bake: failed to write file: {}", path);
+			return false;
+		}
+
+		LT_CORE_INFO("TextureCache::Bake: baked {} textures into {} slices: {}", textures.size(), usedSlices, path);
+		return true;
+	}
+
+	std::vector<TextureSource> TextureCache::LoadManifest(const std::string& path)
+	{
+		LT_PROFILE_FUNC();
+
+		std::vector<TextureSource> sources;
+
+		std::stringstream stream(FileManager::LoadTextFile(path));
+		std::string line;
+
+		while (std::getline(stream, line))
+		{
+			std::istringstream lineStream(line);
+			std::string type;
+
+			if (!(lineStream >> type) || type[0] == '#')
+				continue;
+
+			TextureSource source;
+			lineStream >> source.name >> source.texturePath;
+
+			if (type == "atlas")
+				lineStream >> source.atlasPath;
+			else if (type != "texture")
+			{
+				LT_CORE_WARN("TextureCache::LoadManifest: unknown entry type '{}' in: {}", type, path);
+				continue;
+			}
+
+			if (source.texturePath.empty() || (type == "atlas" && source.atlasPath.empty()))
+			{
+				LT_CORE_WARN("TextureCache::LoadManifest: incomplete entry '{}' in: {}", line, path);
+				continue;
+			}
+
+			sources.push_back(std::move(source));
+		}
+
+		return sources;
+	}
+
+	const uint8_t* TextureCache::GetPixels(unsigned int slice, unsigned int level) const
+	{
+		LT_CORE_ASSERT(slice < m_Header->usedSlices && level < m_Header->mipLevels,
+		               "TextureCache::GetPixels: out of range: slice {}, level {}", slice, level);
+
+		return m_File.GetData() + m_Header->pixelsOffset + slice * m_SliceSize + m_MipOffsets[level];
+	}
+
+	bool TextureCache::ReadTable(uint64_t expectedHash)
+	{
+		if (m_File.GetSize() < sizeof(Header))
+			return false;
+
+		m_Header = (const Header*)m_File.GetData();
+
+		if (std::memcmp(m_Header->magic, "LTTC", 4u) || m_Header->version != LT_TEXTURE_CACHE_VERSION || m_Header->hash != expectedHash)
+			return false;
+
+		if (m_Header->mipLevels != GetMipLevelCount(m_Header->width, m_Header->height) || m_Header->usedSlices > m_Header->depth ||
+		    m_Header->pixelsOffset < sizeof(Header) + m_Header->tableSize)
+			return false;
+
+		// every entry takes at least a name size, its coordinates and a sub texture count
+		if (m_Header->textureCount > m_Header->tableSize / (2u * sizeof(uint32_t) + 5u * sizeof(float)))
+			return false;
+
+		m_MipOffsets.resize(m_Header->mipLevels);
+		for (unsigned int mip = 0u; mip < m_Header->mipLevels; mip++)
+		{
+			m_MipOffsets[mip] = m_SliceSize;
+			m_SliceSize += (uint64_t)GetMipSize(m_Header->width, mip) * GetMipSize(m_Header->height, mip) * m_Header->channels;
+		}
+
+		if (m_File.GetSize() < m_Header->pixelsOffset + m_Header->usedSlices * m_SliceSize)
+			return false;
+
+		TableReader reader(m_File.GetData() + sizeof(Header), m_Header->tableSize);
+
+		m_Entries.resize(m_Header->textureCount);
+		for (auto& entry : m_Entries)
+		{
+			uint32_t subTextureCount;
+			if (!reader.ReadString(entry.name) || !reader.ReadCoordinates(entry.occupiedSpace) || !reader.Read(&subTextureCount, sizeof(subTextureCount)))
+				return false;
+
+			for (unsigned int i = 0; i < subTextureCount; i++)
+			{
+				/* locals */
+				std::string name;
+				TextureCoordinates uv;
+
+				if (!reader.ReadString(name) || !reader.ReadCoordinates(uv))
+					return false;
+
+				entry.subTextures[name] = uv;
+			}
+		}
+
+		return true;
+	}
+
+}
\ No newline at end of file
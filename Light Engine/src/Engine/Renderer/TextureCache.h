@@ -0,0 +1,79 @@
+#pragma once
+
+#include "Core/Core.h"
+
+#include "Texture.h"
+
+#include "Utility/MappedFile.h"
+
+#define LT_TEXTURE_CACHE_VERSION 2u
+
+namespace Light {
+
+	struct TextureSource
+	{
+		std::string name;
+		std::string texturePath;
+		std::string atlasPath; // empty for plain textures
+	};
+
+	struct TextureCacheEntry
+	{
+		std::string name;
+		TextureCoordinates occupiedSpace;
+		std::unordered_map<std::string, TextureCoordinates> subTextures;
+	};
+
+	// resolved texture array baked to disk: the packed layout, the atlas tables and every mip of every used slice
+	// the file is memory mapped and the pixels are handed to the graphics api straight from the mapping
+	//
+	// layout: header | table | padding | pixels (slice major, mip 0 first)
+	class TextureCache
+	{
+	private:
+		struct Header
+		{
+			char magic[4];
+			uint32_t version;
+			uint64_t hash;
+
+			uint32_t width, height, depth, channels;
+			uint32_t mipLevels, usedSlices;
+
+			uint32_t textureCount, tableSize;
+			uint64_t pixelsOffset;
+		};
+
+		MappedFile m_File;
+		const Header* m_Header;
+
+		std::vector<TextureCacheEntry> m_Entries;
+		std::vector<uint64_t> m_MipOffsets;
+		uint64_t m_SliceSize;
+	public:
+		// the cache is invalid if the file is missing, corrupt or was baked from different sources
+		TextureCache(const std::string& path, uint64_t expectedHash);
+
+		// hashes the contents of the source files along with the array's dimensions
+		static uint64_t Hash(const std::vector<TextureSource>& sources, unsigned int width, unsigned int height, unsigned int depth, unsigned int channels);
+
+		// decodes, packs and mips the sources the same way TextureArray::ResolveTextures does
+		static bool Bake(const std::vector<TextureSource>& sources, unsigned int width, unsigned int height, unsigned int depth, unsigned int channels, const std::string& path);
+
+		// lines of 'texture <name> <path>' or 'atlas <name> <path> <atlasPath>', '#' starts a comment
+		static std::vector<TextureSource> LoadManifest(const std::string& path);
+
+		const uint8_t* GetPixels(unsigned int slice, unsigned int level) const;
+
+		// getters
+		inline const std::vector<TextureCacheEntry>& GetEntries() const { return m_Entries; }
+
+		inline unsigned int GetUsedSlices() const { return m_Header->usedSlices; }
+		inline unsigned int GetMipLevels() const { return m_Header->mipLevels; }
+
+		inline bool IsValid() const { return m_Header; }
+	private:
+		bool ReadTable(uint64_t expectedHash);
+	};
+
+}
\ No newline at end of file
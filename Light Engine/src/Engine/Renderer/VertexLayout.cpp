@@ -7,11 +7,14 @@
 	#include "Platform/DirectX/dxVertexLayout.h"
 #endif
 #include "Platform/Opengl/glVertexLayout.h"
+#include "Platform/Null/nullVertexLayout.h"
+#include "Platform/Software/swVertexLayout.h"
 
 namespace Light {
 
 	std::shared_ptr<VertexLayout> VertexLayout::Create(std::shared_ptr<Shader> shader, std::shared_ptr<VertexBuffer> buffer,
-	                                                   const std::vector<std::pair<std::string, VertexElementType>>& elements)
+	                                                   const std::vector<std::pair<std::string, VertexElementType>>& elements,
+	                                                   VertexInputRate inputRate)
 	{
 		LT_PROFILE_FUNC();
 
@@ -19,11 +22,18 @@ namespace Light {
 		{
 		case GraphicsAPI::Opengl:
 			LT_CORE_ASSERT(buffer, "VertexLayout::Create: VertexBuffer cannot be null with opengl graphics api");
-			return std::make_shared<glVertexLayout>(buffer, elements);
+			return std::make_shared<glVertexLayout>(buffer, elements, inputRate);
 
 		case GraphicsAPI::Directx: LT_DX(
 			// LT_CORE_ASSERT(shader, "VertexLayout::Create: Shader cannot be null with directx graphics api");
-			return std::make_shared<dxVertexLayout>(shader, elements); )
+			return std::make_shared<dxVertexLayout>(shader, elements, inputRate); )
+
+		case GraphicsAPI::Software:
+			LT_CORE_ASSERT(buffer, "VertexLayout::Create: VertexBuffer cannot be null with software graphics api");
+			return std::make_shared<swVertexLayout>(buffer, elements, inputRate);
+
+		case GraphicsAPI::Null:
+			return std::make_shared<nullVertexLayout>();
 
 		default:
 			LT_CORE_ASSERT(false, "VertexLayout::Create: invalid GraphicsAPI");
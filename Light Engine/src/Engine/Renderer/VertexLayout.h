@@ -12,7 +12,18 @@ namespace Light {
 		Int,    Int2,    Int3,    Int4,
 		UInt,   UInt2,   UInt3,   UInt4,
 		Float,  Float2,  Float3,  Float4,
-		Double, Double2, Double3, Double4
+		Double, Double2, Double3, Double4,
+
+		// compact types, 'Norm' types are read as floats in [0, 1]
+		Half2, Half4,
+		UShort2Norm, UShort4Norm,
+		UByte4, UByte4Norm,
+	};
+
+	// PerInstance: the buffer advances once per instance instead of once per vertex
+	enum class VertexInputRate
+	{
+		PerVertex, PerInstance,
 	};
 
 	class VertexLayout
@@ -21,7 +32,8 @@ namespace Light {
 		virtual ~VertexLayout() = default;
 
 		static std::shared_ptr<VertexLayout> Create(std::shared_ptr<Shader> shader, std::shared_ptr<VertexBuffer> buffer,
-		                                            const std::vector<std::pair<std::string, VertexElementType>>& elements);
+		                                            const std::vector<std::pair<std::string, VertexElementType>>& elements,
+		                                            VertexInputRate inputRate = VertexInputRate::PerVertex);
 
 		virtual void Bind() = 0;
 	};
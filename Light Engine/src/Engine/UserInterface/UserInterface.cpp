@@ -7,6 +7,8 @@
 	#include "Platform/DirectX/dxUserInterface.h"
 #endif
 #include "Platform/Opengl/glUserInterface.h"
+#include "Platform/Null/nullUserInterface.h"
+#include "Platform/Software/swUserInterface.h"
 
 #include <imgui.h>
 #include <imgui_impl_glfw.h>
@@ -30,6 +32,14 @@ namespace Light {
 			break;
 		)
 
+		case GraphicsAPI::Software:
+			s_Context = std::make_unique<swUserInterface>();
+			break;
+
+		case GraphicsAPI::Null:
+			s_Context = std::make_unique<nullUserInterface>();
+			break;
+
 		default:
 			LT_CORE_ASSERT(false, "UserInterface::Init: invalid GraphicsAPI");
 		}
@@ -41,6 +51,17 @@ namespace Light {
 		s_Context.reset();
 	}
 
+	void UserInterface::End()
+	{
+		Draw(Render());
+	}
+
+	ImDrawData* UserInterface::Render()
+	{
+		ImGui::Render();
+		return ImGui::GetDrawData();
+	}
+
 	void UserInterface::ShowImGuiDemoWnidow()
 	{
 		LT_PROFILE_FUNC();
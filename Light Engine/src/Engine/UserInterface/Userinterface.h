@@ -2,6 +2,8 @@
 
 #include "Core/Core.h"
 
+struct ImDrawData;
+
 namespace Light {
 
 	class UserInterface
@@ -14,7 +16,14 @@ namespace Light {
 		static inline UserInterface* Get() { return s_Context.get(); }
 
 		virtual void Begin() = 0;
-		virtual void End  () = 0;
+
+		// ends the frame and draws it
+		void End();
+
+		// ends the frame without drawing it, the draw data stays valid until the next Begin
+		ImDrawData* Render();
+
+		virtual void Draw(ImDrawData* drawData) = 0;
 
 		void ShowImGuiDemoWnidow();
 	private:
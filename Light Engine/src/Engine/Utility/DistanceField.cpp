@@ -0,0 +1,107 @@
+#include "ltpch.h"
+#include "DistanceField.h"
+
+// stands in for infinity, squaring or adding to it mustn't overflow
+#define LT_DISTANCE_FIELD_FAR 1e20f
+
+namespace Light {
+
+	// lower envelope of the parabolas rooted at every sample, f is 0 at features and far elsewhere
+	static void DistanceTransform(const float* f, float* d, int* v, float* z, unsigned int n)
+	{
+		int k = 0;
+		v[0] = 0;
+		z[0] = -LT_DISTANCE_FIELD_FAR;
+		z[1] = LT_DISTANCE_FIELD_FAR;
+
+		for (int q = 1; q < (int)n; q++)
+		{
+			float s = ((f[q] + q * q) - (f[v[k]] + v[k] * v[k])) / (2 * q - 2 * v[k]);
+			while (s <= z[k])
+			{
+				k--;
+				s = ((f[q] + q * q) - (f[v[k]] + v[k] * v[k])) / (2 * q - 2 * v[k]);
+			}
+
+			k++;
+			v[k] = q;
+			z[k] = s;
+			z[k + 1] = LT_DISTANCE_FIELD_FAR;
+		}
+
+		k = 0;
+		for (int q = 0; q < (int)n; q++)
+		{
+			while (z[k + 1] < q)
+				k++;
+
+			d[q] = (float)((q - v[k]) * (q - v[k])) + f[v[k]];
+		}
+	}
+
+	// squared distance of every texel to the nearest feature texel, in place
+	static void DistanceTransform(std::vector<float>& grid, unsigned int width, unsigned int height)
+	{
+		/* locals */
+		const unsigned int length = std::max(width, height);
+
+		std::vector<float> f(length), d(length), z(length + 1u);
+		std::vector<int> v(length);
+
+		// columns
+		for (unsigned int x = 0; x < width; x++)
+		{
+			for (unsigned int y = 0; y < height; y++)
+				f[y] = grid[y * width + x];
+
+			DistanceTransform(f.data(), d.data(), v.data(), z.data(), height);
+
+			for (unsigned int y = 0; y < height; y++)
+				grid[y * width + x] = d[y];
+		}
+
+		// rows
+		for (unsigned int y = 0; y < height; y++)
+		{
+			DistanceTransform(&grid[y * width], d.data(), v.data(), z.data(), width);
+			std::copy(d.begin(), d.begin() + width, grid.begin() + y * width);
+		}
+	}
+
+	std::vector<unsigned char> GenerateDistanceField(const unsigned char* coverage, unsigned int width, unsigned int height,
+	                                                 int pitch, unsigned int spread)
+	{
+		/* locals */
+		const unsigned int fieldWidth = width + spread * 2u;
+		const unsigned int fieldHeight = height + spread * 2u;
+
+		std::vector<bool> inside(fieldWidth * fieldHeight, false);
+		for (unsigned int y = 0; y < height; y++)
+			for (unsigned int x = 0; x < width; x++)
+				inside[(y + spread) * fieldWidth + x + spread] = coverage[(ptrdiff_t)y * pitch + x] >= 128u;
+
+		// distances to the nearest inside and the nearest outside texel
+		std::vector<float> outsideDistance(fieldWidth * fieldHeight), insideDistance(fieldWidth * fieldHeight);
+		for (unsigned int i = 0; i < fieldWidth * fieldHeight; i++)
+		{
+			outsideDistance[i] = inside[i] ? 0.0f : LT_DISTANCE_FIELD_FAR;
+			insideDistance[i] = inside[i] ? LT_DISTANCE_FIELD_FAR : 0.0f;
+		}
+
+		DistanceTransform(outsideDistance, fieldWidth, fieldHeight);
+		DistanceTransform(insideDistance, fieldWidth, fieldHeight);
+
+		std::vector<unsigned char> field(fieldWidth * fieldHeight);
+		const float unit = 127.0f / spread;
+
+		for (unsigned int i = 0; i < fieldWidth * fieldHeight; i++)
+		{
+			// the outline lies half way between an inside and an outside texel
+			const float distance = inside[i] ? -(std::sqrt(insideDistance[i]) - 0.5f) : std::sqrt(outsideDistance[i]) - 0.5f;
+			field[i] = (unsigned char)std::clamp(128.0f - distance * unit, 0.0f, 255.0f);
+		}
+
+		return field;
+	}
+
+}
\ No newline at end of file
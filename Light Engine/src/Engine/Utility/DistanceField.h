@@ -0,0 +1,13 @@
+#pragma once
+
+#include "Core/Core.h"
+
+namespace Light {
+
+	// converts an 8 bit coverage bitmap into a signed distance field padded by spread texels on every side,
+	// 128 is the outline and every texel of distance spread maps to 127 / spread steps, larger distances are clamped
+	// exact euclidean distances through Felzenszwalb & Huttenlocher's separable transform, thread safe
+	std::vector<unsigned char> GenerateDistanceField(const unsigned char* coverage, unsigned int width, unsigned int height,
+	                                                 int pitch, unsigned int spread);
+
+}
\ No newline at end of file
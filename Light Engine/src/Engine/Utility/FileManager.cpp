@@ -6,6 +6,8 @@
 #include <ft2build.h>
 #include FT_FREETYPE_H
 
+#include <cstring>
+
 namespace Light {
 
 	FT_LibraryRec_* FileManager::s_Library = nullptr;
@@ -17,9 +19,16 @@ namespace Light {
 		LT_CORE_ASSERT(!FT_Set_Pixel_Sizes(face, 0u, size), "FontFileData::FontFileData: FT_Set_Pixel_Sizes failed");
 	}
 
+	FontFileData::FontFileData(FontFileData&& other) noexcept
+		: face(other.face)
+	{
+		other.face = nullptr;
+	}
+
 	FontFileData::~FontFileData()
 	{
-		FT_Done_Face(face);
+		if (face)
+			FT_Done_Face(face);
 	}
 
 	void FontFileData::SetSize(unsigned int size)
@@ -27,18 +36,18 @@ namespace Light {
 		LT_CORE_ASSERT(!FT_Set_Pixel_Sizes(face, 0u, size), "FontFileData::FontFileData: FT_Set_Pixel_Sizes failed");
 	}
 
-	void FontFileData::LoadChar(unsigned char charCode)
+	void FontFileData::LoadChar(uint32_t codepoint)
 	{
 		LT_CORE_ASSERT(face, "FontFileData::LoadChar: no fonts are loaded");
-		LT_CORE_ASSERT(!FT_Load_Char(face, charCode, FT_LOAD_RENDER), "FontFileData::LoadChar: FT_Load_Char failed: {}", (char)charCode);
+		LT_CORE_ASSERT(!FT_Load_Char(face, codepoint, FT_LOAD_RENDER), "FontFileData::LoadChar: FT_Load_Char failed: U+{:04X}", codepoint);
 	}
 
-	const glm::vec2& FontFileData::GetSize() const
+	glm::vec2 FontFileData::GetSize() const
 	{
 		return glm::vec2(face->glyph->bitmap.width, face->glyph->bitmap.rows);
 	}
 
-	const glm::vec2& FontFileData::GetBearing() const
+	glm::vec2 FontFileData::GetBearing() const
 	{
 		return glm::vec2(face->glyph->bitmap_left, face->glyph->bitmap_top);
 	}
@@ -48,11 +57,35 @@ namespace Light {
 		return face->glyph->advance.x >> 6;
 	}
 
+	int FontFileData::GetPitch() const
+	{
+		return face->glyph->bitmap.pitch;
+	}
+
+	glm::vec2 FontFileData::GetMaxGlyphSize() const
+	{
+		// 26.6 fixed point, rounded up
+		return glm::vec2((face->size->metrics.max_advance + 63) >> 6,
+		                 (face->size->metrics.ascender - face->size->metrics.descender + 63) >> 6);
+	}
+
 	unsigned char* FontFileData::GetBuffer() const
 	{
 		return face->glyph->bitmap.buffer;
 	}
 
+	std::vector<unsigned char> FontFileData::GetBitmap() const
+	{
+		/* locals */
+		const FT_Bitmap& bitmap = face->glyph->bitmap;
+		std::vector<unsigned char> pixels(bitmap.width * bitmap.rows);
+
+		for (unsigned int y = 0; y < bitmap.rows; y++)
+			std::memcpy(&pixels[y * bitmap.width], bitmap.buffer + (ptrdiff_t)y * bitmap.pitch, bitmap.width);
+
+		return pixels;
+	}
+
 	std::string FileManager::LoadTextFile(const std::string& path)
 	{
 		LT_PROFILE_FUNC();
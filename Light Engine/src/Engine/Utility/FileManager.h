@@ -40,17 +40,30 @@ namespace Light {
 		FT_FaceRec_* face;
 	public:
 		FontFileData(FT_LibraryRec_* library, const char* path, unsigned int size);
+		FontFileData(FontFileData&& other) noexcept;
+		FontFileData(const FontFileData&) = delete;
 		~FontFileData();
 
-		void LoadChar(unsigned char charCode);
+		FontFileData& operator=(const FontFileData&) = delete;
+
+		void LoadChar(uint32_t codepoint);
 
 		void SetSize(unsigned int size);
 
-		const glm::vec2& GetSize() const;
-		const glm::vec2& GetBearing() const;
+		glm::vec2 GetSize() const;
+		glm::vec2 GetBearing() const;
 		unsigned int GetAdvance() const;
 
+		// bytes per row of the glyph's bitmap, may be larger than its width
+		int GetPitch() const;
+
+		// max advance and ascender - descender of the face at the current size, in pixels
+		glm::vec2 GetMaxGlyphSize() const;
+
 		unsigned char* GetBuffer() const;
+
+		// copy of the glyph's bitmap without the row padding
+		std::vector<unsigned char> GetBitmap() const;
 	};
 
 	class FileManager
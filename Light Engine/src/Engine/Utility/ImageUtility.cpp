@@ -0,0 +1,115 @@
+#include "ltpch.h"
+#include "ImageUtility.h"
+
+#include "SIMD.h"
+
+namespace Light {
+
+	namespace {
+
+		// row or column of the region covering a texel of the next level, clamped to the region's edges
+		inline unsigned int ClampToRegion(unsigned int texel, unsigned int regionStart, unsigned int regionSize)
+		{
+			return std::min(std::max(texel, regionStart), regionStart + regionSize - 1u) - regionStart;
+		}
+
+		inline void DownsampleTexel(const uint8_t* rowA, const uint8_t* rowB, unsigned int left, unsigned int right, unsigned int channels, uint8_t* destination)
+		{
+			for (unsigned int c = 0u; c < channels; c++)
+				destination[c] = (uint8_t)((rowA[left + c] + rowA[right + c] + rowB[left + c] + rowB[right + c] + 2u) / 4u);
+		}
+
+#ifdef LT_SIMD_SSE
+		// 16 bytes of two rows into 8 bytes of the next level, same rounding as DownsampleTexel
+		inline __m128i DownsampleBlock(const uint8_t* rowA, const uint8_t* rowB, unsigned int channels)
+		{
+			const __m128i zero = _mm_setzero_si128();
+			const __m128i a = _mm_loadu_si128((const __m128i*)rowA);
+			const __m128i b = _mm_loadu_si128((const __m128i*)rowB);
+
+			// vertical sums in 16 bits
+			const __m128i low = _mm_add_epi16(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero));
+			const __m128i high = _mm_add_epi16(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero));
+
+			// horizontal sums of texel pairs
+			__m128i sums;
+			if (channels == 4u)
+			{
+				// 2 texels per half, the upper one is shifted onto the lower one
+				sums = _mm_unpacklo_epi64(_mm_add_epi16(low, _mm_srli_si128(low, 8)), _mm_add_epi16(high, _mm_srli_si128(high, 8)));
+			}
+			else if (channels == 2u)
+			{
+				// texels are 32 bit lanes, pairs are swapped, added and the even lanes gathered
+				const __m128i lowSums = _mm_add_epi16(low, _mm_shuffle_epi32(low, _MM_SHUFFLE(2, 3, 0, 1)));
+				const __m128i highSums = _mm_add_epi16(high, _mm_shuffle_epi32(high, _MM_SHUFFLE(2, 3, 0, 1)));
+
+				sums = _mm_unpacklo_epi64(_mm_shuffle_epi32(lowSums, _MM_SHUFFLE(3, 1, 2, 0)), _mm_shuffle_epi32(highSums, _MM_SHUFFLE(3, 1, 2, 0)));
+			}
+			else
+			{
+				const __m128i ones = _mm_set1_epi16(1);
+				sums = _mm_packs_epi32(_mm_madd_epi16(low, ones), _mm_madd_epi16(high, ones));
+			}
+
+			sums = _mm_srli_epi16(_mm_add_epi16(sums, _mm_set1_epi16(2)), 2);
+			return _mm_packus_epi16(sums, sums);
+		}
+#endif
+
+	}
+
+	void DownsampleRegion(const uint8_t* source, const ImageRegion& region, unsigned int channels, uint8_t* destination, const ImageRegion& mipRegion)
+	{
+#ifdef LT_SIMD_SSE
+		if (channels != 1u && channels != 2u && channels != 4u)
+			return DownsampleRegionScalar(source, region, channels, destination, mipRegion);
+
+		const size_t rowSize = (size_t)region.width * channels;
+		const unsigned int blockTexels = 8u / channels;
+
+		// texels of the next level whose both columns are inside the region
+		const unsigned int interiorStart = std::min((region.x + 1u) / 2u - std::min(mipRegion.x, (region.x + 1u) / 2u), mipRegion.width);
+		const unsigned int interiorEnd = std::max(std::min((region.x + region.width) / 2u, mipRegion.x + mipRegion.width), mipRegion.x) - mipRegion.x;
+
+		for (unsigned int y = 0u; y < mipRegion.height; y++)
+		{
+			const uint8_t* rowA = source + ClampToRegion((mipRegion.y + y) * 2u, region.y, region.height) * rowSize;
+			const uint8_t* rowB = source + ClampToRegion((mipRegion.y + y) * 2u + 1u, region.y, region.height) * rowSize;
+
+			unsigned int x = 0u;
+			for (; x < interiorStart; x++, destination += channels)
+				DownsampleTexel(rowA, rowB, ClampToRegion((mipRegion.x + x) * 2u, region.x, region.width) * channels,
+				                ClampToRegion((mipRegion.x + x) * 2u + 1u, region.x, region.width) * channels, channels, destination);
+
+			for (; x + blockTexels <= interiorEnd; x += blockTexels, destination += 8u)
+			{
+				const unsigned int left = ((mipRegion.x + x) * 2u - region.x) * channels;
+				_mm_storel_epi64((__m128i*)destination, DownsampleBlock(rowA + left, rowB + left, channels));
+			}
+
+			for (; x < mipRegion.width; x++, destination += channels)
+				DownsampleTexel(rowA, rowB, ClampToRegion((mipRegion.x + x) * 2u, region.x, region.width) * channels,
+				                ClampToRegion((mipRegion.x + x) * 2u + 1u, region.x, region.width) * channels, channels, destination);
+		}
+#else
+		DownsampleRegionScalar(source, region, channels, destination, mipRegion);
+#endif
+	}
+
+	void DownsampleRegionScalar(const uint8_t* source, const ImageRegion& region, unsigned int channels, uint8_t* destination, const ImageRegion& mipRegion)
+	{
+		const size_t rowSize = (size_t)region.width * channels;
+
+		for (unsigned int y = 0u; y < mipRegion.height; y++)
+		{
+			const uint8_t* rowA = source + ClampToRegion((mipRegion.y + y) * 2u, region.y, region.height) * rowSize;
+			const uint8_t* rowB = source + ClampToRegion((mipRegion.y + y) * 2u + 1u, region.y, region.height) * rowSize;
+
+			for (unsigned int x = 0u; x < mipRegion.width; x++, destination += channels)
+				DownsampleTexel(rowA, rowB, ClampToRegion((mipRegion.x + x) * 2u, region.x, region.width) * channels,
+				                ClampToRegion((mipRegion.x + x) * 2u + 1u, region.x, region.width) * channels, channels, destination);
+		}
+	}
+
+}
\ No newline at end of file
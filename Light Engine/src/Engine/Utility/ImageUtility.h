@@ -0,0 +1,50 @@
+#pragma once
+
+#include "Core/Core.h"
+
+namespace Light {
+
+	// rectangle of texels in a single image or mip level
+	struct ImageRegion
+	{
+		unsigned int x, y, width, height;
+	};
+
+	// size of a mip level, never smaller than 1x1
+	inline unsigned int GetMipSize(unsigned int size, unsigned int level) { return std::max(size >> level, 1u); }
+
+	// number of levels in a full mip chain down to 1x1
+	inline unsigned int GetMipLevelCount(unsigned int width, unsigned int height)
+	{
+		unsigned int levels = 1u;
+		while ((std::max(width, height) >> levels) > 0u)
+			levels++;
+
+		return levels;
+	}
+
+	// every texel of the next mip level the region contributes to, clamped to that level's size
+	inline ImageRegion GetMipRegion(const ImageRegion& region, unsigned int mipWidth, unsigned int mipHeight)
+	{
+		const unsigned int x = std::min(region.x >> 1u, mipWidth - 1u);
+		const unsigned int y = std::min(region.y >> 1u, mipHeight - 1u);
+
+		return { x, y, std::min(((region.x + region.width - 1u) >> 1u) + 1u, mipWidth) - x,
+		               std::min(((region.y + region.height - 1u) >> 1u) + 1u, mipHeight) - y };
+	}
+
+	// averages 2x2 blocks of an 8 bit per channel region into 'mipRegion' of the next level
+	// texels outside the region are clamped to its edges, neighbouring regions don't bleed into each other
+	// both buffers are tightly packed and hold only their region, SSE2 handles 1, 2 and 4 channel interiors
+	void DownsampleRegion(const uint8_t* source, const ImageRegion& region, unsigned int channels, uint8_t* destination, const ImageRegion& mipRegion);
+
+	// reference implementation, bit exact with DownsampleRegion
+	void DownsampleRegionScalar(const uint8_t* source, const ImageRegion& region, unsigned int channels, uint8_t* destination, const ImageRegion& mipRegion);
+
+	// next mip level of a whole image
+	inline void DownsampleBox(const uint8_t* source, unsigned int width, unsigned int height, unsigned int channels, uint8_t* destination)
+	{
+		DownsampleRegion(source, { 0u, 0u, width, height }, channels, destination, { 0u, 0u, GetMipSize(width, 1u), GetMipSize(height, 1u) });
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,347 @@
+#include "ltpch.h"
+#include "JobSystem.h"
+
+namespace Light {
+
+	Job::Job(std::function<void()> task, const JobHandle& parent)
+		: m_Task(std::move(task)), m_Parent(parent), m_Unfinished(1u), b_Finished(false)
+	{
+	}
+
+	std::vector<std::unique_ptr<JobSystem::Worker>> JobSystem::s_Workers;
+
+	std::mutex JobSystem::s_SharedMutex;
+	std::deque<JobHandle> JobSystem::s_SharedJobs;
+
+	std::mutex JobSystem::s_SleepMutex;
+	std::condition_variable JobSystem::s_Condition;
+
+	std::atomic<unsigned int> JobSystem::s_QueuedJobs = 0u;
+	std::atomic<unsigned int> JobSystem::s_SleepingWorkers = 0u;
+	std::atomic<unsigned int> JobSystem::s_SleepingWaiters = 0u;
+
+	std::atomic<bool> JobSystem::s_Running = false;
+
+	thread_local int JobSystem::s_WorkerIndex = -1;
+
+	JobHandle JobSystem::Create(std::function<void()> task, const JobHandle& parent /*= nullptr*/)
+	{
+		if (parent)
+		{
+			LT_CORE_ASSERT(!parent->IsFinished(), "JobSystem::Create: the parent job has already finished");
+			parent->m_Unfinished.fetch_add(1u, std::memory_order_relaxed);
+		}
+
+		return std::make_shared<Job>(std::move(task), parent);
+	}
+
+	void JobSystem::Run(const JobHandle& job)
+	{
+		if (!s_Running)
+		{
+			Execute(job);
+			return;
+		}
+
+		Push(job);
+	}
+
+	JobHandle JobSystem::Schedule(std::function<void()> task, const JobHandle& parent /*= nullptr*/)
+	{
+		JobHandle job = Create(std::move(task), parent);
+		Run(job);
+
+		return job;
+	}
+
+	JobHandle JobSystem::Then(const JobHandle& job, std::function<void()> continuation)
+	{
+		JobHandle next = Create(std::move(continuation));
+
+		{
+			std::lock_guard<std::mutex> lock(job->m_Mutex);
+			if (!job->b_Finished)
+			{
+				job->m_Continuations.push_back(next);
+				return next;
+			}
+		}
+
+		Run(next);
+		return next;
+	}
+
+	void JobSystem::Wait(const JobHandle& job)
+	{
+		LT_PROFILE_FUNC();
+
+		for (unsigned int attempts = 0u; !job->IsFinished();)
+		{
+			if (JobHandle other = FindJob())
+			{
+				Execute(other);
+				attempts = 0u;
+			}
+			else if (++attempts < LT_JOB_WAIT_SPINS)
+				std::this_thread::yield();
+			else
+			{
+				// the job is running on other threads, Finish and Push wake this up
+				// a finish missed between the check and the wait is caught by the timeout
+				std::unique_lock<std::mutex> lock(s_SleepMutex);
+
+				s_SleepingWaiters++;
+				s_Condition.wait_for(lock, std::chrono::microseconds(LT_JOB_WAIT_SLEEP_MICROSECONDS), [&job]() { return job->IsFinished() || s_QueuedJobs; });
+				s_SleepingWaiters--;
+			}
+		}
+
+		/* locals */
+		std::exception_ptr exception;
+
+		{
+			std::lock_guard<std::mutex> lock(job->m_Mutex);
+			exception = job->m_Exception;
+		}
+
+		if (exception)
+			std::rethrow_exception(exception);
+	}
+
+	void JobSystem::ParallelFor(unsigned int count, unsigned int grainSize, const std::function<void(unsigned int begin, unsigned int end)>& body)
+	{
+		if (!count)
+			return;
+
+		// the group has no task, it finishes with the last subrange
+		JobHandle group = Create(nullptr);
+
+		// the queued subranges refer to 'body', they have to finish before this returns even if the calling thread's subrange throws
+		try
+		{
+			ParallelForRange(group, 0u, count, std::max(grainSize, 1u), body);
+		}
+		catch (...)
+		{
+			SetException(group, std::current_exception());
+		}
+
+		Finish(group);
+		Wait(group);
+	}
+
+	void JobSystem::Init(unsigned int workerCount /*= 0u*/)
+	{
+		LT_PROFILE_FUNC();
+		LT_CORE_ASSERT(!s_Running, "JobSystem::Init: recalled before calling JobSystem::Terminate()");
+
+		if (!workerCount)
+			workerCount = std::max(std::thread::hardware_concurrency(), 2u) - 1u;
+
+		s_Running = true;
+
+		// every deque exists before a worker may steal from it
+		s_Workers.reserve(workerCount);
+		for (unsigned int i = 0; i < workerCount; i++)
+			s_Workers.push_back(std::make_unique<Worker>());
+
+		for (unsigned int i = 0; i < workerCount; i++)
+			s_Workers[i]->thread = std::thread(&JobSystem::WorkerLoop, i);
+	}
+
+	void JobSystem::Terminate()
+	{
+		LT_PROFILE_FUNC();
+
+		{
+			std::lock_guard<std::mutex> lock(s_SleepMutex);
+			s_Running = false;
+		}
+
+		// workers drain the queues before they exit so no job is left unfinished
+		s_Condition.notify_all();
+		for (auto& worker : s_Workers)
+			worker->thread.join();
+
+		s_Workers.clear();
+	}
+
+	void JobSystem::WorkerLoop(unsigned int index)
+	{
+		s_WorkerIndex = (int)index;
+
+		while (true)
+		{
+			if (JobHandle job = FindJob())
+			{
+				Execute(job);
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock(s_SleepMutex);
+
+			// Push reads s_SleepingWorkers after queueing, either it notifies or the queued job is seen here
+			s_SleepingWorkers++;
+			s_Condition.wait(lock, []() { return !s_Running || s_QueuedJobs; });
+			s_SleepingWorkers--;
+
+			if (!s_Running && !s_QueuedJobs)
+				return;
+		}
+	}
+
+	void JobSystem::Push(JobHandle job)
+	{
+		// counted before it can be taken, FindJob may find nothing while the count is ahead but it never underflows
+		s_QueuedJobs++;
+
+		if (s_WorkerIndex >= 0)
+		{
+			Worker& worker = *s_Workers[s_WorkerIndex];
+
+			std::lock_guard<std::mutex> lock(worker.mutex);
+			worker.jobs.push_back(std::move(job));
+		}
+		else
+		{
+			std::lock_guard<std::mutex> lock(s_SharedMutex);
+			s_SharedJobs.push_back(std::move(job));
+		}
+
+		if (s_SleepingWorkers || s_SleepingWaiters)
+		{
+			{ std::lock_guard<std::mutex> lock(s_SleepMutex); }
+			s_Condition.notify_one();
+		}
+	}
+
+	JobHandle JobSystem::FindJob()
+	{
+		if (!s_QueuedJobs)
+			return nullptr;
+
+		/* locals */
+		JobHandle job;
+		const unsigned int workerCount = (unsigned int)s_Workers.size();
+
+		// the newest job of the calling worker, its data is the most likely to be in the cache
+		if (s_WorkerIndex >= 0)
+		{
+			Worker& worker = *s_Workers[s_WorkerIndex];
+
+			std::lock_guard<std::mutex> lock(worker.mutex);
+			if (!worker.jobs.empty())
+			{
+				job = std::move(worker.jobs.back());
+				worker.jobs.pop_back();
+			}
+		}
+
+		if (!job)
+		{
+			std::lock_guard<std::mutex> lock(s_SharedMutex);
+			if (!s_SharedJobs.empty())
+			{
+				job = std::move(s_SharedJobs.front());
+				s_SharedJobs.pop_front();
+			}
+		}
+
+		// steal the oldest job of another worker, it's the one most likely to spawn more work
+		const unsigned int first = s_WorkerIndex >= 0 ? s_WorkerIndex + 1u : 0u;
+		for (unsigned int i = 0; !job && i < workerCount; i++)
+		{
+			const unsigned int index = (first + i) % workerCount;
+			if ((int)index == s_WorkerIndex)
+				continue;
+
+			Worker& victim = *s_Workers[index];
+
+			std::lock_guard<std::mutex> lock(victim.mutex);
+			if (!victim.jobs.empty())
+			{
+				job = std::move(victim.jobs.front());
+				victim.jobs.pop_front();
+			}
+		}
+
+		if (job)
+			s_QueuedJobs--;
+
+		return job;
+	}
+
+	void JobSystem::Execute(const JobHandle& job)
+	{
+		try
+		{
+			if (job->m_Task)
+				job->m_Task();
+		}
+		catch (...)
+		{
+			SetException(job, std::current_exception());
+		}
+
+		Finish(job);
+	}
+
+	void JobSystem::Finish(const JobHandle& job)
+	{
+		if (job->m_Unfinished.fetch_sub(1u, std::memory_order_acq_rel) != 1u)
+			return;
+
+		/* locals */
+		std::vector<JobHandle> continuations;
+		std::exception_ptr exception;
+
+		{
+			std::lock_guard<std::mutex> lock(job->m_Mutex);
+			job->b_Finished = true;
+			continuations.swap(job->m_Continuations);
+			exception = job->m_Exception;
+		}
+
+		for (const JobHandle& continuation : continuations)
+			Run(continuation);
+
+		// threads sleeping in Wait
+		if (s_SleepingWaiters)
+		{
+			{ std::lock_guard<std::mutex> lock(s_SleepMutex); }
+			s_Condition.notify_all();
+		}
+
+		if (job->m_Parent)
+		{
+			// the parent is waited on instead of its children
+			if (exception)
+				SetException(job->m_Parent, exception);
+
+			Finish(job->m_Parent);
+		}
+	}
+
+	void JobSystem::SetException(const JobHandle& job, std::exception_ptr exception)
+	{
+		std::lock_guard<std::mutex> lock(job->m_Mutex);
+		if (!job->m_Exception)
+			job->m_Exception = std::move(exception);
+	}
+
+	void JobSystem::ParallelForRange(const JobHandle& group, unsigned int begin, unsigned int end, unsigned int grainSize,
+	                                 const std::function<void(unsigned int begin, unsigned int end)>& body)
+	{
+		// the upper halves are split off as jobs, thieves take the largest ones first
+		while (end - begin > grainSize)
+		{
+			const unsigned int middle = begin + (end - begin) / 2u;
+			Schedule([group, middle, end, grainSize, &body]() { ParallelForRange(group, middle, end, grainSize, body); }, group);
+
+			end = middle;
+		}
+
+		body(begin, end);
+	}
+
+}
\ No newline at end of file
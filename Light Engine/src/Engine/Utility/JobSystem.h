@@ -0,0 +1,140 @@
+#pragma once
+
+#include "Core/Core.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <mutex>
+
+// failed attempts to find another job before Wait sleeps, and the longest it sleeps before it looks again
+#define LT_JOB_WAIT_SPINS 64u
+#define LT_JOB_WAIT_SLEEP_MICROSECONDS 500u
+
+namespace Light {
+
+	class Job;
+
+	using JobHandle = std::shared_ptr<Job>;
+
+	// a task, the jobs created with it as their parent, and the jobs to run once all of them finish
+	class Job
+	{
+	private:
+		std::function<void()> m_Task;
+		JobHandle m_Parent;
+
+		// the job itself until its task returns, plus its unfinished children
+		std::atomic<unsigned int> m_Unfinished;
+
+		std::mutex m_Mutex;
+		std::vector<JobHandle> m_Continuations;
+		bool b_Finished;
+
+		// the first exception thrown by its task or its children's, rethrown by JobSystem::Wait
+		std::exception_ptr m_Exception;
+	public:
+		Job(std::function<void()> task, const JobHandle& parent);
+
+		Job(const Job&) = delete;
+		Job& operator=(const Job&) = delete;
+
+		inline bool IsFinished() const { return !m_Unfinished.load(std::memory_order_acquire); }
+	private:
+		friend class JobSystem;
+	};
+
+	// work-stealing scheduler, every worker has its own deque and takes the oldest jobs of the others when it runs out
+	// threads that aren't workers (ie. the main and render threads) queue their jobs in a shared deque
+	// waiting runs other jobs meanwhile, so jobs can wait on jobs
+	class JobSystem
+	{
+	private:
+		struct Worker
+		{
+			std::thread thread;
+
+			// the owner works at the back, thieves steal from the front
+			std::mutex mutex;
+			std::deque<JobHandle> jobs;
+		};
+
+		static std::vector<std::unique_ptr<Worker>> s_Workers;
+
+		static std::mutex s_SharedMutex;
+		static std::deque<JobHandle> s_SharedJobs;
+
+		// idle workers sleep until a job is queued, waiting threads until a job is queued or finishes
+		static std::mutex s_SleepMutex;
+		static std::condition_variable s_Condition;
+
+		static std::atomic<unsigned int> s_QueuedJobs;
+		static std::atomic<unsigned int> s_SleepingWorkers;
+		static std::atomic<unsigned int> s_SleepingWaiters;
+
+		static std::atomic<bool> s_Running;
+
+		// index into s_Workers, -1 on threads that aren't workers
+		static thread_local int s_WorkerIndex;
+	public:
+		JobSystem() = delete;
+
+		// the job is queued by Run, its children have to be created before it finishes
+		static JobHandle Create(std::function<void()> task, const JobHandle& parent = nullptr);
+		static void Run(const JobHandle& job);
+
+		// Create and Run, the task runs on the calling thread if the job system isn't running
+		static JobHandle Schedule(std::function<void()> task, const JobHandle& parent = nullptr);
+
+		// queued once 'job' and its children finish, right away if they did
+		static JobHandle Then(const JobHandle& job, std::function<void()> continuation);
+
+		// runs other jobs until 'job' and its children finish, then rethrows the first exception any of them threw
+		// sleeps when there's nothing else to run, the continuations of a job that threw still run
+		static void Wait(const JobHandle& job);
+
+		// calls 'body' on subranges of [0, count) of at most 'grainSize' elements, the calling thread takes subranges too,
+		// returns once the whole range is done even if a subrange threw, the first exception is rethrown then
+		static void ParallelFor(unsigned int count, unsigned int grainSize, const std::function<void(unsigned int begin, unsigned int end)>& body);
+
+		// for tasks with a result, the future shouldn't be waited on from inside a job since it doesn't run other jobs
+		template<typename Task>
+		static std::future<std::invoke_result_t<Task>> Submit(Task&& task)
+		{
+			using Result = std::invoke_result_t<Task>;
+
+			// std::function has to be copyable, packaged_task isn't
+			auto packagedTask = std::make_shared<std::packaged_task<Result()>>(std::forward<Task>(task));
+			std::future<Result> future = packagedTask->get_future();
+
+			Schedule([packagedTask]() { (*packagedTask)(); });
+			return future;
+		}
+
+		static inline unsigned int GetWorkerCount() { return (unsigned int)s_Workers.size(); }
+
+		// called by Application, tools without one (ie. TextureBaker) start and stop the job system themselves
+		// one worker per hardware thread besides the main one
+		static void Init(unsigned int workerCount = 0u);
+		static void Terminate();
+	private:
+		static void WorkerLoop(unsigned int index);
+
+		static void Push(JobHandle job);
+
+		// the calling worker's newest job, then the oldest shared one, then the oldest job of another worker
+		static JobHandle FindJob();
+
+		// the job's exception is caught and kept, it still finishes
+		static void Execute(const JobHandle& job);
+		static void Finish(const JobHandle& job);
+
+		// keeps the first exception only
+		static void SetException(const JobHandle& job, std::exception_ptr exception);
+
+		static void ParallelForRange(const JobHandle& group, unsigned int begin, unsigned int end, unsigned int grainSize,
+		                             const std::function<void(unsigned int begin, unsigned int end)>& body);
+	};
+
+}
\ No newline at end of file
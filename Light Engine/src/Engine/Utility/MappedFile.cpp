@@ -0,0 +1,39 @@
+#include "ltpch.h"
+#include "MappedFile.h"
+
+namespace Light {
+
+	MappedFile::MappedFile(const std::string& path)
+		: m_Data(nullptr), m_Size(0u), m_FileHandle(INVALID_HANDLE_VALUE), m_MappingHandle(nullptr)
+	{
+		LT_PROFILE_FUNC();
+
+		m_FileHandle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (m_FileHandle == INVALID_HANDLE_VALUE)
+			return;
+
+		LARGE_INTEGER size;
+		if (!GetFileSizeEx(m_FileHandle, &size) || !size.QuadPart)
+			return;
+
+		m_MappingHandle = CreateFileMappingA(m_FileHandle, nullptr, PAGE_READONLY, 0u, 0u, nullptr);
+		if (!m_MappingHandle)
+			return;
+
+		m_Data = (const uint8_t*)MapViewOfFile(m_MappingHandle, FILE_MAP_READ, 0u, 0u, 0u);
+		m_Size = m_Data ? (size_t)size.QuadPart : 0u;
+	}
+
+	MappedFile::~MappedFile()
+	{
+		if (m_Data)
+			UnmapViewOfFile(m_Data);
+
+		if (m_MappingHandle)
+			CloseHandle(m_MappingHandle);
+
+		if (m_FileHandle != INVALID_HANDLE_VALUE)
+			CloseHandle(m_FileHandle);
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Core/Core.h"
+
+namespace Light {
+
+	// read only memory mapping of a whole file, pages are loaded by the os on first access
+	class MappedFile
+	{
+	private:
+		const uint8_t* m_Data;
+		size_t m_Size;
+
+		void* m_FileHandle;
+		void* m_MappingHandle;
+	public:
+		MappedFile(const std::string& path);
+		~MappedFile();
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		// getters
+		inline const uint8_t* GetData() const { return m_Data; }
+		inline size_t GetSize() const { return m_Size; }
+
+		inline bool IsOpen() const { return m_Data; }
+	};
+
+}
\ No newline at end of file
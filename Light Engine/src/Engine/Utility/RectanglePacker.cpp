@@ -0,0 +1,175 @@
+#include "ltpch.h"
+#include "RectanglePacker.h"
+
+namespace Light {
+
+	RectanglePacker::RectanglePacker(unsigned int width, unsigned int height, PackingHeuristic heuristic /*= PackingHeuristic::BestShortSideFit*/)
+		: m_Width(width), m_Height(height), m_UsedArea(0u), m_Heuristic(heuristic)
+	{
+		Reset();
+	}
+
+	bool RectanglePacker::Insert(unsigned int width, unsigned int height, glm::uvec2& outPosition)
+	{
+		// empty rectangles don't take any space
+		if (!width || !height)
+		{
+			outPosition = glm::uvec2(0u);
+			return true;
+		}
+
+		/* locals */
+		int best = -1;
+		unsigned int bestPrimary = std::numeric_limits<unsigned int>::max();
+		unsigned int bestSecondary = std::numeric_limits<unsigned int>::max();
+
+		for (unsigned int i = 0; i < m_FreeRectangles.size(); i++)
+		{
+			const PackerRect& free = m_FreeRectangles[i];
+			if (free.width < width || free.height < height)
+				continue;
+
+			unsigned int primary, secondary;
+			if (m_Heuristic == PackingHeuristic::BestShortSideFit)
+			{
+				primary = std::min(free.width - width, free.height - height);
+				secondary = std::max(free.width - width, free.height - height);
+			}
+			else
+			{
+				primary = free.y + height;
+				secondary = free.x;
+			}
+
+			if (primary < bestPrimary || (primary == bestPrimary && secondary < bestSecondary))
+			{
+				best = i;
+				bestPrimary = primary;
+				bestSecondary = secondary;
+			}
+		}
+
+		if (best < 0)
+			return false;
+
+		const PackerRect used = { m_FreeRectangles[best].x, m_FreeRectangles[best].y, width, height };
+
+		SplitFreeRectangles(used);
+		PruneFreeRectangles();
+
+		m_UsedArea += (uint64_t)width * height;
+
+		outPosition = glm::uvec2(used.x, used.y);
+		return true;
+	}
+
+	void RectanglePacker::Reserve(const PackerRect& rect)
+	{
+		if (!rect.width || !rect.height)
+			return;
+
+		SplitFreeRectangles(rect);
+		PruneFreeRectangles();
+
+		m_UsedArea += (uint64_t)rect.width * rect.height;
+	}
+
+	void RectanglePacker::Free(const PackerRect& rect)
+	{
+		if (!rect.width || !rect.height)
+			return;
+
+		m_UsedArea -= (uint64_t)rect.width * rect.height;
+
+		m_Splits.clear();
+		m_Splits.push_back(rect);
+		PruneFreeRectangles();
+	}
+
+	void RectanglePacker::Reset()
+	{
+		m_FreeRectangles.clear();
+		m_FreeRectangles.push_back({ 0u, 0u, m_Width, m_Height });
+
+		m_UsedArea = 0u;
+	}
+
+	void RectanglePacker::SplitFreeRectangles(const PackerRect& used)
+	{
+		m_Splits.clear();
+
+		for (unsigned int i = 0; i < m_FreeRectangles.size();)
+		{
+			const PackerRect free = m_FreeRectangles[i];
+			if (!free.Intersects(used))
+			{
+				i++;
+				continue;
+			}
+
+			// the parts of the free rectangle around the used one, they overlap at the corners
+			if (used.x > free.x)
+				m_Splits.push_back({ free.x, free.y, used.x - free.x, free.height });
+			if (used.x + used.width < free.x + free.width)
+				m_Splits.push_back({ used.x + used.width, free.y, free.x + free.width - (used.x + used.width), free.height });
+			if (used.y > free.y)
+				m_Splits.push_back({ free.x, free.y, free.width, used.y - free.y });
+			if (used.y + used.height < free.y + free.height)
+				m_Splits.push_back({ free.x, used.y + used.height, free.width, free.y + free.height - (used.y + used.height) });
+
+			m_FreeRectangles[i] = m_FreeRectangles.back();
+			m_FreeRectangles.pop_back();
+		}
+	}
+
+	void RectanglePacker::PruneFreeRectangles()
+	{
+		// the untouched free rectangles don't contain each other, only the new splits need to be checked
+		auto isRedundant = [this](unsigned int index)
+		{
+			const PackerRect& split = m_Splits[index];
+
+			for (const auto& free : m_FreeRectangles)
+				if (free.Contains(split))
+					return true;
+
+			// of two identical splits the later one is dropped
+			for (unsigned int i = 0; i < m_Splits.size(); i++)
+				if (i != index && m_Splits[i].Contains(split) && (i < index || !split.Contains(m_Splits[i])))
+					return true;
+
+			return false;
+		};
+
+		m_Redundant.resize(m_Splits.size());
+		for (unsigned int i = 0; i < m_Splits.size(); i++)
+			m_Redundant[i] = isRedundant(i);
+
+		unsigned int kept = 0u;
+		for (unsigned int i = 0; i < m_Splits.size(); i++)
+			if (!m_Redundant[i])
+				m_Splits[kept++] = m_Splits[i];
+
+		m_Splits.resize(kept);
+
+		// free rectangles that ended up inside a new one
+		for (unsigned int i = 0; i < m_FreeRectangles.size();)
+		{
+			bool contained = false;
+			for (const auto& split : m_Splits)
+				if (split.Contains(m_FreeRectangles[i]))
+					{ contained = true; break; }
+
+			if (contained)
+			{
+				m_FreeRectangles[i] = m_FreeRectangles.back();
+				m_FreeRectangles.pop_back();
+			}
+			else
+				i++;
+		}
+
+		m_FreeRectangles.insert(m_FreeRectangles.end(), m_Splits.begin(), m_Splits.end());
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "Core/Core.h"
+
+#include <glm/glm.hpp>
+
+namespace Light {
+
+	struct PackerRect
+	{
+		unsigned int x, y, width, height;
+
+		inline bool Contains(const PackerRect& other) const
+		{
+			return other.x >= x && other.y >= y && other.x + other.width <= x + width && other.y + other.height <= y + height;
+		}
+
+		inline bool Intersects(const PackerRect& other) const
+		{
+			return other.x < x + width && x < other.x + other.width && other.y < y + height && y < other.y + other.height;
+		}
+	};
+
+	enum class PackingHeuristic
+	{
+		BestShortSideFit, // tightest free rectangle, best density for mixed sizes
+		BottomLeft,       // lowest position, keeps the used height small
+	};
+
+	// MaxRects bin packer, keeps a list of maximal free rectangles that may overlap each other
+	// every placement splits the free rectangles it touches and prunes the ones contained in others
+	class RectanglePacker
+	{
+	private:
+		std::vector<PackerRect> m_FreeRectangles;
+		std::vector<PackerRect> m_Splits;
+		std::vector<uint8_t> m_Redundant;
+
+		unsigned int m_Width, m_Height;
+		uint64_t m_UsedArea;
+
+		PackingHeuristic m_Heuristic;
+	public:
+		RectanglePacker(unsigned int width, unsigned int height, PackingHeuristic heuristic = PackingHeuristic::BestShortSideFit);
+
+		// returns false if there's no space left for the rectangle
+		bool Insert(unsigned int width, unsigned int height, glm::uvec2& outPosition);
+
+		// marks a rectangle placed elsewhere (ie. by a baked layout) as used
+		void Reserve(const PackerRect& rect);
+
+		// hands a previously inserted rectangle back, it doesn't merge with neighbouring free space
+		void Free(const PackerRect& rect);
+
+		void Reset();
+
+		// getters
+		inline float GetOccupancy() const { return (float)((double)m_UsedArea / ((double)m_Width * m_Height)); }
+
+		inline unsigned int GetWidth() const { return m_Width; }
+		inline unsigned int GetHeight() const { return m_Height; }
+	private:
+		void SplitFreeRectangles(const PackerRect& used);
+		void PruneFreeRectangles();
+	};
+
+}
\ No newline at end of file
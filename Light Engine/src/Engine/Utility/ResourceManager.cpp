@@ -2,6 +2,7 @@
 #include "ResourceManager.h"
 
 #include "Renderer/Texture.h"
+#include "Renderer/TextureCache.h"
 #include "Renderer/Shader.h"
 #include "Renderer/Font.h"
 
@@ -10,7 +11,9 @@ namespace Light {
 	std::shared_ptr<TextureArray> ResourceManager::s_TextureArray;
 	std::shared_ptr<TextureArray> ResourceManager::s_FontGlyphs;
 
-	std::unordered_map<std::string, std::shared_ptr<Font>> ResourceManager::s_Fonts;
+	SlotMap<std::shared_ptr<Font>, Font> ResourceManager::s_Fonts;
+	std::unordered_map<StringID, Handle<Font>> ResourceManager::s_FontHandles;
+	std::unordered_map<std::string, std::shared_ptr<Font>> ResourceManager::s_SDFFaces;
 
 	void ResourceManager::Init()
 	{
@@ -27,10 +30,13 @@ namespace Light {
 	{
 		LT_PROFILE_FUNC();
 
+		// fonts hold on to the glyph array for lazily rasterized glyphs
+		s_Fonts.Clear();
+		s_FontHandles.clear();
+		s_SDFFaces.clear();
+
 		s_TextureArray.reset();
 		s_FontGlyphs.reset();
-
-		s_Fonts.clear();
 	}
 
 	void ResourceManager::LoadTextureAtlas(const std::string& name, const std::string& texturePath, const std::string& atlasPath)
@@ -43,10 +49,40 @@ namespace Light {
 		s_TextureArray->LoadTexture(name, texturePath);
 	}
 
+	void ResourceManager::LoadTextureManifest(const std::string& path)
+	{
+		for (const auto& source : TextureCache::LoadManifest(path))
+		{
+			if (source.atlasPath.empty())
+				s_TextureArray->LoadTexture(source.name, source.texturePath);
+			else
+				s_TextureArray->LoadTextureAtlas(source.name, source.texturePath, source.atlasPath);
+		}
+	}
+
+	void ResourceManager::SetTextureCache(const std::string& path)
+	{
+		s_TextureArray->SetCachePath(path);
+	}
+
 	void ResourceManager::LoadFont(const std::string& name, const std::string& path, unsigned int size)
 	{
 		s_FontGlyphs->ResolveTextures();
-		s_Fonts[name] = std::make_shared<Font>(name, path, s_FontGlyphs, size);
+		AddFont(name, std::make_shared<Font>(name, path, s_FontGlyphs, size));
+	}
+
+	void ResourceManager::LoadSDFFont(const std::string& name, const std::string& path, unsigned int size)
+	{
+		std::shared_ptr<Font>& face = s_SDFFaces[path];
+
+		// the first size of a file rasterizes its face
+		if (!face)
+		{
+			s_FontGlyphs->ResolveTextures();
+			face = std::make_shared<Font>("sdf:" + path, path, s_FontGlyphs, LT_SDF_FONT_SIZE, FontMode::SDF);
+		}
+
+		AddFont(name, std::make_shared<Font>(face, size));
 	}
 
 	void ResourceManager::ResolveTextures()
@@ -54,19 +90,77 @@ namespace Light {
 		s_TextureArray->ResolveTextures();
 	}
 
-	void ResourceManager::DeleteTexture(const std::string& name)
+	void ResourceManager::DefragmentTextures()
+	{
+		s_TextureArray->Defragment();
+	}
+
+	void ResourceManager::DeleteTexture(StringID name)
 	{
 		s_TextureArray->DeleteTexture(name);
 	}
 
-	void ResourceManager::DeleteFont(const std::string& name)
+	void ResourceManager::DeleteFont(StringID name)
 	{
-		s_FontGlyphs->DeleteTexture(name);
-		s_Fonts.erase(name);
+		auto handle = s_FontHandles.find(name);
+		LT_CORE_ASSERT(handle != s_FontHandles.end(), "ResourceManager::DeleteFont: failed to find font with hash: {}", name.hash);
+
+		// bitmap fonts are their own face, it's gone once removed
+		Font* face = s_Fonts.Get(handle->second)->GetFace();
+		const bool isSDF = face->GetMode() == FontMode::SDF;
+
+		s_Fonts.Remove(handle->second);
+		s_FontHandles.erase(handle);
+
+		if (!isSDF)
+		{
+			s_FontGlyphs->DeleteTexture(name);
+			return;
+		}
+
+		// the face goes once its last size does
+		for (auto it = s_SDFFaces.begin(); it != s_SDFFaces.end(); it++)
+		{
+			if (it->second.get() == face && it->second.use_count() == 1)
+			{
+				s_FontGlyphs->DeleteTexture("sdf:" + it->first);
+				s_SDFFaces.erase(it);
+				break;
+			}
+		}
 	}
 
-	std::shared_ptr<Texture> ResourceManager::GetTexture(const std::string& name) { return s_TextureArray->GetTexture(name); }
+	Handle<Texture> ResourceManager::GetTextureHandle(StringID name) { return s_TextureArray->GetTextureHandle(name); }
 
-	std::shared_ptr<Font> ResourceManager::GetFont(const std::string& name) { return s_Fonts[name]; }
+	Handle<Font> ResourceManager::GetFontHandle(StringID name)
+	{
+		auto it = s_FontHandles.find(name);
+		return it != s_FontHandles.end() ? it->second : Handle<Font>();
+	}
+
+	std::shared_ptr<Texture> ResourceManager::GetTexture(StringID name) { return s_TextureArray->GetTexture(name); }
+	std::shared_ptr<Texture> ResourceManager::GetTexture(Handle<Texture> handle) { return s_TextureArray->GetTexture(handle); }
+
+	std::shared_ptr<Font> ResourceManager::GetFont(StringID name)
+	{
+		auto it = s_FontHandles.find(name);
+		if (it == s_FontHandles.end())
+		{
+			LT_CORE_ERROR("ResourceManager::GetFont: failed to find font with hash: {}", name.hash);
+			return nullptr;
+		}
+
+		return s_Fonts.Get(it->second);
+	}
+
+	std::shared_ptr<Font> ResourceManager::GetFont(Handle<Font> handle) { return s_Fonts.Get(handle); }
+
+	void ResourceManager::AddFont(const std::string& name, std::shared_ptr<Font> font)
+	{
+		auto [it, inserted] = s_FontHandles.emplace(StringID(name), Handle<Font>());
+		LT_CORE_ASSERT(inserted, "ResourceManager::AddFont: name is already in use or its hash collides with another one: {}", name);
+
+		it->second = s_Fonts.Insert(std::move(font));
+	}
 
 }
\ No newline at end of file
@@ -2,6 +2,9 @@
 
 #include "Core/Core.h"
 
+#include "SlotMap.h"
+#include "StringID.h"
+
 namespace Light {
 
 	class TextureArray;
@@ -14,20 +17,43 @@ namespace Light {
 		static std::shared_ptr<TextureArray> s_TextureArray;
 		static std::shared_ptr<TextureArray> s_FontGlyphs;
 
-		static std::unordered_map<std::string, std::shared_ptr<Font>> s_Fonts;
+		static SlotMap<std::shared_ptr<Font>, Font> s_Fonts;
+		static std::unordered_map<StringID, Handle<Font>> s_FontHandles;
+
+		// one signed distance field face per font file, shared by every size loaded from it
+		static std::unordered_map<std::string, std::shared_ptr<Font>> s_SDFFaces;
 	public:
 		static void LoadTextureAtlas(const std::string& name, const std::string& texturePath, const std::string& atlasPath);
 		static void LoadTexture(const std::string& name, const std::string& texturePath);
+
+		// loads every entry of a manifest, see TextureCache::LoadManifest
+		static void LoadTextureManifest(const std::string& path);
+
+		// the textures are loaded from a baked cache (TextureBaker) on ResolveTextures, set before loading any
+		static void SetTextureCache(const std::string& path);
 		static void LoadFont(const std::string& name, const std::string& path, unsigned int size);
+		static void LoadSDFFont(const std::string& name, const std::string& path, unsigned int size);
 
 		static void ResolveTextures();
 
-		static void DeleteTexture(const std::string& name);
-		static void DeleteFont(const std::string& name);
+		// called by Application every frame, spreads the work of compacting the texture array over frames
+		static void DefragmentTextures();
 
-		static std::shared_ptr<Texture> GetTexture(const std::string& name);
-		static std::shared_ptr<Font> GetFont(const std::string& name);
+		static void DeleteTexture(StringID name);
+		static void DeleteFont(StringID name);
+
+		// handles are looked up once, getting a resource from one is an array access
+		static Handle<Texture> GetTextureHandle(StringID name);
+		static Handle<Font> GetFontHandle(StringID name);
+
+		static std::shared_ptr<Texture> GetTexture(StringID name);
+		static std::shared_ptr<Texture> GetTexture(Handle<Texture> handle);
+
+		static std::shared_ptr<Font> GetFont(StringID name);
+		static std::shared_ptr<Font> GetFont(Handle<Font> handle);
 	private:
+		static void AddFont(const std::string& name, std::shared_ptr<Font> font);
+
 		friend class GraphicsContext;
 		static void Terminate();
 		static void Init();
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "Core/Core.h"
+
+// SSE2 is always available on x64, AVX only when the compiler targets it (/arch:AVX)
+#if defined(__AVX__)
+	#define LT_SIMD_AVX
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define LT_SIMD_SSE
+#endif
+
+#if defined(LT_SIMD_AVX)
+	#include <immintrin.h>
+#elif defined(LT_SIMD_SSE)
+	#include <emmintrin.h>
+#endif
+
+namespace Light {
+
+	// sin and cos are evaluated with cephes' minimax polynomials on [-pi/4, pi/4] after reducing x by multiples of pi/2,
+	// the quadrant then selects/negates the results, max error is around 2 ulp for |x| < 8192
+
+#ifdef LT_SIMD_SSE
+	inline void SinCos(__m128 x, __m128& outSin, __m128& outCos)
+	{
+		// range reduction
+		const __m128i quadrant = _mm_cvtps_epi32(_mm_mul_ps(x, _mm_set1_ps(0.636619772f))); // x * 2/pi, rounded
+		const __m128 j = _mm_cvtepi32_ps(quadrant);
+
+		__m128 r = _mm_sub_ps(x, _mm_mul_ps(j, _mm_set1_ps(1.5703125f)));
+		r = _mm_sub_ps(r, _mm_mul_ps(j, _mm_set1_ps(4.837512969970703125e-4f)));
+		r = _mm_sub_ps(r, _mm_mul_ps(j, _mm_set1_ps(7.54978995489188216e-8f)));
+
+		const __m128 r2 = _mm_mul_ps(r, r);
+
+		// sin(r)
+		__m128 s = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(-1.9515295891e-4f), r2), _mm_set1_ps(8.3321608736e-3f));
+		s = _mm_add_ps(_mm_mul_ps(s, r2), _mm_set1_ps(-1.6666654611e-1f));
+		s = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(s, r2), r), r);
+
+		// cos(r)
+		__m128 c = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(2.443315711809948e-5f), r2), _mm_set1_ps(-1.388731625493765e-3f));
+		c = _mm_add_ps(_mm_mul_ps(c, r2), _mm_set1_ps(4.166664568298827e-2f));
+		c = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(c, r2), r2), _mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(r2, _mm_set1_ps(0.5f))));
+
+		// odd quadrants swap sin and cos
+		const __m128 swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(quadrant, _mm_set1_epi32(1)), _mm_set1_epi32(1)));
+		const __m128 sinResult = _mm_or_ps(_mm_and_ps(swap, c), _mm_andnot_ps(swap, s));
+		const __m128 cosResult = _mm_or_ps(_mm_and_ps(swap, s), _mm_andnot_ps(swap, c));
+
+		// sin is negated in quadrants 2 and 3, cos in quadrants 1 and 2
+		const __m128 sinSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(quadrant, _mm_set1_epi32(2)), 30));
+		const __m128 cosSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(quadrant, _mm_set1_epi32(1)), _mm_set1_epi32(2)), 30));
+
+		outSin = _mm_xor_ps(sinResult, sinSign);
+		outCos = _mm_xor_ps(cosResult, cosSign);
+	}
+#endif
+
+#ifdef LT_SIMD_AVX
+	// AVX has no 256-bit integer ops, the quadrant is kept in floats
+	inline void SinCos(__m256 x, __m256& outSin, __m256& outCos)
+	{
+		// range reduction
+		const __m256 j = _mm256_round_ps(_mm256_mul_ps(x, _mm256_set1_ps(0.636619772f)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+
+		__m256 r = _mm256_sub_ps(x, _mm256_mul_ps(j, _mm256_set1_ps(1.5703125f)));
+		r = _mm256_sub_ps(r, _mm256_mul_ps(j, _mm256_set1_ps(4.837512969970703125e-4f)));
+		r = _mm256_sub_ps(r, _mm256_mul_ps(j, _mm256_set1_ps(7.54978995489188216e-8f)));
+
+		const __m256 r2 = _mm256_mul_ps(r, r);
+
+		// sin(r)
+		__m256 s = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(-1.9515295891e-4f), r2), _mm256_set1_ps(8.3321608736e-3f));
+		s = _mm256_add_ps(_mm256_mul_ps(s, r2), _mm256_set1_ps(-1.6666654611e-1f));
+		s = _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(s, r2), r), r);
+
+		// cos(r)
+		__m256 c = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(2.443315711809948e-5f), r2), _mm256_set1_ps(-1.388731625493765e-3f));
+		c = _mm256_add_ps(_mm256_mul_ps(c, r2), _mm256_set1_ps(4.166664568298827e-2f));
+		c = _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(c, r2), r2), _mm256_sub_ps(_mm256_set1_ps(1.0f), _mm256_mul_ps(r2, _mm256_set1_ps(0.5f))));
+
+		// quadrant = j mod 4, in [0, 4)
+		const __m256 quadrant = _mm256_sub_ps(j, _mm256_mul_ps(_mm256_floor_ps(_mm256_mul_ps(j, _mm256_set1_ps(0.25f))), _mm256_set1_ps(4.0f)));
+
+		const __m256 isQuadrant1 = _mm256_cmp_ps(quadrant, _mm256_set1_ps(1.0f), _CMP_EQ_OQ);
+		const __m256 isQuadrant2 = _mm256_cmp_ps(quadrant, _mm256_set1_ps(2.0f), _CMP_EQ_OQ);
+		const __m256 isQuadrant3 = _mm256_cmp_ps(quadrant, _mm256_set1_ps(3.0f), _CMP_EQ_OQ);
+
+		// odd quadrants swap sin and cos
+		const __m256 swap = _mm256_or_ps(isQuadrant1, isQuadrant3);
+		const __m256 sinResult = _mm256_blendv_ps(s, c, swap);
+		const __m256 cosResult = _mm256_blendv_ps(c, s, swap);
+
+		// sin is negated in quadrants 2 and 3, cos in quadrants 1 and 2
+		const __m256 signBit = _mm256_set1_ps(-0.0f);
+		outSin = _mm256_xor_ps(sinResult, _mm256_and_ps(_mm256_or_ps(isQuadrant2, isQuadrant3), signBit));
+		outCos = _mm256_xor_ps(cosResult, _mm256_and_ps(_mm256_or_ps(isQuadrant1, isQuadrant2), signBit));
+	}
+#endif
+
+}
\ No newline at end of file
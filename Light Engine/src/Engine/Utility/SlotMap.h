@@ -0,0 +1,94 @@
+#pragma once
+
+#include "Core/Core.h"
+
+namespace Light {
+
+	// index into a SlotMap, goes stale once its slot is removed even if the slot is reused
+	template<typename T>
+	struct Handle
+	{
+		uint32_t index = 0u;
+		uint32_t generation = 0u; // never handed out, a default handle is null
+
+		inline bool IsNull() const { return !generation; }
+
+		inline bool operator==(const Handle& other) const { return index == other.index && generation == other.generation; }
+		inline bool operator!=(const Handle& other) const { return !(*this == other); }
+	};
+
+	// values in a flat array addressed by handles, removed slots are reused
+	// stale handles are caught by an assertion in debug builds, elsewhere they're just indices
+	template<typename T, typename Tag = T>
+	class SlotMap
+	{
+	private:
+		struct Slot
+		{
+			T value;
+			uint32_t generation;
+		};
+
+		std::vector<Slot> m_Slots;
+		std::vector<uint32_t> m_FreeSlots;
+	public:
+		Handle<Tag> Insert(T value)
+		{
+			if (m_FreeSlots.empty())
+			{
+				m_Slots.push_back({ std::move(value), 1u });
+				return { (uint32_t)m_Slots.size() - 1u, 1u };
+			}
+
+			const uint32_t index = m_FreeSlots.back();
+			m_FreeSlots.pop_back();
+
+			m_Slots[index].value = std::move(value);
+			return { index, m_Slots[index].generation };
+		}
+
+		void Remove(Handle<Tag> handle)
+		{
+			LT_CORE_ASSERT(IsValid(handle), "SlotMap::Remove: stale or null handle: {}, {}", handle.index, handle.generation);
+
+			Slot& slot = m_Slots[handle.index];
+			slot.value = T();
+
+			// 0 marks null handles
+			if (!++slot.generation)
+				slot.generation = 1u;
+
+			m_FreeSlots.push_back(handle.index);
+		}
+
+		void Clear()
+		{
+			m_Slots.clear();
+			m_FreeSlots.clear();
+		}
+
+		inline T& Get(Handle<Tag> handle)
+		{
+#ifdef LIGHT_DEBUG
+			LT_CORE_ASSERT(IsValid(handle), "SlotMap::Get: stale or null handle: {}, {}", handle.index, handle.generation);
+#endif
+			return m_Slots[handle.index].value;
+		}
+
+		inline const T& Get(Handle<Tag> handle) const
+		{
+#ifdef LIGHT_DEBUG
+			LT_CORE_ASSERT(IsValid(handle), "SlotMap::Get: stale or null handle: {}, {}", handle.index, handle.generation);
+#endif
+			return m_Slots[handle.index].value;
+		}
+
+		inline bool IsValid(Handle<Tag> handle) const
+		{
+			return !handle.IsNull() && handle.index < m_Slots.size() && m_Slots[handle.index].generation == handle.generation;
+		}
+
+		inline size_t GetCount() const { return m_Slots.size() - m_FreeSlots.size(); }
+	};
+
+}
\ No newline at end of file
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "Core/Core.h"
+
+// hashed at compile time, use for names that are looked up at runtime
+#define LT_SID(str) ::Light::StringID(std::integral_constant<unsigned int, ::Light::hashStr(str)>::value)
+
+namespace Light {
+
+	// resource name reduced to its hashStr, the string itself isn't kept
+	// names are checked for collisions when a resource is registered under them
+	struct StringID
+	{
+		unsigned int hash;
+
+		constexpr StringID() : hash(0u) {}
+		constexpr explicit StringID(unsigned int hash_) : hash(hash_) {}
+
+		// hashed at runtime, prefer LT_SID for literals
+		constexpr StringID(const char* str) : hash(hashStr(str)) {}
+		StringID(const std::string& str) : hash(hashStr(str.c_str())) {}
+
+		constexpr bool operator==(const StringID& other) const { return hash == other.hash; }
+		constexpr bool operator!=(const StringID& other) const { return hash != other.hash; }
+	};
+
+}
+
+namespace std {
+
+	template<>
+	struct hash<Light::StringID>
+	{
+		size_t operator()(const Light::StringID& id) const { return id.hash; }
+	};
+
+}
\ No newline at end of file
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "Core/Core.h"
+
+#include <string_view>
+
+// substituted for malformed sequences, overlong encodings and surrogates
+#define LT_UTF8_REPLACEMENT 0xfffdu
+
+namespace Light {
+
+	// decodes the codepoint starting at text[index] and advances index past it,
+	// a malformed sequence only consumes its first byte so decoding resynchronizes on the next one
+	inline uint32_t DecodeUTF8(std::string_view text, size_t& index)
+	{
+		const uint8_t lead = (uint8_t)text[index++];
+
+		// ascii fast path
+		if (lead < 0x80u)
+			return lead;
+
+		/* locals */
+		uint32_t codepoint, minimum;
+		size_t length;
+
+		if ((lead & 0xe0u) == 0xc0u)      { codepoint = lead & 0x1fu; length = 1u; minimum = 0x80u;    }
+		else if ((lead & 0xf0u) == 0xe0u) { codepoint = lead & 0x0fu; length = 2u; minimum = 0x800u;   }
+		else if ((lead & 0xf8u) == 0xf0u) { codepoint = lead & 0x07u; length = 3u; minimum = 0x10000u; }
+		else
+			return LT_UTF8_REPLACEMENT;
+
+		if (index + length > text.size())
+			return LT_UTF8_REPLACEMENT;
+
+		for (size_t i = 0; i < length; i++)
+		{
+			const uint8_t continuation = (uint8_t)text[index + i];
+			if ((continuation & 0xc0u) != 0x80u)
+				return LT_UTF8_REPLACEMENT;
+
+			codepoint = (codepoint << 6) | (continuation & 0x3fu);
+		}
+
+		if (codepoint < minimum || codepoint > 0x10ffffu || (codepoint >= 0xd800u && codepoint <= 0xdfffu))
+			return LT_UTF8_REPLACEMENT;
+
+		index += length;
+		return codepoint;
+	}
+
+}
\ No newline at end of file
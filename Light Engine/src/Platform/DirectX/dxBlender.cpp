@@ -22,9 +22,7 @@ namespace Light {
 							  { BlendFactor::DST_ALPHA_INVERSE, D3D11_BLEND_INV_DEST_ALPHA } }),
 
 		m_SrcFactor(BlendFactor::SRC_ALPHA),
-		m_DstFactor(BlendFactor::SRC_ALPHA_INVERSE),
-		b_Enabled(false)
-
+		m_DstFactor(BlendFactor::SRC_ALPHA_INVERSE)
 	{
 		LT_PROFILE_FUNC();
 
@@ -19,8 +19,6 @@ namespace Light {
 
 		BlendFactor m_SrcFactor;
 		BlendFactor m_DstFactor;
-
-		bool b_Enabled;
 	public:
 		dxBlender();
 		~dxBlender();
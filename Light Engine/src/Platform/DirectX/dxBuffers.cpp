@@ -56,7 +56,7 @@ namespace Light {
 	}
 
 	// VertexBuffer //
-	dxVertexBuffer::dxVertexBuffer(float* vertices, unsigned int stride, unsigned int count)
+	dxVertexBuffer::dxVertexBuffer(float* vertices, unsigned int stride, unsigned int count, BufferUsage usage)
 		: m_Stride(stride)
 	{
 		LT_PROFILE_FUNC();
@@ -64,9 +64,10 @@ namespace Light {
 		D3D11_BUFFER_DESC bd = {};
 		D3D11_SUBRESOURCE_DATA sd = {};
 
+		// dynamic buffers can only be rewritten as a whole, UpdateSubresource needs the default usage
 		bd.BindFlags = D3D11_BIND_VERTEX_BUFFER;
-		bd.Usage     = D3D11_USAGE_DYNAMIC;
-		bd.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+		bd.Usage     = usage == BufferUsage::Static ? D3D11_USAGE_DEFAULT : D3D11_USAGE_DYNAMIC;
+		bd.CPUAccessFlags = usage == BufferUsage::Static ? 0u : D3D11_CPU_ACCESS_WRITE;
 		bd.ByteWidth = stride * count;
 		bd.StructureByteStride = stride;
 
@@ -97,17 +98,78 @@ namespace Light {
 		dxGraphicsContext::GetDeviceContext()->Unmap(m_Buffer.Get(), NULL);
 	}
 
+	void dxVertexBuffer::Update(const void* data, unsigned int offset, unsigned int size)
+	{
+		const D3D11_BOX box = { offset, 0u, 0u, offset + size, 1u, 1u };
+		dxGraphicsContext::GetDeviceContext()->UpdateSubresource(m_Buffer.Get(), 0u, &box, data, 0u, 0u);
+	}
+
 	void dxVertexBuffer::Bind()
 	{
 		const UINT offset = 0u;
 		dxGraphicsContext::GetDeviceContext()->IASetVertexBuffers(0u, 1u, m_Buffer.GetAddressOf(), &m_Stride, &offset);
 	}
 
+	// StreamVertexBuffer //
+	dxStreamVertexBuffer::dxStreamVertexBuffer(unsigned int stride, unsigned int count)
+		: StreamVertexBuffer(stride, count)
+	{
+		LT_PROFILE_FUNC();
+
+		D3D11_BUFFER_DESC bd = {};
+
+		bd.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+		bd.Usage     = D3D11_USAGE_DYNAMIC;
+		bd.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+		bd.ByteWidth = stride * count * LT_FRAMES_IN_FLIGHT;
+		bd.StructureByteStride = stride;
+
+		HRESULT hr;
+		DXC(dxGraphicsContext::GetDevice()->CreateBuffer(&bd, nullptr, &m_Buffer));
+	}
+
+	dxStreamVertexBuffer::~dxStreamVertexBuffer()
+	{
+		LT_PROFILE_FUNC();
+
+		const UINT offset = 0u;
+
+		ID3D11Buffer* buffer = nullptr;
+		dxGraphicsContext::GetDeviceContext()->IASetVertexBuffers(0u, 1u, &buffer, &m_Stride, &offset);
+	}
+
+	void* dxStreamVertexBuffer::Map()
+	{
+		// the driver renames the buffer on discard, the GPU keeps reading the previous frames' regions from the old one
+		const D3D11_MAP mapType = !m_Region && !m_Cursor ? D3D11_MAP_WRITE_DISCARD : D3D11_MAP_WRITE_NO_OVERWRITE;
+
+		dxGraphicsContext::GetDeviceContext()->Map(m_Buffer.Get(), NULL, mapType, NULL, &m_Map);
+		return (uint8_t*)m_Map.pData + (size_t)GetFirstVertex() * m_Stride;
+	}
+
+	void dxStreamVertexBuffer::UnMap()
+	{
+		dxGraphicsContext::GetDeviceContext()->Unmap(m_Buffer.Get(), NULL);
+	}
+
+	void dxStreamVertexBuffer::Bind()
+	{
+		const UINT offset = 0u;
+		dxGraphicsContext::GetDeviceContext()->IASetVertexBuffers(0u, 1u, m_Buffer.GetAddressOf(), &m_Stride, &offset);
+	}
+
+	void dxStreamVertexBuffer::EndFrame()
+	{
+		AdvanceRegion();
+	}
+
 	// IndexBuffer //
-	dxIndexBuffer::dxIndexBuffer(unsigned int* indices, unsigned int count)
+	dxIndexBuffer::dxIndexBuffer(unsigned int* indices, unsigned int count, IndexFormat format)
 	{
 		LT_PROFILE_FUNC();
 
+		m_Format = format;
+
 		bool noIndices = false;
 		if (!indices)
 		{
@@ -131,15 +193,28 @@ namespace Light {
 			}
 		}
 
+		std::vector<uint16_t> shortIndices;
+		if (format == IndexFormat::UInt16)
+		{
+			shortIndices.resize(count);
+			for (unsigned int i = 0; i < count; i++)
+			{
+				LT_CORE_ASSERT(indices[i] <= UINT16_MAX, "dxIndexBuffer::dxIndexBuffer: index '{}' does not fit in 16 bits", indices[i]);
+				shortIndices[i] = (uint16_t)indices[i];
+			}
+		}
+
+		const unsigned int indexSize = format == IndexFormat::UInt16 ? sizeof(uint16_t) : sizeof(unsigned int);
+
 		D3D11_BUFFER_DESC bd = {};
 		D3D11_SUBRESOURCE_DATA sd = {};
 
 		bd.BindFlags = D3D11_BIND_INDEX_BUFFER;
 		bd.Usage     = D3D11_USAGE_DEFAULT;
-		bd.ByteWidth = count * sizeof(unsigned int);
-		bd.StructureByteStride = sizeof(unsigned int);
+		bd.ByteWidth = count * indexSize;
+		bd.StructureByteStride = indexSize;
 
-		sd.pSysMem = indices;
+		sd.pSysMem = format == IndexFormat::UInt16 ? (void*)shortIndices.data() : (void*)indices;
 
 		HRESULT hr;
 		DXC(dxGraphicsContext::GetDevice()->CreateBuffer(&bd, &sd, &m_Buffer));
@@ -161,7 +236,7 @@ namespace Light {
 
 	void dxIndexBuffer::Bind()
 	{
-		dxGraphicsContext::GetDeviceContext()->IASetIndexBuffer(m_Buffer.Get(), DXGI_FORMAT_R32_UINT, 0u);
+		dxGraphicsContext::GetDeviceContext()->IASetIndexBuffer(m_Buffer.Get(), m_Format == IndexFormat::UInt16 ? DXGI_FORMAT_R16_UINT : DXGI_FORMAT_R32_UINT, 0u);
 	}
 
 }
\ No newline at end of file
@@ -34,13 +34,33 @@ namespace Light {
 
 		unsigned int m_Stride;
 	public:
-		dxVertexBuffer(float* vertices, unsigned int stride, unsigned int count);
+		dxVertexBuffer(float* vertices, unsigned int stride, unsigned int count, BufferUsage usage);
 		~dxVertexBuffer();
 
 		void* Map  () override;
 		void  UnMap() override;
 
+		void Update(const void* data, unsigned int offset, unsigned int size) override;
+
+		void Bind() override;
+	};
+
+	// D3D11_MAP_WRITE_NO_OVERWRITE while appending, D3D11_MAP_WRITE_DISCARD when the regions wrap around
+	class dxStreamVertexBuffer : public StreamVertexBuffer
+	{
+	private:
+		Microsoft::WRL::ComPtr<ID3D11Buffer> m_Buffer;
+		D3D11_MAPPED_SUBRESOURCE m_Map;
+	public:
+		dxStreamVertexBuffer(unsigned int stride, unsigned int count);
+		~dxStreamVertexBuffer();
+
+		void* Map  () override;
+		void  UnMap() override;
+
 		void Bind() override;
+
+		void EndFrame() override;
 	};
 
 	class dxIndexBuffer : public IndexBuffer
@@ -48,7 +68,7 @@ namespace Light {
 	private:
 		Microsoft::WRL::ComPtr<ID3D11Buffer> m_Buffer;
 	public:
-		dxIndexBuffer(unsigned int* indices, unsigned int count);
+		dxIndexBuffer(unsigned int* indices, unsigned int count, IndexFormat format);
 		~dxIndexBuffer();
 
 		void Bind() override;
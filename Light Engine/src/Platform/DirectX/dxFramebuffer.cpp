@@ -7,23 +7,20 @@
 
 namespace Light {
 
-	dxFramebuffer::dxFramebuffer(const std::string& vertex, const std::string& pixel, unsigned int width, unsigned int height, TextureBindingSlot slot)
-		: m_BindingSlot(slot)
+	dxFramebuffer::dxFramebuffer(unsigned int width, unsigned int height, FramebufferFormat format)
+		: Framebuffer(width, height, format), m_BoundSlot(BINDING_FRAMEBUFFER0)
 	{
 		LT_PROFILE_FUNC();
 
 		HRESULT hr;
 
-		// Create shader 
-		m_Shader = Shader::Create(vertex, pixel);
-
 		// Create texture resource
 		D3D11_TEXTURE2D_DESC textureDesc = {};
-		textureDesc.Width = GraphicsContext::GetConfigurations().resolution.width;
-		textureDesc.Height = GraphicsContext::GetConfigurations().resolution.height;
+		textureDesc.Width = width;
+		textureDesc.Height = height;
 		textureDesc.MipLevels = 1;
 		textureDesc.ArraySize = 1;
-		textureDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+		textureDesc.Format = format == FramebufferFormat::RGBA16F ? DXGI_FORMAT_R16G16B16A16_FLOAT : DXGI_FORMAT_R8G8B8A8_UNORM;
 		textureDesc.SampleDesc.Count = 1;
 		textureDesc.SampleDesc.Quality = 0;
 		textureDesc.Usage = D3D11_USAGE_DEFAULT;
@@ -53,48 +50,30 @@ namespace Light {
 		LT_PROFILE_FUNC();
 
 		ID3D11ShaderResourceView* srv = nullptr;
-		 
-		m_Shader->Bind();
-		dxGraphicsContext::GetDeviceContext()->PSSetShaderResources(m_BindingSlot, 1u, &srv);
+		dxGraphicsContext::GetDeviceContext()->PSSetShaderResources(m_BoundSlot, 1u, &srv);
 	}
 
-	void dxFramebuffer::BindAsTarget()
+	void dxFramebuffer::BindAsTarget(bool clear /*= false*/)
 	{
 		static const float colors [] =  { 0.0f, 0.0f, 0.0f, 0.0f };
 
+		// the texture may still be bound as the input of the previous pass
+		ID3D11ShaderResourceView* srv = nullptr;
+		dxGraphicsContext::GetDeviceContext()->PSSetShaderResources(m_BoundSlot, 1u, &srv);
+
+		D3D11_VIEWPORT viewport = { 0.0f, 0.0f, (float)m_Width, (float)m_Height, 0.0f, 1.0f };
+
 		dxGraphicsContext::GetDeviceContext()->OMSetRenderTargets(1u, m_TargetView.GetAddressOf(), nullptr);
-		dxGraphicsContext::GetDeviceContext()->ClearRenderTargetView(m_TargetView.Get(), colors);
-	}
+		dxGraphicsContext::GetDeviceContext()->RSSetViewports(1u, &viewport);
 
-	void dxFramebuffer::BindAsResource()
-	{
-		m_Shader->Bind();
-		dxGraphicsContext::GetDeviceContext()->PSSetShaderResources(m_BindingSlot, 1u, m_TextureView.GetAddressOf());
+		if (clear)
+			dxGraphicsContext::GetDeviceContext()->ClearRenderTargetView(m_TargetView.Get(), colors);
 	}
 
-	void dxFramebuffer::Resize(unsigned int width, unsigned int height)
+	void dxFramebuffer::BindAsResource(TextureBindingSlot slot /*= BINDING_FRAMEBUFFER0*/)
 	{
-		LT_PROFILE_FUNC();
-
-		if (!width)
-			return;
-
-		HRESULT hr;
-
-		D3D11_TEXTURE2D_DESC texture2dDesc;
-		D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc;
-		D3D11_RENDER_TARGET_VIEW_DESC rtvDesc;
-
-		m_Texture->GetDesc(&texture2dDesc);
-		m_TextureView->GetDesc(&srvDesc);
-		m_TargetView->GetDesc(&rtvDesc);
-
-		texture2dDesc.Width = width;
-		texture2dDesc.Height = height;
-
-		DXC(dxGraphicsContext::GetDevice()->CreateTexture2D(&texture2dDesc, nullptr, &m_Texture));
-		DXC(dxGraphicsContext::GetDevice()->CreateShaderResourceView(m_Texture.Get(), &srvDesc, &m_TextureView));
-		DXC(dxGraphicsContext::GetDevice()->CreateRenderTargetView(m_Texture.Get(), &rtvDesc, &m_TargetView));
+		m_BoundSlot = slot;
+		dxGraphicsContext::GetDeviceContext()->PSSetShaderResources(slot, 1u, m_TextureView.GetAddressOf());
 	}
 
 }
\ No newline at end of file
@@ -9,26 +9,20 @@
 
 namespace Light {
 
-	class Shader;
-
 	class dxFramebuffer : public Framebuffer
 	{
 	private:
-		std::shared_ptr<Shader> m_Shader;
-
 		Microsoft::WRL::ComPtr<ID3D11Texture2D> m_Texture;
 		Microsoft::WRL::ComPtr<ID3D11ShaderResourceView> m_TextureView;
 		Microsoft::WRL::ComPtr<ID3D11RenderTargetView> m_TargetView;
 
-		TextureBindingSlot m_BindingSlot;
+		unsigned int m_BoundSlot;
 	public:
-		dxFramebuffer(const std::string& vertex, const std::string& pixel, unsigned int width, unsigned int height, TextureBindingSlot slot);
+		dxFramebuffer(unsigned int width, unsigned int height, FramebufferFormat format);
 		~dxFramebuffer();
 
-		void BindAsTarget() override;
-		void BindAsResource() override;
-
-		void Resize(unsigned int width, unsigned int height) override;
+		void BindAsTarget(bool clear = false) override;
+		void BindAsResource(TextureBindingSlot slot = BINDING_FRAMEBUFFER0) override;
 	};
 
 }
\ No newline at end of file
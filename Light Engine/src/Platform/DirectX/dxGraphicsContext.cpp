@@ -161,9 +161,14 @@ namespace Light {
 		m_DeviceContext->Draw(count, 0u);
 	}
 
-	void dxGraphicsContext::DrawIndexed(unsigned int count)
+	void dxGraphicsContext::DrawIndexed(unsigned int count, unsigned int offset, unsigned int baseVertex)
 	{
-		m_DeviceContext->DrawIndexed(count, 0u, 0u);
+		m_DeviceContext->DrawIndexed(count, offset, baseVertex);
+	}
+
+	void dxGraphicsContext::DrawInstanced(unsigned int vertexCount, unsigned int instanceCount, unsigned int firstInstance)
+	{
+		m_DeviceContext->DrawInstanced(vertexCount, instanceCount, 0u, firstInstance);
 	}
 
 	void dxGraphicsContext::SetConfigurations(const GraphicsConfigurations& configurations)
@@ -246,6 +251,10 @@ namespace Light {
 	void dxGraphicsContext::DefaultRenderBuffer()
 	{
 		s_Instance->m_DeviceContext->OMSetRenderTargets(1, s_Instance->m_RenderTargetView.GetAddressOf(), nullptr); 
+
+		// framebuffers set the viewport to their own size
+		D3D11_VIEWPORT viewPort = { 0.0f, 0.0f, (float)m_Configurations.resolution.width, (float)m_Configurations.resolution.height, 0.0f, 1.0f };
+		s_Instance->m_DeviceContext->RSSetViewports(1u, &viewPort);
 	}
 
 }
\ No newline at end of file
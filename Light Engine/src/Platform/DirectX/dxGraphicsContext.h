@@ -29,7 +29,8 @@ namespace Light {
 		void ClearBackbuffer(float colors[4]) override;
 
 		void Draw(unsigned int count) override;
-		void DrawIndexed(unsigned int count) override;
+		void DrawIndexed(unsigned int count, unsigned int offset, unsigned int baseVertex) override;
+		void DrawInstanced(unsigned int vertexCount, unsigned int instanceCount, unsigned int firstInstance) override;
 
 		// Setters
 		void SetConfigurations(const GraphicsConfigurations& configurations) override;
@@ -7,9 +7,11 @@
 
 #include <d3dcompiler.h>
 
+#include <cstring>
+
 namespace Light {
 
-	std::vector<std::pair<const std::string, const std::string>> dxShader::s_TextureSlotsMap =
+	std::vector<std::pair<const std::string, const std::string>> dxShaderCompiler::s_TextureSlotsMap =
 	{
 		{ LT_TOKEN_TO_STRING(BINDING_TEXTUREARRAY0)  , 't' + std::to_string(BINDING_TEXTUREARRAY0)   },
 		{ LT_TOKEN_TO_STRING(BINDING_FONTGLYPHARRAY0), 't' + std::to_string(BINDING_FONTGLYPHARRAY0) },
@@ -18,25 +20,17 @@ namespace Light {
 		{ LT_TOKEN_TO_STRING(BINDING_FRAMEBUFFER2)   , 't' + std::to_string(BINDING_FRAMEBUFFER2)    },
 	};
 
-	dxShader::dxShader(const std::string& vertexSource, std::string& pixelSource)
+	dxShader::dxShader(const void* vertexBytecode, size_t vertexSize, const void* pixelBytecode, size_t pixelSize, const std::string& vertexSource)
 	{
 		LT_PROFILE_FUNC();
 
-		Microsoft::WRL::ComPtr<ID3DBlob> ps = nullptr, vsErr = nullptr, psErr = nullptr;
-
-		for (const auto& it : s_TextureSlotsMap)
-			while (pixelSource.find(it.first) != std::string::npos)
-				pixelSource.replace(pixelSource.find(it.first), it.first.size(), it.second);
-
-		D3DCompile(vertexSource.c_str(), vertexSource.length(), NULL, nullptr, nullptr, "main", "vs_4_0", NULL, NULL, &m_VertexBlob, &vsErr);
-		D3DCompile(pixelSource.c_str() , pixelSource.length() , NULL, nullptr, nullptr, "main", "ps_4_0", NULL, NULL, &ps, &psErr);
-
-		LT_CORE_ASSERT(!vsErr.Get(), "dxShader::dxShader: vertex shader compile error: {}", (char*)vsErr->GetBufferPointer());
-		LT_CORE_ASSERT(!psErr.Get(), "dxShader::dxShader: pixel shader compile error: {}", (char*)psErr->GetBufferPointer());
-
 		HRESULT hr;
-		DXC(dxGraphicsContext::GetDevice()->CreateVertexShader(m_VertexBlob->GetBufferPointer(), m_VertexBlob->GetBufferSize(), NULL, &m_VertexShader));
-		DXC(dxGraphicsContext::GetDevice()->CreatePixelShader(ps->GetBufferPointer(), ps->GetBufferSize(), NULL, &m_PixelShader));
+		DXC(dxGraphicsContext::GetDevice()->CreateVertexShader(vertexBytecode, vertexSize, NULL, &m_VertexShader));
+		DXC(dxGraphicsContext::GetDevice()->CreatePixelShader(pixelBytecode, pixelSize, NULL, &m_PixelShader));
+
+		// the input layout is validated against the vertex bytecode
+		DXC(D3DCreateBlob(vertexSize, &m_VertexBlob));
+		std::memcpy(m_VertexBlob->GetBufferPointer(), vertexBytecode, vertexSize);
 
 		ExtractVertexElements(vertexSource);
 	}
@@ -111,4 +105,55 @@ namespace Light {
 		}
 	}
 
+	std::string dxShaderCompiler::GetDeviceName()
+	{
+		// bytecode doesn't depend on the driver, only on the compiler
+		return "directx d3dcompiler_" + std::to_string(D3D_COMPILER_VERSION) + " vs_4_0 ps_4_0";
+	}
+
+	std::shared_ptr<Shader> dxShaderCompiler::Compile(const std::string& vertexSource, const std::string& pixelSource, std::vector<uint8_t>& binary)
+	{
+		LT_PROFILE_FUNC();
+
+		Microsoft::WRL::ComPtr<ID3DBlob> vs = nullptr, ps = nullptr, vsErr = nullptr, psErr = nullptr;
+
+		std::string source = pixelSource;
+		for (const auto& it : s_TextureSlotsMap)
+			while (source.find(it.first) != std::string::npos)
+				source.replace(source.find(it.first), it.first.size(), it.second);
+
+		D3DCompile(vertexSource.c_str(), vertexSource.length(), NULL, nullptr, nullptr, "main", "vs_4_0", NULL, NULL, &vs, &vsErr);
+		D3DCompile(source.c_str()      , source.length()      , NULL, nullptr, nullptr, "main", "ps_4_0", NULL, NULL, &ps, &psErr);
+
+		LT_CORE_ASSERT(!vsErr.Get(), "dxShaderCompiler::Compile: vertex shader compile error: {}", (char*)vsErr->GetBufferPointer());
+		LT_CORE_ASSERT(!psErr.Get(), "dxShaderCompiler::Compile: pixel shader compile error: {}", (char*)psErr->GetBufferPointer());
+
+		const uint32_t vertexSize = (uint32_t)vs->GetBufferSize();
+
+		binary.resize(sizeof(vertexSize) + vertexSize + ps->GetBufferSize());
+		std::memcpy(binary.data(), &vertexSize, sizeof(vertexSize));
+		std::memcpy(binary.data() + sizeof(vertexSize), vs->GetBufferPointer(), vertexSize);
+		std::memcpy(binary.data() + sizeof(vertexSize) + vertexSize, ps->GetBufferPointer(), ps->GetBufferSize());
+
+		return std::make_shared<dxShader>(vs->GetBufferPointer(), vs->GetBufferSize(), ps->GetBufferPointer(), ps->GetBufferSize(), vertexSource);
+	}
+
+	std::shared_ptr<Shader> dxShaderCompiler::Load(const std::string& vertexSource, const std::string& pixelSource, const std::vector<uint8_t>& binary)
+	{
+		LT_PROFILE_FUNC();
+
+		uint32_t vertexSize;
+		if (binary.size() <= sizeof(vertexSize))
+			return nullptr;
+
+		std::memcpy(&vertexSize, binary.data(), sizeof(vertexSize));
+		if (!vertexSize || binary.size() - sizeof(vertexSize) <= vertexSize)
+			return nullptr;
+
+		const uint8_t* vertexBytecode = binary.data() + sizeof(vertexSize);
+		const uint8_t* pixelBytecode = vertexBytecode + vertexSize;
+
+		return std::make_shared<dxShader>(vertexBytecode, vertexSize, pixelBytecode, binary.size() - sizeof(vertexSize) - vertexSize, vertexSource);
+	}
+
 }
\ No newline at end of file
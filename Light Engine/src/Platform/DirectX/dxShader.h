@@ -3,6 +3,7 @@
 #include "Core/Core.h"
 
 #include "Renderer/Shader.h"
+#include "Renderer/ShaderCache.h"
 
 #include <d3d11.h>
 #include <wrl.h>
@@ -12,14 +13,12 @@ namespace Light {
 	class dxShader : public Shader
 	{
 	private:
-		static std::vector<std::pair<const std::string, const std::string>> s_TextureSlotsMap;
-
 		Microsoft::WRL::ComPtr<ID3D11VertexShader> m_VertexShader;
 		Microsoft::WRL::ComPtr<ID3D11PixelShader> m_PixelShader;	
 
 		Microsoft::WRL::ComPtr<ID3D10Blob> m_VertexBlob;
 	public:
-		dxShader(const std::string& vertexSource, std::string& pixelSource);
+		dxShader(const void* vertexBytecode, size_t vertexSize, const void* pixelBytecode, size_t pixelSize, const std::string& vertexSource);
 		~dxShader();
 
 		void Bind() override;
@@ -31,4 +30,17 @@ namespace Light {
 		VertexElementType GetVertexElementType(const char* typeName);
 	};
 
+	// the binary is the bytecode of both stages: vertex size | vertex bytecode | pixel bytecode
+	class dxShaderCompiler : public ShaderCompiler
+	{
+	private:
+		static std::vector<std::pair<const std::string, const std::string>> s_TextureSlotsMap;
+	public:
+		std::string GetDeviceName() override;
+
+		std::shared_ptr<Shader> Compile(const std::string& vertexSource, const std::string& pixelSource, std::vector<uint8_t>& binary) override;
+
+		std::shared_ptr<Shader> Load(const std::string& vertexSource, const std::string& pixelSource, const std::vector<uint8_t>& binary) override;
+	};
+
 }
\ No newline at end of file
@@ -22,19 +22,17 @@ namespace Light {
 
 		textureDesc.Width = width;
 		textureDesc.Height = height;
-		textureDesc.MipLevels = 0u;
+		textureDesc.MipLevels = m_MipLevels;
 		textureDesc.ArraySize = depth;
 		textureDesc.Format = m_Format;
 		textureDesc.SampleDesc.Count = 1u;
 		textureDesc.SampleDesc.Quality = 0u;
 		textureDesc.Usage = D3D11_USAGE_DEFAULT;
-		textureDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE | D3D11_BIND_RENDER_TARGET;
+		textureDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE; // mips are generated on the cpu, see TextureArray::GenerateMips
 		textureDesc.CPUAccessFlags = NULL;
-		textureDesc.MiscFlags = D3D11_RESOURCE_MISC_GENERATE_MIPS;
+		textureDesc.MiscFlags = NULL;
 
 		DXC(dxGraphicsContext::GetDevice()->CreateTexture2D(&textureDesc, nullptr, &m_Texture));
-		m_Texture->GetDesc(&textureDesc);
-		m_MipLevels = textureDesc.MipLevels;
 
 		D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc;
 		srvDesc.Format = m_Format;
@@ -55,58 +53,48 @@ namespace Light {
 		dxGraphicsContext::GetDeviceContext()->PSSetShaderResources(m_BoundSlot, 1u, &srv);
 	}
 
-	void dxTextureArray::UpdateSubTexture(unsigned int xoffset, unsigned int yoffset, unsigned int zoffset, unsigned int width, unsigned int height, void* pixels)
+	void dxTextureArray::Bind(unsigned int slot	/* = 0 */)
 	{
 		LT_PROFILE_FUNC();
 
-		D3D11_BOX box;
-		box.left = xoffset;
-		box.right = xoffset + width;
-		box.top = yoffset;
-		box.bottom = yoffset + height;
-		box.front = zoffset;
-		box.back = zoffset + 1;
-
-		dxGraphicsContext::GetDeviceContext()->UpdateSubresource(m_Texture.Get(),
-		                                                         D3D11CalcSubresource(0, zoffset, m_MipLevels),
-		                                                         &box,
-		                                                         pixels,
-		                                                         width * m_Channels,
-		                                                         width * height * m_Channels);
+		m_BoundSlot = slot;	
+		dxGraphicsContext::GetDeviceContext()->PSSetShaderResources(slot, 1u, m_SRV.GetAddressOf());
 	}
 
-	void dxTextureArray::UpdateSubTexture(const TextureCoordinates& bounds, void* pixels)
+	void dxTextureArray::UploadRegion(unsigned int slice, unsigned int level, const ImageRegion& region, const void* pixels)
 	{
 		LT_PROFILE_FUNC();
 
 		D3D11_BOX box;
-		box.left = bounds.xMin;
-		box.right = bounds.xMax;
-		box.top = bounds.yMin;
-		box.bottom = bounds.yMax;
-		box.front = bounds.sliceIndex;
-		box.back = bounds.sliceIndex + 1;
+		box.left = region.x;
+		box.right = region.x + region.width;
+		box.top = region.y;
+		box.bottom = region.y + region.height;
+		box.front = 0u;
+		box.back = 1u;
 
 		dxGraphicsContext::GetDeviceContext()->UpdateSubresource(m_Texture.Get(),
-		                                                         D3D11CalcSubresource(0, bounds.sliceIndex, m_MipLevels),
+		                                                         D3D11CalcSubresource(level, slice, m_MipLevels),
 		                                                         &box,
 		                                                         pixels,
-		                                                         (bounds.xMax - bounds.xMin) * m_Channels,
-		                                                         (bounds.xMax - bounds.xMin) * (bounds.yMax - bounds.yMin) * m_Channels);
+		                                                         region.width * m_Channels,
+		                                                         region.width * region.height * m_Channels);
 	}
 
-	void dxTextureArray::GenerateMips()
-	{
-		LT_PROFILE_FUNC();
-		dxGraphicsContext::GetDeviceContext()->GenerateMips(m_SRV.Get());
-	}
-
-	void dxTextureArray::Bind(unsigned int slot	/* = 0 */)
+	void dxTextureArray::CopyRegion(unsigned int sourceSlice, unsigned int slice, unsigned int level, const ImageRegion& source, unsigned int x, unsigned int y)
 	{
 		LT_PROFILE_FUNC();
 
-		m_BoundSlot = slot;	
-		dxGraphicsContext::GetDeviceContext()->PSSetShaderResources(slot, 1u, m_SRV.GetAddressOf());
+		D3D11_BOX box;
+		box.left = source.x;
+		box.right = source.x + source.width;
+		box.top = source.y;
+		box.bottom = source.y + source.height;
+		box.front = 0u;
+		box.back = 1u;
+
+		dxGraphicsContext::GetDeviceContext()->CopySubresourceRegion(m_Texture.Get(), D3D11CalcSubresource(level, slice, m_MipLevels), x, y, 0u,
+		                                                             m_Texture.Get(), D3D11CalcSubresource(level, sourceSlice, m_MipLevels), &box);
 	}
 
 }
\ No newline at end of file
@@ -14,7 +14,6 @@ namespace Light {
 	private:
 		Microsoft::WRL::ComPtr<ID3D11ShaderResourceView> m_SRV;
 		Microsoft::WRL::ComPtr<ID3D11Texture2D> m_Texture;
-		unsigned int m_MipLevels;
 
 		unsigned int m_BoundSlot;
 
@@ -23,12 +22,11 @@ namespace Light {
 		dxTextureArray(unsigned int width, unsigned int height, unsigned int depth, unsigned int channels);
 		~dxTextureArray();
 
-		void UpdateSubTexture(unsigned int xoffset, unsigned int yoffset, unsigned int zoffset, unsigned int width, unsigned int height, void* pixels) override;
-		void UpdateSubTexture(const TextureCoordinates& bounds, void* pixels) override;
-
-		void GenerateMips() override;
-
 		void Bind(unsigned int slot = 0) override;
+	private:
+		void UploadRegion(unsigned int slice, unsigned int level, const ImageRegion& region, const void* pixels) override;
+
+		void CopyRegion(unsigned int sourceSlice, unsigned int slice, unsigned int level, const ImageRegion& source, unsigned int x, unsigned int y) override;
 	};
 
 }
\ No newline at end of file
@@ -51,10 +51,9 @@ namespace Light {
 		ImGui::NewFrame();
 	}
 
-	void dxUserInterface::End()
+	void dxUserInterface::Draw(ImDrawData* drawData)
 	{
-		ImGui::Render();
-		ImGui_ImplDX11_RenderDrawData(ImGui::GetDrawData());
+		ImGui_ImplDX11_RenderDrawData(drawData);
 	}
 
 }
\ No newline at end of file
@@ -13,7 +13,7 @@ namespace Light {
 		~dxUserInterface();
 
 		void Begin() override;
-		void End() override;
+		void Draw(ImDrawData* drawData) override;
 	};
 
 }
\ No newline at end of file
@@ -10,7 +10,7 @@
 
 namespace Light {
 
-	dxVertexLayout::dxVertexLayout(std::shared_ptr<Shader> shader, const std::vector<std::pair<std::string, VertexElementType>>& elements)
+	dxVertexLayout::dxVertexLayout(std::shared_ptr<Shader> shader, const std::vector<std::pair<std::string, VertexElementType>>& elements, VertexInputRate inputRate)
 	{
 		LT_PROFILE_FUNC();
 
@@ -18,6 +18,8 @@ namespace Light {
 		std::vector<D3D11_INPUT_ELEMENT_DESC> inputElementsDesc;
 		inputElementsDesc.reserve(elements.size());
 
+		const bool perInstance = inputRate == VertexInputRate::PerInstance;
+
 		for (const auto& element : elements)
 		{
 			inputElementsDesc.emplace_back( D3D11_INPUT_ELEMENT_DESC{ element.first.c_str(),
@@ -25,8 +27,8 @@ namespace Light {
 			                                                          GetDxgiFormat(element.second),
 			                                                          0u,
 			                                                          D3D11_APPEND_ALIGNED_ELEMENT,
-			                                                          D3D11_INPUT_PER_VERTEX_DATA,
-			                                                          0u } );
+			                                                          perInstance ? D3D11_INPUT_PER_INSTANCE_DATA : D3D11_INPUT_PER_VERTEX_DATA,
+			                                                          perInstance ? 1u : 0u } );
 		}
 
 		// input layout
@@ -107,6 +109,15 @@ namespace Light {
 		case Light::VertexElementType::Float3:    return DXGI_FORMAT_R32G32B32_FLOAT;
 		case Light::VertexElementType::Float4:    return DXGI_FORMAT_R32G32B32A32_FLOAT;
 
+		case Light::VertexElementType::Half2:       return DXGI_FORMAT_R16G16_FLOAT;
+		case Light::VertexElementType::Half4:       return DXGI_FORMAT_R16G16B16A16_FLOAT;
+
+		case Light::VertexElementType::UShort2Norm: return DXGI_FORMAT_R16G16_UNORM;
+		case Light::VertexElementType::UShort4Norm: return DXGI_FORMAT_R16G16B16A16_UNORM;
+
+		case Light::VertexElementType::UByte4:      return DXGI_FORMAT_R8G8B8A8_UINT;
+		case Light::VertexElementType::UByte4Norm:  return DXGI_FORMAT_R8G8B8A8_UNORM;
+
 		// #todo
 		case Light::VertexElementType::Double:
 		case Light::VertexElementType::Double2:
@@ -141,6 +152,15 @@ namespace Light {
 		case Light::VertexElementType::Double3:	  return "double3";
 		case Light::VertexElementType::Double4:   return "double4";
 
+		case Light::VertexElementType::Half2:       return "float2";
+		case Light::VertexElementType::Half4:       return "float4";
+
+		case Light::VertexElementType::UShort2Norm: return "float2";
+		case Light::VertexElementType::UShort4Norm: return "float4";
+
+		case Light::VertexElementType::UByte4:      return "uint4";
+		case Light::VertexElementType::UByte4Norm:  return "float4";
+
 		default: LT_CORE_ASSERT(false, "dxVertexLayout::GetHLSLTypeName: invalid vertex type");
 		}
 	}
@@ -16,7 +16,7 @@ namespace Light {
 	private:
 		Microsoft::WRL::ComPtr<ID3D11InputLayout> m_InputLayout;
 	public:
-		dxVertexLayout(std::shared_ptr<Shader> shader, const std::vector<std::pair<std::string, VertexElementType>>& elements);
+		dxVertexLayout(std::shared_ptr<Shader> shader, const std::vector<std::pair<std::string, VertexElementType>>& elements, VertexInputRate inputRate);
 		~dxVertexLayout();
 
 		void Bind() override;
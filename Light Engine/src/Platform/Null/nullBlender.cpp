@@ -0,0 +1,35 @@
+#include "ltpch.h"
+#include "nullBlender.h"
+#include "nullGraphicsContext.h"
+
+namespace Light {
+
+	nullBlender::nullBlender()
+	{
+		LT_PROFILE_FUNC();
+		Disable();
+	}
+
+	void nullBlender::Enable()
+	{
+		b_Enabled = true;
+		nullGraphicsContext::Record().blendChanges++;
+	}
+
+	void nullBlender::Disable()
+	{
+		b_Enabled = false;
+		nullGraphicsContext::Record().blendChanges++;
+	}
+
+	void nullBlender::SetSrcFactor(BlendFactor factor)
+	{
+		nullGraphicsContext::Record().blendChanges++;
+	}
+
+	void nullBlender::SetDstFactor(BlendFactor factor)
+	{
+		nullGraphicsContext::Record().blendChanges++;
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "Core/Core.h"
+
+#include "Renderer/Blender.h"
+
+namespace Light {
+
+	class nullBlender : public Blender
+	{
+	public:
+		nullBlender();
+
+		void Enable() override;
+		void Disable() override;
+
+		void SetSrcFactor(BlendFactor factor) override;
+		void SetDstFactor(BlendFactor factor) override;
+	};
+
+}
\ No newline at end of file
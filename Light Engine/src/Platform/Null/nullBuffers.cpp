@@ -0,0 +1,121 @@
+#include "ltpch.h"
+#include "nullBuffers.h"
+#include "nullGraphicsContext.h"
+
+#include <cstring>
+
+namespace Light {
+
+	// ConstantBuffer //
+	nullConstantBuffer::nullConstantBuffer(ConstantBufferIndex index, unsigned int size)
+		: m_Data(size, 0u)
+	{
+		LT_PROFILE_FUNC();
+		Bind();
+	}
+
+	void nullConstantBuffer::Bind()
+	{
+		nullGraphicsContext::Record().bufferBinds++;
+	}
+
+	void* nullConstantBuffer::Map()
+	{
+		return m_Data.data();
+	}
+
+	void nullConstantBuffer::UnMap()
+	{
+		nullGraphicsContext::Record().bytesMapped += m_Data.size();
+	}
+
+	// VertexBuffer //
+	nullVertexBuffer::nullVertexBuffer(float* vertices, unsigned int size)
+		: m_Data(size, 0u)
+	{
+		LT_PROFILE_FUNC();
+
+		if (vertices)
+		{
+			std::memcpy(m_Data.data(), vertices, size);
+			nullGraphicsContext::Record().bytesUpdated += size;
+		}
+	}
+
+	void nullVertexBuffer::Bind()
+	{
+		nullGraphicsContext::Record().bufferBinds++;
+	}
+
+	void* nullVertexBuffer::Map()
+	{
+		return m_Data.data();
+	}
+
+	void nullVertexBuffer::UnMap()
+	{
+		nullGraphicsContext::Record().bytesMapped += m_Data.size();
+	}
+
+	void nullVertexBuffer::Update(const void* data, unsigned int offset, unsigned int size)
+	{
+		LT_CORE_ASSERT(offset + size <= m_Data.size(), "nullVertexBuffer::Update: out of bounds: {} + {} > {}", offset, size, m_Data.size());
+
+		std::memcpy(m_Data.data() + offset, data, size);
+		nullGraphicsContext::Record().bytesUpdated += size;
+	}
+
+	// StreamVertexBuffer //
+	nullStreamVertexBuffer::nullStreamVertexBuffer(unsigned int stride, unsigned int count)
+		: StreamVertexBuffer(stride, count), m_Data((size_t)stride * count * LT_FRAMES_IN_FLIGHT, 0u), m_MappedCursor(0u)
+	{
+		LT_PROFILE_FUNC();
+	}
+
+	void nullStreamVertexBuffer::Bind()
+	{
+		nullGraphicsContext::Record().bufferBinds++;
+	}
+
+	void* nullStreamVertexBuffer::Map()
+	{
+		// the previous map is committed by now
+		RecordCommitted();
+		return m_Data.data() + (size_t)GetFirstVertex() * m_Stride;
+	}
+
+	void nullStreamVertexBuffer::UnMap()
+	{
+	}
+
+	void nullStreamVertexBuffer::EndFrame()
+	{
+		RecordCommitted();
+
+		AdvanceRegion();
+		m_MappedCursor = 0u;
+	}
+
+	void nullStreamVertexBuffer::RecordCommitted()
+	{
+		nullGraphicsContext::Record().bytesMapped += (uint64_t)(m_Cursor - m_MappedCursor) * m_Stride;
+		m_MappedCursor = m_Cursor;
+	}
+
+	// IndexBuffer //
+	nullIndexBuffer::nullIndexBuffer(unsigned int* indices, unsigned int count, IndexFormat format)
+	{
+		LT_PROFILE_FUNC();
+
+		LT_CORE_ASSERT(indices || count % 6 == 0, "nullIndexBuffer::nullIndexBuffer: indices can only be null if count is multiple of 6");
+
+		m_Format = format;
+		nullGraphicsContext::Record().bytesUpdated += (uint64_t)count * (format == IndexFormat::UInt16 ? sizeof(uint16_t) : sizeof(uint32_t));
+	}
+
+	void nullIndexBuffer::Bind()
+	{
+		nullGraphicsContext::Record().bufferBinds++;
+	}
+
+}
\ No newline at end of file
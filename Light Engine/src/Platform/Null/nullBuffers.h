@@ -0,0 +1,68 @@
+#pragma once
+
+#include "Core/Core.h"
+
+#include "Renderer/Buffers.h"
+
+namespace Light {
+
+	// buffers are host memory nothing reads from, Map hands out the memory and UnMap records the bytes as written
+
+	class nullConstantBuffer : public ConstantBuffer
+	{
+	private:
+		std::vector<uint8_t> m_Data;
+	public:
+		nullConstantBuffer(ConstantBufferIndex index, unsigned int size);
+
+		void Bind() override;
+
+		void* Map() override;
+		void UnMap() override;
+	};
+
+	class nullVertexBuffer : public VertexBuffer
+	{
+	private:
+		std::vector<uint8_t> m_Data;
+	public:
+		nullVertexBuffer(float* vertices, unsigned int size);
+
+		void Bind() override;
+
+		void* Map() override;
+		void UnMap() override;
+
+		void Update(const void* data, unsigned int offset, unsigned int size) override;
+	};
+
+	// only the committed vertices are recorded as written, Map hands out the whole rest of the region
+	class nullStreamVertexBuffer : public StreamVertexBuffer
+	{
+	private:
+		std::vector<uint8_t> m_Data;
+
+		// the cursor of the region when it was last mapped
+		unsigned int m_MappedCursor;
+	public:
+		nullStreamVertexBuffer(unsigned int stride, unsigned int count);
+
+		void Bind() override;
+
+		void* Map() override;
+		void UnMap() override;
+
+		void EndFrame() override;
+	private:
+		void RecordCommitted();
+	};
+
+	class nullIndexBuffer : public IndexBuffer
+	{
+	public:
+		nullIndexBuffer(unsigned int* indices, unsigned int count, IndexFormat format);
+
+		void Bind() override;
+	};
+
+}
\ No newline at end of file
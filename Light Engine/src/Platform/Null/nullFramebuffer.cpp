@@ -0,0 +1,26 @@
+#include "ltpch.h"
+#include "nullFramebuffer.h"
+#include "nullGraphicsContext.h"
+
+namespace Light {
+
+	nullFramebuffer::nullFramebuffer(unsigned int width, unsigned int height, FramebufferFormat format)
+		: Framebuffer(width, height, format)
+	{
+		LT_PROFILE_FUNC();
+	}
+
+	void nullFramebuffer::BindAsTarget(bool clear /*= false*/)
+	{
+		nullGraphicsContext::Record().targetBinds++;
+
+		if (clear)
+			nullGraphicsContext::Record().clears++;
+	}
+
+	void nullFramebuffer::BindAsResource(TextureBindingSlot slot /*= BINDING_FRAMEBUFFER0*/)
+	{
+		nullGraphicsContext::Record().textureBinds++;
+	}
+
+}
\ No newline at end of file
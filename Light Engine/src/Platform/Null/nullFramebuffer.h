@@ -0,0 +1,18 @@
+#pragma once
+
+#include "Core/Core.h"
+
+#include "Renderer/Framebuffer.h"
+
+namespace Light {
+
+	class nullFramebuffer : public Framebuffer
+	{
+	public:
+		nullFramebuffer(unsigned int width, unsigned int height, FramebufferFormat format);
+
+		void BindAsTarget(bool clear = false) override;
+		void BindAsResource(TextureBindingSlot slot = BINDING_FRAMEBUFFER0) override;
+	};
+
+}
\ No newline at end of file
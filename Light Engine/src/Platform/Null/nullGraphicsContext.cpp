@@ -0,0 +1,121 @@
+#include "ltpch.h"
+#include "nullGraphicsContext.h"
+
+namespace Light {
+
+	nullStats& nullStats::operator+=(const nullStats& other)
+	{
+		frames        += other.frames;
+
+		drawCalls     += other.drawCalls;
+		vertices      += other.vertices;
+		indices       += other.indices;
+		instances     += other.instances;
+
+		bytesMapped   += other.bytesMapped;
+		bytesUpdated  += other.bytesUpdated;
+		bytesUploaded += other.bytesUploaded;
+
+		shaderBinds   += other.shaderBinds;
+		layoutBinds   += other.layoutBinds;
+		bufferBinds   += other.bufferBinds;
+		textureBinds  += other.textureBinds;
+		targetBinds   += other.targetBinds;
+		blendChanges  += other.blendChanges;
+		clears        += other.clears;
+
+		return *this;
+	}
+
+	nullGraphicsContext* nullGraphicsContext::s_Instance = nullptr;
+
+	nullGraphicsContext::nullGraphicsContext(const GraphicsConfigurations& configurations)
+	{
+		LT_PROFILE_FUNC();
+
+		LT_CORE_ASSERT(!s_Instance, "nullGraphicsContext::nullGraphicsContext: multiple nullGraphicsContext instances");
+		s_Instance = this;
+
+		m_Configurations = configurations;
+
+		// set configurations
+		SetConfigurations(configurations);
+
+		LT_CORE_INFO("nullGraphicsContext:");
+		LT_CORE_INFO("        Draw calls are recorded, not executed");
+	}
+
+	nullGraphicsContext::~nullGraphicsContext()
+	{
+		LT_PROFILE_FUNC();
+
+		LT_CORE_INFO("nullGraphicsContext: {} frames, {} draw calls, {} bytes mapped", m_Total.frames, m_Total.drawCalls, m_Total.bytesMapped);
+		s_Instance = nullptr;
+	}
+
+	void nullGraphicsContext::SwapBuffers()
+	{
+		m_Frame.frames = 1u;
+
+		m_Total += m_Frame;
+		m_LastFrame = m_Frame;
+		m_Frame = nullStats();
+	}
+
+	void nullGraphicsContext::ClearBackbuffer(float colors[4])
+	{
+		m_Frame.clears++;
+	}
+
+	void nullGraphicsContext::Draw(unsigned int count)
+	{
+		m_Frame.drawCalls++;
+		m_Frame.vertices += count;
+	}
+
+	void nullGraphicsContext::DrawIndexed(unsigned int count, unsigned int offset, unsigned int baseVertex)
+	{
+		m_Frame.drawCalls++;
+		m_Frame.indices += count;
+	}
+
+	void nullGraphicsContext::DrawInstanced(unsigned int vertexCount, unsigned int instanceCount, unsigned int firstInstance)
+	{
+		m_Frame.drawCalls++;
+		m_Frame.vertices += (uint64_t)vertexCount * instanceCount;
+		m_Frame.instances += instanceCount;
+	}
+
+	void nullGraphicsContext::DefaultRenderBuffer()
+	{
+		m_Frame.targetBinds++;
+	}
+
+	void nullGraphicsContext::SetConfigurations(const GraphicsConfigurations& configurations)
+	{
+		LT_PROFILE_FUNC();
+
+		SetResolution(configurations.resolution);
+		SetVSync(configurations.vSync);
+	}
+
+	void nullGraphicsContext::SetResolution(const Resolution& resolution)
+	{
+		// there's nothing to resize, the window is left as it is
+		m_Configurations.resolution = resolution;
+	}
+
+	void nullGraphicsContext::SetVSync(bool vSync)
+	{
+		// SwapBuffers never waits, frames are only limited by the application
+		m_Configurations.vSync = vSync;
+	}
+
+	void nullGraphicsContext::ResetStats()
+	{
+		s_Instance->m_Frame = nullStats();
+		s_Instance->m_LastFrame = nullStats();
+		s_Instance->m_Total = nullStats();
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "Core/Core.h"
+
+#include "Renderer/GraphicsContext.h"
+
+namespace Light {
+
+	// what the graphics api would have been asked to do
+	struct nullStats
+	{
+		uint64_t frames = 0u;
+
+		// draw calls
+		uint64_t drawCalls = 0u;
+		uint64_t vertices = 0u;  // Draw, and vertexCount * instanceCount of DrawInstanced
+		uint64_t indices = 0u;   // DrawIndexed
+		uint64_t instances = 0u; // DrawInstanced
+
+		// bytes written to buffers through Map (committed vertices for stream buffers), with Update, and to textures
+		uint64_t bytesMapped = 0u;
+		uint64_t bytesUpdated = 0u;
+		uint64_t bytesUploaded = 0u;
+
+		// state
+		uint64_t shaderBinds = 0u;
+		uint64_t layoutBinds = 0u;
+		uint64_t bufferBinds = 0u;
+		uint64_t textureBinds = 0u;
+		uint64_t targetBinds = 0u;
+		uint64_t blendChanges = 0u;
+		uint64_t clears = 0u;
+
+		nullStats& operator+=(const nullStats& other);
+	};
+
+	// executes nothing, the objects it creates are host memory and the calls made on them are counted
+	// the cpu side of the engine runs as it would with the other apis, without the driver and with nothing to wait on
+	class nullGraphicsContext : public GraphicsContext
+	{
+	private:
+		static nullGraphicsContext* s_Instance;
+
+		nullStats m_Frame, m_LastFrame, m_Total;
+	public:
+		nullGraphicsContext(const GraphicsConfigurations& configurations);
+		~nullGraphicsContext();
+
+		void SwapBuffers() override;
+
+		void ClearBackbuffer(float colors[4]) override;
+
+		void Draw(unsigned int count) override;
+		void DrawIndexed(unsigned int count, unsigned int offset, unsigned int baseVertex) override;
+		void DrawInstanced(unsigned int vertexCount, unsigned int instanceCount, unsigned int firstInstance) override;
+
+		void DefaultRenderBuffer() override;
+
+		// setters
+		void SetConfigurations(const GraphicsConfigurations& configurations) override;
+		void SetResolution(const Resolution& resolution) override;
+		void SetVSync(bool vSync) override;
+
+		// the counters of the frame being recorded, objects of the context add to them
+		static inline nullStats& Record() { return s_Instance->m_Frame; }
+
+		// clears the counters of every frame, the one being recorded included
+		static void ResetStats();
+
+		// getters
+		// the last frame finished by SwapBuffers
+		static inline const nullStats& GetFrameStats() { return s_Instance->m_LastFrame; }
+
+		// every frame finished since the context was created or ResetStats was called
+		static inline const nullStats& GetTotalStats() { return s_Instance->m_Total; }
+	};
+
+}
\ No newline at end of file
@@ -0,0 +1,28 @@
+#include "ltpch.h"
+#include "nullMSAA.h"
+#include "nullGraphicsContext.h"
+
+namespace Light {
+
+	nullMSAA::nullMSAA(unsigned int samples)
+	{
+		LT_PROFILE_FUNC();
+	}
+
+	void nullMSAA::BindFrameBuffer()
+	{
+		// cleared on bind, like the other apis
+		nullGraphicsContext::Record().targetBinds++;
+		nullGraphicsContext::Record().clears++;
+	}
+
+	void nullMSAA::Resolve()
+	{
+		// a blit, not a draw call
+	}
+
+	void nullMSAA::Resize(unsigned int width, unsigned int height)
+	{
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "Core/Core.h"
+
+#include "Renderer/MSAA.h"
+
+namespace Light {
+
+	class nullMSAA : public MSAA
+	{
+	public:
+		nullMSAA(unsigned int samples);
+
+		void BindFrameBuffer() override;
+
+		void Resolve() override;
+
+		void Resize(unsigned int width, unsigned int height) override;
+	};
+
+}
\ No newline at end of file
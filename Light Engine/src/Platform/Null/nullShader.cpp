@@ -0,0 +1,83 @@
+#include "ltpch.h"
+#include "nullShader.h"
+#include "nullGraphicsContext.h"
+
+namespace Light {
+
+	nullShader::nullShader(const std::string& vertexSource)
+	{
+		LT_PROFILE_FUNC();
+		ExtractVertexElements(vertexSource);
+	}
+
+	void nullShader::Bind()
+	{
+		nullGraphicsContext::Record().shaderBinds++;
+	}
+
+	void nullShader::ExtractVertexElements(const std::string& vertexSource)
+	{
+		LT_PROFILE_FUNC();
+
+		std::stringstream stream(vertexSource.substr(0, vertexSource.find("void main()")));
+		std::string line;
+
+		while (std::getline(stream, line))
+		{
+			if (line.find("layout(location") != std::string::npos)
+			{
+				line = line.substr(line.find("in") + 3);
+				std::string type = line.substr(0, line.find(' '));
+				std::string name = line.substr(line.find(' ') + 1, line.find(';') - line.find(' ') - 1);
+
+				m_Elements.push_back({name, GetVertexElementType(type.c_str())});
+			}
+		}
+	}
+
+	VertexElementType nullShader::GetVertexElementType(const char* typeName)
+	{
+		switch (hashStr(typeName))
+		{
+		case hashStr("int"):       return VertexElementType::Int;
+		case hashStr("ivec2"):     return VertexElementType::Int2;
+		case hashStr("ivec3"):     return VertexElementType::Int3;
+		case hashStr("ivec4"):     return VertexElementType::Int4;
+
+		case hashStr("uint"):      return VertexElementType::UInt;
+		case hashStr("uvec2"):     return VertexElementType::UInt2;
+		case hashStr("uvec3"):     return VertexElementType::UInt3;
+		case hashStr("uvec4"):     return VertexElementType::UInt4;
+
+		case hashStr("float"):     return VertexElementType::Float;
+		case hashStr("vec2"):      return VertexElementType::Float2;
+		case hashStr("vec3"):      return VertexElementType::Float3;
+		case hashStr("vec4"):      return VertexElementType::Float4;
+
+		case hashStr("double"):    return VertexElementType::Double;
+		case hashStr("dvec2"):     return VertexElementType::Double2;
+		case hashStr("dvec3"):     return VertexElementType::Double3;
+		case hashStr("dvec4"):     return VertexElementType::Double4;
+
+		default: LT_CORE_ASSERT(false, "nullShader::GetElementType: invalid typeName");
+		}
+	}
+
+	std::string nullShaderCompiler::GetDeviceName()
+	{
+		return "null";
+	}
+
+	std::shared_ptr<Shader> nullShaderCompiler::Compile(const std::string& vertexSource, const std::string& fragmentSource, std::vector<uint8_t>& binary)
+	{
+		LT_PROFILE_FUNC();
+		return std::make_shared<nullShader>(vertexSource);
+	}
+
+	std::shared_ptr<Shader> nullShaderCompiler::Load(const std::string& vertexSource, const std::string& fragmentSource, const std::vector<uint8_t>& binary)
+	{
+		// nothing is ever saved
+		return nullptr;
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "Core/Core.h"
+
+#include "Renderer/Shader.h"
+#include "Renderer/ShaderCache.h"
+
+namespace Light {
+
+	// the GLSL sections aren't compiled, only the vertex inputs are read for the renderer's layouts
+	class nullShader : public Shader
+	{
+	public:
+		nullShader(const std::string& vertexSource);
+
+		void Bind() override;
+	private:
+		void ExtractVertexElements(const std::string& vertexSource);
+
+		VertexElementType GetVertexElementType(const char* typeName);
+	};
+
+	class nullShaderCompiler : public ShaderCompiler
+	{
+	public:
+		std::string GetDeviceName() override;
+
+		// there's nothing to keep, the binary is left empty
+		std::shared_ptr<Shader> Compile(const std::string& vertexSource, const std::string& fragmentSource, std::vector<uint8_t>& binary) override;
+
+		std::shared_ptr<Shader> Load(const std::string& vertexSource, const std::string& fragmentSource, const std::vector<uint8_t>& binary) override;
+	};
+
+}
\ No newline at end of file
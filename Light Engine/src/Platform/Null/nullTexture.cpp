@@ -0,0 +1,29 @@
+#include "ltpch.h"
+#include "nullTexture.h"
+#include "nullGraphicsContext.h"
+
+namespace Light {
+
+	nullTextureArray::nullTextureArray(unsigned int width, unsigned int height, unsigned int depth, unsigned int channels)
+		: TextureArray(width, height, depth, channels)
+	{
+		LT_PROFILE_FUNC();
+		LT_CORE_ASSERT(channels == 4 || channels == 2 || channels == 1, "nullTextureArray::nullTextureArray: invalid number of channels: {}", channels);
+	}
+
+	void nullTextureArray::Bind(unsigned int slot /* = 0 */)
+	{
+		nullGraphicsContext::Record().textureBinds++;
+	}
+
+	void nullTextureArray::UploadRegion(unsigned int slice, unsigned int level, const ImageRegion& region, const void* pixels)
+	{
+		nullGraphicsContext::Record().bytesUploaded += (uint64_t)region.width * region.height * m_Channels;
+	}
+
+	void nullTextureArray::CopyRegion(unsigned int sourceSlice, unsigned int slice, unsigned int level, const ImageRegion& source, unsigned int x, unsigned int y)
+	{
+		nullGraphicsContext::Record().bytesUploaded += (uint64_t)source.width * source.height * m_Channels;
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "Core/Core.h"
+
+#include "Renderer/Texture.h"
+
+namespace Light {
+
+	// keeps no pixels, uploads and copies are only recorded
+	class nullTextureArray : public TextureArray
+	{
+	public:
+		nullTextureArray(unsigned int width, unsigned int height, unsigned int depth, unsigned int channels);
+
+		void Bind(unsigned int slot = 0) override;
+	private:
+		void UploadRegion(unsigned int slice, unsigned int level, const ImageRegion& region, const void* pixels) override;
+
+		void CopyRegion(unsigned int sourceSlice, unsigned int slice, unsigned int level, const ImageRegion& source, unsigned int x, unsigned int y) override;
+	};
+
+}
\ No newline at end of file
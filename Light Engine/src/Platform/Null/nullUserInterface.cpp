@@ -0,0 +1,81 @@
+#include "ltpch.h"
+#include "nullUserInterface.h"
+#include "nullGraphicsContext.h"
+
+#include "Core/Window.h"
+
+#include <imgui.h>
+#include <imgui_impl_glfw.h>
+
+namespace Light {
+
+	nullUserInterface::nullUserInterface()
+	{
+		LT_PROFILE_FUNC();
+
+		// setup ImGui's context
+		IMGUI_CHECKVERSION();
+		ImGui::CreateContext();
+		ImGuiIO& io = ImGui::GetIO();
+		io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard; // enable keyboard controls
+		io.ConfigFlags |= ImGuiConfigFlags_NavEnableGamepad;  // enable gamepad controls
+		io.ConfigFlags |= ImGuiConfigFlags_NoMouseCursorChange;  // disable mouse cursor change
+
+		io.BackendRendererName = "LightEngine_Null";
+		io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;
+
+		// setup ImGui's style
+		ImGui::StyleColorsDark();
+
+		ImGuiStyle& style = ImGui::GetStyle();
+		style.WindowRounding = 0.0f;
+		style.Colors[ImGuiCol_WindowBg].w = 1.0f;
+
+		// setup platform bindings, the vulkan init doesn't touch any graphics api
+		ImGui_ImplGlfw_InitForVulkan(Window::GetGlfwHandle(), false);
+
+		// font atlas, built but never sampled
+		unsigned char* pixels;
+		int width, height;
+		io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+
+		nullGraphicsContext::Record().bytesUploaded += (uint64_t)width * height * 4u;
+	}
+
+	nullUserInterface::~nullUserInterface()
+	{
+		LT_PROFILE_FUNC();
+
+		ImGui_ImplGlfw_Shutdown();
+		ImGui::DestroyContext();
+	}
+
+	void nullUserInterface::Begin()
+	{
+		ImGui_ImplGlfw_NewFrame();
+		ImGui::NewFrame();
+	}
+
+	void nullUserInterface::Draw(ImDrawData* drawData)
+	{
+		LT_PROFILE_FUNC();
+
+		// what a backend would upload and draw
+		nullStats& stats = nullGraphicsContext::Record();
+		stats.bytesMapped += (uint64_t)drawData->TotalVtxCount * sizeof(ImDrawVert) + (uint64_t)drawData->TotalIdxCount * sizeof(ImDrawIdx);
+
+		for (int i = 0; i < drawData->CmdListsCount; i++)
+		{
+			for (const ImDrawCmd& command : drawData->CmdLists[i]->CmdBuffer)
+			{
+				// callbacks may expect a graphics api, they aren't run
+				if (command.UserCallback)
+					continue;
+
+				stats.drawCalls++;
+				stats.indices += command.ElemCount;
+			}
+		}
+	}
+
+}
\ No newline at end of file
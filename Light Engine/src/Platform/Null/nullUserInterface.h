@@ -0,0 +1,20 @@
+#pragma once
+
+#include "Core/Core.h"
+
+#include "UserInterface/UserInterface.h"
+
+namespace Light {
+
+	// ImGui's frames are built as usual, the draw lists are recorded and dropped
+	class nullUserInterface : public UserInterface
+	{
+	public:
+		nullUserInterface();
+		~nullUserInterface();
+
+		void Begin() override;
+		void Draw(ImDrawData* drawData) override;
+	};
+
+}
\ No newline at end of file
@@ -0,0 +1,17 @@
+#include "ltpch.h"
+#include "nullVertexLayout.h"
+#include "nullGraphicsContext.h"
+
+namespace Light {
+
+	nullVertexLayout::nullVertexLayout()
+	{
+		LT_PROFILE_FUNC();
+	}
+
+	void nullVertexLayout::Bind()
+	{
+		nullGraphicsContext::Record().layoutBinds++;
+	}
+
+}
\ No newline at end of file
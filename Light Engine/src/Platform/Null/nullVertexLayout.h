@@ -0,0 +1,18 @@
+#pragma once
+
+#include "Core/Core.h"
+
+#include "Renderer/VertexLayout.h"
+
+namespace Light {
+
+	// there is nothing to fetch the vertices, binding it is only recorded
+	class nullVertexLayout : public VertexLayout
+	{
+	public:
+		nullVertexLayout();
+
+		void Bind() override;
+	};
+
+}
\ No newline at end of file
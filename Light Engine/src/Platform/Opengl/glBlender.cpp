@@ -34,11 +34,13 @@ namespace Light {
 
 	void glBlender::Enable()
 	{
+		b_Enabled = true;
 		glEnable(GL_BLEND);
 	}
 
 	void glBlender::Disable()
 	{
+		b_Enabled = false;
 		glDisable(GL_BLEND);
 	}
 
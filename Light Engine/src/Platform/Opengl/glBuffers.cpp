@@ -7,7 +7,7 @@ namespace Light {
 
 	// ConstantBuffer //
 	glConstantBuffer::glConstantBuffer(ConstantBufferIndex index, unsigned int size)
-		: m_Index(index)
+		: m_Index(index), m_Size(size)
 	{
 		LT_PROFILE_FUNC();
 
@@ -30,7 +30,8 @@ namespace Light {
 
 	void* glConstantBuffer::Map()
 	{
-		return glMapNamedBuffer(m_BufferID, GL_WRITE_ONLY);
+		// invalidating lets the driver orphan the storage instead of waiting for draws that still read it
+		return glMapNamedBufferRange(m_BufferID, 0, m_Size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
 	}
 
 	void glConstantBuffer::UnMap()
@@ -39,12 +40,12 @@ namespace Light {
 	}
 
 	// VertexBuffer //
-	glVertexBuffer::glVertexBuffer(float* vertices, unsigned int size)
+	glVertexBuffer::glVertexBuffer(float* vertices, unsigned int size, BufferUsage usage)
 	{
 		LT_PROFILE_FUNC();
 
 		glCreateBuffers(1, &m_BufferID);
-		glNamedBufferData(m_BufferID, size, vertices, GL_DYNAMIC_DRAW);
+		glNamedBufferData(m_BufferID, size, vertices, usage == BufferUsage::Static ? GL_STATIC_DRAW : GL_DYNAMIC_DRAW);
 	}
 
 	glVertexBuffer::~glVertexBuffer()
@@ -68,11 +69,84 @@ namespace Light {
 		glUnmapNamedBuffer(m_BufferID);
 	}
 
+	void glVertexBuffer::Update(const void* data, unsigned int offset, unsigned int size)
+	{
+		glNamedBufferSubData(m_BufferID, offset, size, data);
+	}
+
+	// StreamVertexBuffer //
+	glStreamVertexBuffer::glStreamVertexBuffer(unsigned int stride, unsigned int count)
+		: StreamVertexBuffer(stride, count)
+	{
+		LT_PROFILE_FUNC();
+
+		const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+		const GLsizeiptr size = (GLsizeiptr)stride * count * LT_FRAMES_IN_FLIGHT;
+
+		glCreateBuffers(1, &m_BufferID);
+		glNamedBufferStorage(m_BufferID, size, NULL, flags);
+
+		m_Map = (uint8_t*)glMapNamedBufferRange(m_BufferID, 0, size, flags);
+		LT_CORE_ASSERT(m_Map, "glStreamVertexBuffer::glStreamVertexBuffer: failed to map buffer persistently");
+	}
+
+	glStreamVertexBuffer::~glStreamVertexBuffer()
+	{
+		LT_PROFILE_FUNC();
+
+		for (void* fence : m_Fences)
+			if (fence)
+				glDeleteSync((GLsync)fence);
+
+		glUnmapNamedBuffer(m_BufferID);
+		glDeleteBuffers(1, &m_BufferID);
+	}
+
+	void glStreamVertexBuffer::Bind()
+	{
+		glBindBuffer(GL_ARRAY_BUFFER, m_BufferID);
+	}
+
+	void* glStreamVertexBuffer::Map()
+	{
+		// wait for the GPU to finish reading the region, only blocks if it is LT_FRAMES_IN_FLIGHT frames behind
+		if (m_Fences[m_Region])
+		{
+			LT_PROFILE_SCOPE("glStreamVertexBuffer::Map::ClientWaitSync");
+
+			GLsync fence = (GLsync)m_Fences[m_Region];
+			while (glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000u) == GL_TIMEOUT_EXPIRED);
+
+			glDeleteSync(fence);
+			m_Fences[m_Region] = nullptr;
+		}
+
+		return m_Map + (size_t)GetFirstVertex() * m_Stride;
+	}
+
+	void glStreamVertexBuffer::UnMap()
+	{
+		// coherent mapping, writes are visible to the GPU without unmapping
+	}
+
+	void glStreamVertexBuffer::EndFrame()
+	{
+		if (m_Fences[m_Region])
+			glDeleteSync((GLsync)m_Fences[m_Region]);
+
+		m_Fences[m_Region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		AdvanceRegion();
+	}
+
 	// IndexBuffer //
-	glIndexBuffer::glIndexBuffer(unsigned int* indices, unsigned int count)
+	IndexFormat glIndexBuffer::s_BoundFormat = IndexFormat::UInt32;
+
+	glIndexBuffer::glIndexBuffer(unsigned int* indices, unsigned int count, IndexFormat format)
 	{
 		LT_PROFILE_FUNC();
 
+		m_Format = format;
+
 		bool noIndices = false;
 		if (!indices)
 		{
@@ -97,7 +171,20 @@ namespace Light {
 		}
 
 		glCreateBuffers(1, &m_BufferID);
-		glNamedBufferData(m_BufferID, count * sizeof(unsigned int), indices, GL_STATIC_DRAW);
+
+		if (format == IndexFormat::UInt16)
+		{
+			std::vector<uint16_t> shortIndices(count);
+			for (unsigned int i = 0; i < count; i++)
+			{
+				LT_CORE_ASSERT(indices[i] <= UINT16_MAX, "glIndexBuffer::glIndexBuffer: index '{}' does not fit in 16 bits", indices[i]);
+				shortIndices[i] = (uint16_t)indices[i];
+			}
+
+			glNamedBufferData(m_BufferID, count * sizeof(uint16_t), shortIndices.data(), GL_STATIC_DRAW);
+		}
+		else
+			glNamedBufferData(m_BufferID, count * sizeof(unsigned int), indices, GL_STATIC_DRAW);
 
 		if (noIndices)
 		{
@@ -114,6 +201,7 @@ namespace Light {
 
 	void glIndexBuffer::Bind()
 	{
+		s_BoundFormat = m_Format;
 		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_BufferID);
 	}
 
@@ -11,6 +11,7 @@ namespace Light {
 	private:
 		unsigned int m_BufferID;
 		unsigned int m_Index;
+		unsigned int m_Size;
 	public:
 		glConstantBuffer(ConstantBufferIndex index, unsigned int size);
 		~glConstantBuffer();
@@ -26,24 +27,51 @@ namespace Light {
 	private:
 		unsigned int m_BufferID;
 	public:
-		glVertexBuffer(float* vertices, unsigned int size);
+		glVertexBuffer(float* vertices, unsigned int size, BufferUsage usage);
 		~glVertexBuffer();
 
 		void Bind() override;
 
 		void* Map() override;
 		void UnMap() override;
+
+		void Update(const void* data, unsigned int offset, unsigned int size) override;
+	};
+
+	// persistently and coherently mapped, regions are guarded by fences
+	class glStreamVertexBuffer : public StreamVertexBuffer
+	{
+	private:
+		unsigned int m_BufferID;
+		uint8_t* m_Map;
+
+		void* m_Fences[LT_FRAMES_IN_FLIGHT] = {}; // GLsync
+	public:
+		glStreamVertexBuffer(unsigned int stride, unsigned int count);
+		~glStreamVertexBuffer();
+
+		void Bind() override;
+
+		void* Map() override;
+		void UnMap() override;
+
+		void EndFrame() override;
 	};
 
 	class glIndexBuffer : public IndexBuffer
 	{
 	private:
+		static IndexFormat s_BoundFormat;
+
 		unsigned int m_BufferID;
 	public:
-		glIndexBuffer(unsigned int* indices, unsigned int count);
+		glIndexBuffer(unsigned int* indices, unsigned int count, IndexFormat format);
 		~glIndexBuffer();
 
 		void Bind() override;
+
+		// glDrawElements needs the index type of the bound buffer
+		static inline IndexFormat GetBoundFormat() { return s_BoundFormat; }
 	};
 
 }
\ No newline at end of file
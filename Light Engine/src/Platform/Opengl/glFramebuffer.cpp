@@ -5,36 +5,27 @@
 
 namespace Light {
 
-	glFramebuffer::glFramebuffer(const std::string& vertex, const std::string& fragment, unsigned int width, unsigned int height, TextureBindingSlot slot)
-		: m_BindingSlot(slot)
+	glFramebuffer::glFramebuffer(unsigned int width, unsigned int height, FramebufferFormat format)
+		: Framebuffer(width, height, format)
 	{
 		LT_PROFILE_FUNC();
 
-		m_Shader = Shader::Create(vertex, fragment);
-
 		// create framebuffer and color texture
 		glCreateFramebuffers(1, &m_BufferID);
 		glCreateTextures(GL_TEXTURE_2D, 1, &m_TextureID);
 
-		// bind framebuffer and color texture
-		glBindFramebuffer(GL_FRAMEBUFFER, m_BufferID);
-		glBindTexture(GL_TEXTURE_2D, m_TextureID);
-
+		glTextureStorage2D(m_TextureID, 1, format == FramebufferFormat::RGBA16F ? GL_RGBA16F : GL_RGBA8, width, height);
 
-		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, NULL, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+		glTextureParameteri(m_TextureID, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+		glTextureParameteri(m_TextureID, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+		glTextureParameteri(m_TextureID, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		glTextureParameteri(m_TextureID, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-
-		glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, m_TextureID, 0);
+		glNamedFramebufferTexture(m_BufferID, GL_COLOR_ATTACHMENT0, m_TextureID, 0);
 
 		// check
-		LT_CORE_ASSERT(glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE,
+		LT_CORE_ASSERT(glCheckNamedFramebufferStatus(m_BufferID, GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE,
 		               "glFramebuffer::glFramebuffer: framebuffer status is not complete");
-
-		glBindFramebuffer(GL_FRAMEBUFFER, 0);
 	}
 
 	glFramebuffer::~glFramebuffer()
@@ -45,29 +36,18 @@ namespace Light {
 		glDeleteFramebuffers(1, &m_BufferID);
 	}
 
-	void glFramebuffer::BindAsTarget()
+	void glFramebuffer::BindAsTarget(bool clear /*= false*/)
 	{
 		glBindFramebuffer(GL_FRAMEBUFFER, m_BufferID);
-		glClear(GL_COLOR_BUFFER_BIT);
-	}
+		glViewport(0, 0, m_Width, m_Height);
 
-	void glFramebuffer::BindAsResource()
-	{
-		m_Shader->Bind();
-
-		glActiveTexture(GL_TEXTURE0 + m_BindingSlot);
-		glBindTexture(GL_TEXTURE_2D, m_TextureID);
+		if (clear)
+			glClear(GL_COLOR_BUFFER_BIT);
 	}
 
-	void glFramebuffer::Resize(unsigned int width, unsigned int height)
+	void glFramebuffer::BindAsResource(TextureBindingSlot slot /*= BINDING_FRAMEBUFFER0*/)
 	{
-		LT_PROFILE_FUNC();
-
-		if (!width)
-			return;
-
-		glBindTexture(GL_TEXTURE_2D, m_TextureID);
-		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, NULL, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+		glBindTextureUnit(slot, m_TextureID);
 	}
 
 }
\ No newline at end of file
@@ -6,25 +6,17 @@
 
 namespace Light {
 
-	class Shader;
-
 	class glFramebuffer : public Framebuffer
 	{
 	private:
-		std::shared_ptr<Shader> m_Shader;
-
 		unsigned int m_BufferID;
 		unsigned int m_TextureID;
-
-		TextureBindingSlot m_BindingSlot;
 	public:
-		glFramebuffer(const std::string& vertex, const std::string& fragment, unsigned int width, unsigned int height, TextureBindingSlot slot);
+		glFramebuffer(unsigned int width, unsigned int height, FramebufferFormat format);
 		~glFramebuffer();
 
-		void BindAsTarget() override;
-		void BindAsResource() override;
-
-		void Resize(unsigned int width, unsigned int height) override;
+		void BindAsTarget(bool clear = false) override;
+		void BindAsResource(TextureBindingSlot slot = BINDING_FRAMEBUFFER0) override;
 	};
 
 }
\ No newline at end of file
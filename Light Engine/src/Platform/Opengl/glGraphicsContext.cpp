@@ -1,6 +1,8 @@
 #include "ltpch.h"
 #include "glGraphicsContext.h"
 
+#include "glBuffers.h"
+
 #include "Core/Monitor.h"
 #include "Core/Window.h"
 
@@ -39,6 +41,11 @@ namespace Light {
 		glfwSwapBuffers(m_WindowHandle);
 	}
 
+	void glGraphicsContext::MakeCurrent(bool current)
+	{
+		glfwMakeContextCurrent(current ? m_WindowHandle : nullptr);
+	}
+
 	void glGraphicsContext::ClearBackbuffer(float colors[4])
 	{
 		glClearColor(colors[0], colors[1], colors[2], colors[3]);
@@ -50,14 +57,25 @@ namespace Light {
 		glDrawArrays(GL_TRIANGLES, 0, count);
 	}
 
-	void glGraphicsContext::DrawIndexed(unsigned int count)
+	void glGraphicsContext::DrawIndexed(unsigned int count, unsigned int offset, unsigned int baseVertex)
 	{
-		glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_INT, nullptr);
+		if (glIndexBuffer::GetBoundFormat() == IndexFormat::UInt16)
+			glDrawElementsBaseVertex(GL_TRIANGLES, count, GL_UNSIGNED_SHORT, (const void*)(offset * sizeof(uint16_t)), baseVertex);
+		else
+			glDrawElementsBaseVertex(GL_TRIANGLES, count, GL_UNSIGNED_INT, (const void*)(offset * sizeof(unsigned int)), baseVertex);
+	}
+
+	void glGraphicsContext::DrawInstanced(unsigned int vertexCount, unsigned int instanceCount, unsigned int firstInstance)
+	{
+		glDrawArraysInstancedBaseInstance(GL_TRIANGLES, 0, vertexCount, instanceCount, firstInstance);
 	}
 
 	void glGraphicsContext::DefaultRenderBuffer()
 	{
 		glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+		// framebuffers set the viewport to their own size
+		glViewport(0, 0, m_Configurations.resolution.width, m_Configurations.resolution.height);
 	}
 
 	void glGraphicsContext::SetConfigurations(const GraphicsConfigurations& configurations)
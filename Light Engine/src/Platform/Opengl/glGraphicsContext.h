@@ -17,10 +17,13 @@ namespace Light {
 
 		void SwapBuffers() override;
 
+		void MakeCurrent(bool current) override;
+
 		void ClearBackbuffer(float colors[4]) override;
 
 		void Draw(unsigned int count) override;
-		void DrawIndexed(unsigned int count) override;
+		void DrawIndexed(unsigned int count, unsigned int offset, unsigned int baseVertex) override;
+		void DrawInstanced(unsigned int vertexCount, unsigned int instanceCount, unsigned int firstInstance) override;
 
 		void DefaultRenderBuffer() override;
 
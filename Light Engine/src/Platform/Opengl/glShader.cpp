@@ -3,6 +3,8 @@
 
 #include <glad/glad.h>
 
+#include <cstring>
+
 namespace Light {
 
 	std::unordered_map<std::string, TextureBindingSlot> glShader::s_TextureSlotsMap =
@@ -14,42 +16,12 @@ namespace Light {
 		LT_PAIR_TOKEN_NAME_TO_VALUE(BINDING_FRAMEBUFFER2),
 	};
 
-	glShader::glShader(const std::string& vertexSource, const std::string& fragmentSource)
+	glShader::glShader(unsigned int program, const std::string& vertexSource, const std::string& fragmentSource)
+		: m_ShaderID(program)
 	{
 		LT_PROFILE_FUNC();
 
-		// create program
-		m_ShaderID = glCreateProgram();
-
-		// store c_str() in local variables so then we can use '&' operator on them (address of operator requires an lvalue)
-		const char* lvs_source = vertexSource.c_str();
-		const char* lfs_source = fragmentSource.c_str();
-
-		// create shaders
-		unsigned int vs = glCreateShader(GL_VERTEX_SHADER);
-		glShaderSource(vs, 1, &lvs_source, nullptr);
-		glCompileShader(vs);
-
-		unsigned int fs = glCreateShader(GL_FRAGMENT_SHADER);
-		glShaderSource(fs, 1, &lfs_source, nullptr);
-		glCompileShader(fs);
-
-		// attach and link shaders to the program
-		glAttachShader(m_ShaderID, vs);
-		glAttachShader(m_ShaderID, fs);
-		glLinkProgram(m_ShaderID);
-
-		// delete the shaders
-		glDeleteShader(vs);
-		glDeleteShader(fs);
-
-		// verify link status
-		int linkStatus;
-		glGetProgramiv(m_ShaderID, GL_LINK_STATUS, &linkStatus);
-		LT_CORE_ASSERT(linkStatus, "glShader::glShader: failed to link glShader:\nvertexSource:\n{}\nfragmentSource:\n{}",
-		               vertexSource, fragmentSource);
-
-		// bind sampler2D(s) and sampler2D[](s) to the right slots
+		// bind sampler2D(s) and sampler2D[](s) to the right slots, loaded binaries don't keep uniform values
 		ExtractVertexElements(vertexSource);
 		AssignSamplersSlots(fragmentSource);
 	}
@@ -137,4 +109,87 @@ namespace Light {
 		}
 	}
 
+	std::string glShaderCompiler::GetDeviceName()
+	{
+		return std::string("opengl ") + (const char*)glGetString(GL_VENDOR) + ' ' + (const char*)glGetString(GL_RENDERER) + ' ' + (const char*)glGetString(GL_VERSION);
+	}
+
+	std::shared_ptr<Shader> glShaderCompiler::Compile(const std::string& vertexSource, const std::string& fragmentSource, std::vector<uint8_t>& binary)
+	{
+		LT_PROFILE_FUNC();
+
+		// create program
+		unsigned int program = glCreateProgram();
+		glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+
+		// store c_str() in local variables so then we can use '&' operator on them (address of operator requires an lvalue)
+		const char* lvs_source = vertexSource.c_str();
+		const char* lfs_source = fragmentSource.c_str();
+
+		// create shaders
+		unsigned int vs = glCreateShader(GL_VERTEX_SHADER);
+		glShaderSource(vs, 1, &lvs_source, nullptr);
+		glCompileShader(vs);
+
+		unsigned int fs = glCreateShader(GL_FRAGMENT_SHADER);
+		glShaderSource(fs, 1, &lfs_source, nullptr);
+		glCompileShader(fs);
+
+		// attach and link shaders to the program
+		glAttachShader(program, vs);
+		glAttachShader(program, fs);
+		glLinkProgram(program);
+
+		// delete the shaders
+		glDeleteShader(vs);
+		glDeleteShader(fs);
+
+		// verify link status
+		int linkStatus;
+		glGetProgramiv(program, GL_LINK_STATUS, &linkStatus);
+		LT_CORE_ASSERT(linkStatus, "glShaderCompiler::Compile: failed to link glShader:\nvertexSource:\n{}\nfragmentSource:\n{}",
+		               vertexSource, fragmentSource);
+
+		// the format is stored in front of the binary
+		int length = 0;
+		glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+
+		if (length > 0)
+		{
+			unsigned int format;
+
+			binary.resize(sizeof(format) + length);
+			glGetProgramBinary(program, length, nullptr, &format, binary.data() + sizeof(format));
+			std::memcpy(binary.data(), &format, sizeof(format));
+		}
+
+		return std::make_shared<glShader>(program, vertexSource, fragmentSource);
+	}
+
+	std::shared_ptr<Shader> glShaderCompiler::Load(const std::string& vertexSource, const std::string& fragmentSource, const std::vector<uint8_t>& binary)
+	{
+		LT_PROFILE_FUNC();
+
+		unsigned int format;
+		if (binary.size() <= sizeof(format))
+			return nullptr;
+
+		std::memcpy(&format, binary.data(), sizeof(format));
+
+		unsigned int program = glCreateProgram();
+		glProgramBinary(program, format, binary.data() + sizeof(format), binary.size() - sizeof(format));
+
+		// fails if the driver or the hardware changed since the binary was retrieved
+		int linkStatus;
+		glGetProgramiv(program, GL_LINK_STATUS, &linkStatus);
+
+		if (!linkStatus)
+		{
+			glDeleteProgram(program);
+			return nullptr;
+		}
+
+		return std::make_shared<glShader>(program, vertexSource, fragmentSource);
+	}
+
 }
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include "Core/Core.h"
 
 #include "Renderer/Shader.h"
+#include "Renderer/ShaderCache.h"
 
 namespace Light {
 
@@ -12,7 +13,8 @@ namespace Light {
 		static std::unordered_map<std::string, TextureBindingSlot> s_TextureSlotsMap;
 		unsigned int m_ShaderID;
 	public:
-		glShader(const std::string& vertexSource, const std::string& fragmentSource);
+		// takes ownership of a linked program
+		glShader(unsigned int program, const std::string& vertexSource, const std::string& fragmentSource);
 		~glShader();
 
 		void Bind() override;
@@ -23,4 +25,14 @@ namespace Light {
 		VertexElementType GetVertexElementType(const char* typeName);
 	};
 
+	class glShaderCompiler : public ShaderCompiler
+	{
+	public:
+		std::string GetDeviceName() override;
+
+		std::shared_ptr<Shader> Compile(const std::string& vertexSource, const std::string& fragmentSource, std::vector<uint8_t>& binary) override;
+
+		std::shared_ptr<Shader> Load(const std::string& vertexSource, const std::string& fragmentSource, const std::vector<uint8_t>& binary) override;
+	};
+
 }
\ No newline at end of file
@@ -29,7 +29,7 @@ namespace Light {
 		glTextureParameteri(m_TextureArrayID, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
 		glTextureParameteri(m_TextureArrayID, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 
-		glTextureStorage3D(m_TextureArrayID, std::log(std::max(width, height)) + 1, internalFormat, width, height, depth);
+		glTextureStorage3D(m_TextureArrayID, m_MipLevels, internalFormat, width, height, depth);
 	}
 
 	glTextureArray::~glTextureArray()
@@ -39,34 +39,28 @@ namespace Light {
 		glDeleteTextures(1, &m_TextureArrayID);
 	}
 
-	void glTextureArray::UpdateSubTexture(unsigned int xoffset, unsigned int yoffset, unsigned int zoffset, unsigned int width, unsigned int height, void* pixels)
+	void glTextureArray::Bind(unsigned int slot /* = 0 */) 
 	{
 		LT_PROFILE_FUNC();
 
-		glPixelStorei(GL_UNPACK_ALIGNMENT, m_Channels);
-		glTextureSubImage3D(m_TextureArrayID, 0, xoffset, yoffset, zoffset, width, height, 1, m_Format, GL_UNSIGNED_BYTE, pixels);
+		glActiveTexture(GL_TEXTURE0 + slot);
+		glBindTexture(GL_TEXTURE_2D_ARRAY, m_TextureArrayID);
 	}
 
-	void glTextureArray::UpdateSubTexture(const TextureCoordinates& uv, void* pixels)
+	void glTextureArray::UploadRegion(unsigned int slice, unsigned int level, const ImageRegion& region, const void* pixels)
 	{
 		LT_PROFILE_FUNC();
 
 		glPixelStorei(GL_UNPACK_ALIGNMENT, m_Channels);
-		glTextureSubImage3D(m_TextureArrayID, 0, uv.xMin, uv.yMin, uv.sliceIndex,
-		                                         uv.xMax - uv.xMin, uv.yMax - uv.yMin, 1, m_Format, GL_UNSIGNED_BYTE, pixels);
+		glTextureSubImage3D(m_TextureArrayID, level, region.x, region.y, slice, region.width, region.height, 1, m_Format, GL_UNSIGNED_BYTE, pixels);
 	}
 
-	void glTextureArray::GenerateMips()
+	void glTextureArray::CopyRegion(unsigned int sourceSlice, unsigned int slice, unsigned int level, const ImageRegion& source, unsigned int x, unsigned int y)
 	{
 		LT_PROFILE_FUNC();
-		glGenerateTextureMipmap(m_TextureArrayID);
-	}
 
-	void glTextureArray::Bind(unsigned int slot /* = 0 */) 
-	{
-		LT_PROFILE_FUNC();
-
-		glActiveTexture(GL_TEXTURE0 + slot);
-		glBindTexture(GL_TEXTURE_2D_ARRAY, m_TextureArrayID);
+		glCopyImageSubData(m_TextureArrayID, GL_TEXTURE_2D_ARRAY, level, source.x, source.y, sourceSlice,
+		                   m_TextureArrayID, GL_TEXTURE_2D_ARRAY, level, x, y, slice,
+		                   source.width, source.height, 1);
 	}
 }
\ No newline at end of file
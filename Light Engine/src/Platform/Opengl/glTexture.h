@@ -15,12 +15,11 @@ namespace Light {
 		glTextureArray(unsigned int width, unsigned int height, unsigned int depth, unsigned int channels);
 		~glTextureArray();
 
-		void UpdateSubTexture(unsigned int xoffset, unsigned int yoffset, unsigned int zoffset, unsigned int width, unsigned int height, void* pixels) override;
-		void UpdateSubTexture(const TextureCoordinates& uv, void* pixels) override;
-
-		void GenerateMips() override;
-
 		void Bind(unsigned int slot = 0) override;
+	private:
+		void UploadRegion(unsigned int slice, unsigned int level, const ImageRegion& region, const void* pixels) override;
+
+		void CopyRegion(unsigned int sourceSlice, unsigned int slice, unsigned int level, const ImageRegion& source, unsigned int x, unsigned int y) override;
 	};
 
 }
\ No newline at end of file
@@ -49,10 +49,9 @@ namespace Light {
 		ImGui::NewFrame();
 	}
 
-	void glUserInterface::End()
+	void glUserInterface::Draw(ImDrawData* drawData)
 	{
-		ImGui::Render();
-		ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+		ImGui_ImplOpenGL3_RenderDrawData(drawData);
 	}
 
 }
\ No newline at end of file
@@ -6,11 +6,12 @@
 
 namespace Light {
 
-	glVertexLayout::glVertexLayout(std::shared_ptr<VertexBuffer> buffer, const std::vector<std::pair<std::string, VertexElementType>>& elements)
+	glVertexLayout::glVertexLayout(std::shared_ptr<VertexBuffer> buffer, const std::vector<std::pair<std::string, VertexElementType>>& elements, VertexInputRate inputRate)
 	{
 		LT_PROFILE_FUNC();
 
-		LT_CORE_ASSERT(std::dynamic_pointer_cast<glVertexBuffer>(buffer), "glVertexlayout::glVertexLayout: failed to cast VertexBuffer to glVertexBuffer");
+		LT_CORE_ASSERT(std::dynamic_pointer_cast<glVertexBuffer>(buffer) || std::dynamic_pointer_cast<glStreamVertexBuffer>(buffer),
+		               "glVertexlayout::glVertexLayout: failed to cast VertexBuffer to glVertexBuffer");
 
 		// vertex elements desc
 		std::vector<glVertexElementDesc> vertexElementsDesc;
@@ -32,7 +33,14 @@ namespace Light {
 		unsigned int index = 0;
 		for (const auto& elementDesc : vertexElementsDesc)
 		{
-			glVertexAttribPointer(index, elementDesc.count, elementDesc.type, false, stride, (const void*)elementDesc.offset);
+			if (elementDesc.integer)
+				glVertexAttribIPointer(index, elementDesc.count, elementDesc.type, stride, (const void*)elementDesc.offset);
+			else
+				glVertexAttribPointer(index, elementDesc.count, elementDesc.type, elementDesc.normalized, stride, (const void*)elementDesc.offset);
+
+			if (inputRate == VertexInputRate::PerInstance)
+				glVertexAttribDivisor(index, 1u);
+
 			glEnableVertexAttribArray(index++);
 		}
 	}
@@ -52,15 +60,15 @@ namespace Light {
 	{
 		switch (type)
 		{
-		case VertexElementType::Int:        return { GL_INT         , 1, sizeof(int)   , offset };
-		case VertexElementType::Int2:       return { GL_INT         , 2, sizeof(int)   , offset };
-		case VertexElementType::Int3:       return { GL_INT         , 3, sizeof(int)   , offset };
-		case VertexElementType::Int4:       return { GL_INT         , 4, sizeof(int)   , offset };
+		case VertexElementType::Int:        return { GL_INT         , 1, sizeof(int)   , offset, false, true };
+		case VertexElementType::Int2:       return { GL_INT         , 2, sizeof(int)   , offset, false, true };
+		case VertexElementType::Int3:       return { GL_INT         , 3, sizeof(int)   , offset, false, true };
+		case VertexElementType::Int4:       return { GL_INT         , 4, sizeof(int)   , offset, false, true };
 
-		case VertexElementType::UInt:       return { GL_UNSIGNED_INT, 1, sizeof(int)   , offset };
-		case VertexElementType::UInt2:      return { GL_UNSIGNED_INT, 2, sizeof(int)   , offset };
-		case VertexElementType::UInt3:      return { GL_UNSIGNED_INT, 3, sizeof(int)   , offset };
-		case VertexElementType::UInt4:      return { GL_UNSIGNED_INT, 4, sizeof(int)   , offset };
+		case VertexElementType::UInt:       return { GL_UNSIGNED_INT, 1, sizeof(int)   , offset, false, true };
+		case VertexElementType::UInt2:      return { GL_UNSIGNED_INT, 2, sizeof(int)   , offset, false, true };
+		case VertexElementType::UInt3:      return { GL_UNSIGNED_INT, 3, sizeof(int)   , offset, false, true };
+		case VertexElementType::UInt4:      return { GL_UNSIGNED_INT, 4, sizeof(int)   , offset, false, true };
 
 		case VertexElementType::Float:      return { GL_FLOAT       , 1, sizeof(float) , offset };
 		case VertexElementType::Float2:     return { GL_FLOAT       , 2, sizeof(float) , offset };
@@ -72,6 +80,15 @@ namespace Light {
 		case VertexElementType::Double3:    return { GL_DOUBLE      , 3, sizeof(double), offset };
 		case VertexElementType::Double4:    return { GL_DOUBLE      , 4, sizeof(double), offset };
 
+		case VertexElementType::Half2:       return { GL_HALF_FLOAT    , 2, sizeof(uint16_t), offset };
+		case VertexElementType::Half4:       return { GL_HALF_FLOAT    , 4, sizeof(uint16_t), offset };
+
+		case VertexElementType::UShort2Norm: return { GL_UNSIGNED_SHORT, 2, sizeof(uint16_t), offset, true };
+		case VertexElementType::UShort4Norm: return { GL_UNSIGNED_SHORT, 4, sizeof(uint16_t), offset, true };
+
+		case VertexElementType::UByte4:      return { GL_UNSIGNED_BYTE , 4, sizeof(uint8_t) , offset, false, true };
+		case VertexElementType::UByte4Norm:  return { GL_UNSIGNED_BYTE , 4, sizeof(uint8_t) , offset, true };
+
 		default: LT_CORE_ASSERT(false, "glVertexLayout::GetTypeAttributes: invalid vertex type");
 		}
 	}
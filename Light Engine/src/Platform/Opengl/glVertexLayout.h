@@ -12,6 +12,9 @@ namespace Light {
 		unsigned int count;
 		unsigned int typeSize;
 		unsigned int offset;
+
+		bool normalized;
+		bool integer;
 	};
 
 	class glVertexLayout : public VertexLayout
@@ -19,7 +22,7 @@ namespace Light {
 	private:
 		unsigned int m_ArrayID;
 	public:
-		glVertexLayout(std::shared_ptr<VertexBuffer> buffer, const std::vector<std::pair<std::string, VertexElementType>>& elements);
+		glVertexLayout(std::shared_ptr<VertexBuffer> buffer, const std::vector<std::pair<std::string, VertexElementType>>& elements, VertexInputRate inputRate);
 		~glVertexLayout();
 
 		void Bind() override;
@@ -0,0 +1,39 @@
+#include "ltpch.h"
+#include "swBlender.h"
+#include "swGraphicsContext.h"
+
+namespace Light {
+
+	swBlender::swBlender()
+	{
+		LT_PROFILE_FUNC();
+
+		Disable();
+
+		SetSrcFactor(BlendFactor::SRC_ALPHA);
+		SetDstFactor(BlendFactor::SRC_ALPHA_INVERSE);
+	}
+
+	void swBlender::Enable()
+	{
+		b_Enabled = true;
+		swGraphicsContext::GetPipeline().blend = true;
+	}
+
+	void swBlender::Disable()
+	{
+		b_Enabled = false;
+		swGraphicsContext::GetPipeline().blend = false;
+	}
+
+	void swBlender::SetSrcFactor(BlendFactor factor)
+	{
+		swGraphicsContext::GetPipeline().srcFactor = factor;
+	}
+
+	void swBlender::SetDstFactor(BlendFactor factor)
+	{
+		swGraphicsContext::GetPipeline().dstFactor = factor;
+	}
+
+}
\ No newline at end of file
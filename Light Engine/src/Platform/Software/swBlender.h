@@ -0,0 +1,22 @@
+#pragma once
+
+#include "Core/Core.h"
+
+#include "Renderer/Blender.h"
+
+namespace Light {
+
+	// the factors are part of the pipeline state, each draw call takes the blend state it was made with
+	class swBlender : public Blender
+	{
+	public:
+		swBlender();
+
+		void Enable() override;
+		void Disable() override;
+
+		void SetSrcFactor(BlendFactor factor) override;
+		void SetDstFactor(BlendFactor factor) override;
+	};
+
+}
\ No newline at end of file
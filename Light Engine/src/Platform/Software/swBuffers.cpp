@@ -0,0 +1,119 @@
+#include "ltpch.h"
+#include "swBuffers.h"
+#include "swGraphicsContext.h"
+
+#include <cstring>
+
+namespace Light {
+
+	// ConstantBuffer //
+	swConstantBuffer::swConstantBuffer(ConstantBufferIndex index, unsigned int size)
+		: m_Data(size, 0u), m_Index(index)
+	{
+		LT_PROFILE_FUNC();
+
+		LT_CORE_ASSERT(index < LT_SW_CONSTANT_BUFFER_SLOTS, "swConstantBuffer::swConstantBuffer: invalid index: {}", index);
+		Bind();
+	}
+
+	void swConstantBuffer::Bind()
+	{
+		swGraphicsContext::GetPipeline().constantBuffers[m_Index] = m_Data.data();
+	}
+
+	void* swConstantBuffer::Map()
+	{
+		return m_Data.data();
+	}
+
+	void swConstantBuffer::UnMap()
+	{
+	}
+
+	// VertexBuffer //
+	swVertexBuffer::swVertexBuffer(float* vertices, unsigned int size)
+		: m_Data(size, 0u)
+	{
+		LT_PROFILE_FUNC();
+
+		if (vertices)
+			std::memcpy(m_Data.data(), vertices, size);
+	}
+
+	void swVertexBuffer::Bind()
+	{
+		// the layout reads the buffer it was created with
+	}
+
+	void* swVertexBuffer::Map()
+	{
+		return m_Data.data();
+	}
+
+	void swVertexBuffer::UnMap()
+	{
+	}
+
+	void swVertexBuffer::Update(const void* data, unsigned int offset, unsigned int size)
+	{
+		LT_CORE_ASSERT(offset + size <= m_Data.size(), "swVertexBuffer::Update: out of bounds: {} + {} > {}", offset, size, m_Data.size());
+		std::memcpy(m_Data.data() + offset, data, size);
+	}
+
+	// StreamVertexBuffer //
+	swStreamVertexBuffer::swStreamVertexBuffer(unsigned int stride, unsigned int count)
+		: StreamVertexBuffer(stride, count), m_Data((size_t)stride * count * LT_FRAMES_IN_FLIGHT, 0u)
+	{
+		LT_PROFILE_FUNC();
+	}
+
+	void swStreamVertexBuffer::Bind()
+	{
+	}
+
+	void* swStreamVertexBuffer::Map()
+	{
+		return m_Data.data() + (size_t)GetFirstVertex() * m_Stride;
+	}
+
+	void swStreamVertexBuffer::UnMap()
+	{
+	}
+
+	void swStreamVertexBuffer::EndFrame()
+	{
+		AdvanceRegion();
+	}
+
+	// IndexBuffer //
+	swIndexBuffer::swIndexBuffer(unsigned int* indices, unsigned int count, IndexFormat format)
+	{
+		LT_PROFILE_FUNC();
+
+		m_Format = format;
+		m_Data.resize((size_t)count * (format == IndexFormat::UInt16 ? sizeof(uint16_t) : sizeof(uint32_t)));
+
+		LT_CORE_ASSERT(indices || count % 6 == 0, "swIndexBuffer::swIndexBuffer: indices can only be null if count is multiple of 6");
+
+		for (unsigned int i = 0; i < count; i++)
+		{
+			// quads of 0, 1, 2, 2, 3, 0
+			static const unsigned int quadIndices[6] = { 0u, 1u, 2u, 2u, 3u, 0u };
+			const unsigned int index = indices ? indices[i] : (i / 6u) * 4u + quadIndices[i % 6u];
+
+			if (format == IndexFormat::UInt16)
+			{
+				LT_CORE_ASSERT(index <= UINT16_MAX, "swIndexBuffer::swIndexBuffer: index '{}' does not fit in 16 bits", index);
+				((uint16_t*)m_Data.data())[i] = (uint16_t)index;
+			}
+			else
+				((uint32_t*)m_Data.data())[i] = index;
+		}
+	}
+
+	void swIndexBuffer::Bind()
+	{
+		swGraphicsContext::GetPipeline().indexBuffer = this;
+	}
+
+}
\ No newline at end of file
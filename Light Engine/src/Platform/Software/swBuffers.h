@@ -0,0 +1,75 @@
+#pragma once
+
+#include "Core/Core.h"
+
+#include "Renderer/Buffers.h"
+
+namespace Light {
+
+	// buffers are host memory, the vertex programs read them when the draw call is made
+
+	class swConstantBuffer : public ConstantBuffer
+	{
+	private:
+		std::vector<uint8_t> m_Data;
+		unsigned int m_Index;
+	public:
+		swConstantBuffer(ConstantBufferIndex index, unsigned int size);
+
+		void Bind() override;
+
+		void* Map() override;
+		void UnMap() override;
+	};
+
+	class swVertexBuffer : public VertexBuffer
+	{
+	private:
+		std::vector<uint8_t> m_Data;
+	public:
+		swVertexBuffer(float* vertices, unsigned int size);
+
+		void Bind() override;
+
+		void* Map() override;
+		void UnMap() override;
+
+		void Update(const void* data, unsigned int offset, unsigned int size) override;
+
+		inline const uint8_t* GetData() const { return m_Data.data(); }
+	};
+
+	// draws are done by the time they return, regions never have to be waited on
+	class swStreamVertexBuffer : public StreamVertexBuffer
+	{
+	private:
+		std::vector<uint8_t> m_Data;
+	public:
+		swStreamVertexBuffer(unsigned int stride, unsigned int count);
+
+		void Bind() override;
+
+		void* Map() override;
+		void UnMap() override;
+
+		void EndFrame() override;
+
+		inline const uint8_t* GetData() const { return m_Data.data(); }
+	};
+
+	class swIndexBuffer : public IndexBuffer
+	{
+	private:
+		std::vector<uint8_t> m_Data;
+	public:
+		swIndexBuffer(unsigned int* indices, unsigned int count, IndexFormat format);
+
+		void Bind() override;
+
+		inline unsigned int GetIndex(unsigned int i) const
+		{
+			return m_Format == IndexFormat::UInt16 ? ((const uint16_t*)m_Data.data())[i] : ((const uint32_t*)m_Data.data())[i];
+		}
+	};
+
+}
\ No newline at end of file
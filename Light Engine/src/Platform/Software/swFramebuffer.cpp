@@ -0,0 +1,38 @@
+#include "ltpch.h"
+#include "swFramebuffer.h"
+#include "swGraphicsContext.h"
+
+namespace Light {
+
+	swFramebuffer::swFramebuffer(unsigned int width, unsigned int height, FramebufferFormat format)
+		: Framebuffer(width, height, format), m_Image(width, height)
+	{
+		LT_PROFILE_FUNC();
+	}
+
+	swFramebuffer::~swFramebuffer()
+	{
+		LT_PROFILE_FUNC();
+
+		// pending triangles may still sample or target the framebuffer
+		swGraphicsContext::ReleaseTarget(&m_Image);
+	}
+
+	void swFramebuffer::BindAsTarget(bool clear /*= false*/)
+	{
+		swGraphicsContext::SetRenderTarget(&m_Image, clear);
+	}
+
+	void swFramebuffer::BindAsResource(TextureBindingSlot slot /*= BINDING_FRAMEBUFFER0*/)
+	{
+		// sampled like an opengl texture, v = 0 is the bottom row
+		swTextureView view;
+		view.levels[0] = { (const uint8_t*)m_Image.pixels.data(), m_Width, m_Height, m_Image.pixels.size() * sizeof(uint32_t) };
+		view.levelCount = 1u;
+		view.channels = 4u;
+		view.flipY = true;
+
+		swGraphicsContext::GetPipeline().textures[slot] = view;
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "Core/Core.h"
+
+#include "Renderer/Framebuffer.h"
+
+#include "swRasterizer.h"
+
+namespace Light {
+
+	// FramebufferFormat::RGBA16F is stored as RGBA8, the rasterizer only writes 8 bits per channel
+	class swFramebuffer : public Framebuffer
+	{
+	private:
+		swImage m_Image;
+	public:
+		swFramebuffer(unsigned int width, unsigned int height, FramebufferFormat format);
+		~swFramebuffer();
+
+		void BindAsTarget(bool clear = false) override;
+		void BindAsResource(TextureBindingSlot slot = BINDING_FRAMEBUFFER0) override;
+	};
+
+}
\ No newline at end of file
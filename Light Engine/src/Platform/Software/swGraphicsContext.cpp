@@ -0,0 +1,262 @@
+#include "ltpch.h"
+#include "swGraphicsContext.h"
+
+#include "swBuffers.h"
+#include "swShader.h"
+#include "swVertexLayout.h"
+
+#include "Core/Monitor.h"
+#include "Core/Window.h"
+
+#include <glfw/glfw3.h>
+
+namespace Light {
+
+	swGraphicsContext* swGraphicsContext::s_Instance = nullptr;
+
+	swGraphicsContext::swGraphicsContext(const GraphicsConfigurations& configurations)
+		: m_WindowHandle(Window::GetGlfwHandle()), m_ClearColor{ 0.0f, 0.0f, 0.0f, 0.0f }
+	{
+		LT_PROFILE_FUNC();
+
+		LT_CORE_ASSERT(!s_Instance, "swGraphicsContext::swGraphicsContext: multiple swGraphicsContext instances");
+		s_Instance = this;
+
+		m_Configurations = configurations;
+
+		// set configurations
+		SetConfigurations(configurations);
+
+		LT_CORE_INFO("swGraphicsContext:");
+		LT_CORE_INFO("        Tile size: {}x{}", LT_SW_TILE_SIZE, LT_SW_TILE_SIZE);
+		LT_CORE_INFO("        Threads  : {}", std::thread::hardware_concurrency());
+	}
+
+	swGraphicsContext::~swGraphicsContext()
+	{
+		LT_PROFILE_FUNC();
+
+		m_Rasterizer.SetTarget(nullptr);
+		s_Instance = nullptr;
+	}
+
+	void swGraphicsContext::SwapBuffers()
+	{
+		LT_PROFILE_FUNC();
+
+		m_Rasterizer.Flush();
+
+		// the pixels are swapped, the rasterizer's target is still the back buffer
+		std::swap(m_BackBuffer.pixels, m_FrontBuffer.pixels);
+
+		Present();
+	}
+
+	void swGraphicsContext::ClearBackbuffer(float colors[4])
+	{
+		LT_PROFILE_FUNC();
+
+		std::copy(colors, colors + 4, m_ClearColor);
+		m_Rasterizer.Clear(colors);
+	}
+
+	template<typename GetVertex>
+	void swGraphicsContext::DrawTriangles(unsigned int count, GetVertex getVertex)
+	{
+		LT_PROFILE_FUNC();
+
+		const swShader* shader = m_Pipeline.shader;
+		const swVertexLayout* layout = m_Pipeline.vertexLayout;
+
+		LT_CORE_ASSERT(shader && layout, "swGraphicsContext::DrawTriangles: no shader or vertex layout is bound");
+
+		// ViewMatrix, ProjectionMatrix
+		glm::mat4 viewProjection(1.0f);
+		if (shader->IsTransformed() && m_Pipeline.constantBuffers[ConstantBufferIndex_ViewProjection])
+		{
+			const glm::mat4* matrices = (const glm::mat4*)m_Pipeline.constantBuffers[ConstantBufferIndex_ViewProjection];
+			viewProjection = matrices[1] * matrices[0];
+		}
+
+		m_Rasterizer.SetState({ shader->GetProgram(), m_Pipeline.textures[shader->GetTextureSlot()],
+		                        m_Pipeline.blend, m_Pipeline.srcFactor, m_Pipeline.dstFactor });
+
+		const swImage* target = m_Rasterizer.GetTarget();
+		LT_CORE_ASSERT(target, "swGraphicsContext::DrawTriangles: no render target is bound");
+
+		const swRect scissor = { 0, 0, (int)target->width, (int)target->height };
+
+		/* locals */
+		swVertex vertices[3];
+		unsigned int vertex, instance;
+
+		for (unsigned int i = 0; i + 2u < count; i += 3u)
+		{
+			for (unsigned int j = 0; j < 3u; j++)
+			{
+				getVertex(i + j, vertex, instance);
+				vertices[j] = shader->RunVertex(*layout, vertex, instance, viewProjection);
+			}
+
+			m_Rasterizer.SubmitTriangle(vertices[0], vertices[1], vertices[2], m_Pipeline.viewport, scissor);
+		}
+	}
+
+	void swGraphicsContext::Draw(unsigned int count)
+	{
+		DrawTriangles(count, [](unsigned int i, unsigned int& vertex, unsigned int& instance)
+		{
+			vertex = i;
+			instance = 0u;
+		});
+	}
+
+	void swGraphicsContext::DrawIndexed(unsigned int count, unsigned int offset, unsigned int baseVertex)
+	{
+		const swIndexBuffer* indexBuffer = m_Pipeline.indexBuffer;
+		LT_CORE_ASSERT(indexBuffer, "swGraphicsContext::DrawIndexed: no index buffer is bound");
+
+		DrawTriangles(count, [indexBuffer, offset, baseVertex](unsigned int i, unsigned int& vertex, unsigned int& instance)
+		{
+			vertex = indexBuffer->GetIndex(offset + i) + baseVertex;
+			instance = 0u;
+		});
+	}
+
+	void swGraphicsContext::DrawInstanced(unsigned int vertexCount, unsigned int instanceCount, unsigned int firstInstance)
+	{
+		DrawTriangles(vertexCount * instanceCount, [vertexCount, firstInstance](unsigned int i, unsigned int& vertex, unsigned int& instance)
+		{
+			vertex = i % vertexCount;
+			instance = firstInstance + i / vertexCount;
+		});
+	}
+
+	void swGraphicsContext::DefaultRenderBuffer()
+	{
+		SetRenderTarget(&m_BackBuffer);
+	}
+
+	void swGraphicsContext::SetConfigurations(const GraphicsConfigurations& configurations)
+	{
+		LT_PROFILE_FUNC();
+
+		SetResolution(configurations.resolution);
+		SetVSync(configurations.vSync);
+	}
+
+	void swGraphicsContext::SetResolution(const Resolution& resolution)
+	{
+		LT_PROFILE_FUNC();
+
+		std::shared_ptr<Monitor> windowMonitor = Monitor::GetWindowMonitor();
+		std::vector<VideoMode> videoModes = windowMonitor->GetVideoModes();
+
+		// find maximum monitor resolution
+		int maxWidth = 0, maxHeight = 0;
+		for (const auto& videoMode : videoModes)
+		{
+			if (videoMode.width > maxWidth)
+				maxWidth = videoMode.width;
+
+			if (videoMode.height > maxHeight)
+				maxHeight = videoMode.height;
+		}
+
+		// make sure the new resolution is not higher than monitor's
+		if (resolution.width > maxWidth || resolution.height > maxHeight)
+		{
+			LT_CORE_ERROR("GraphicsContext::SetResolution: Window's resolution cannot be higher than monitor's: [{}x{}] > [{}x{}]",
+			              resolution.width, resolution.height,
+			              maxWidth , maxHeight);
+			return;
+		}
+
+		// update configurations
+		m_Configurations.resolution = resolution;
+
+		// resize the Window and center it
+		glfwSetWindowSize(m_WindowHandle, resolution.width, resolution.height);
+		Window::Get()->Center();
+
+		// resize the buffers, the default render buffer is re-bound with the new viewport
+		const bool defaultBound = !m_Rasterizer.GetTarget() || m_Rasterizer.GetTarget() == &m_BackBuffer;
+		m_Rasterizer.SetTarget(nullptr);
+
+		m_BackBuffer = swImage(resolution.width, resolution.height);
+		m_FrontBuffer = swImage(resolution.width, resolution.height);
+
+		if (defaultBound)
+			DefaultRenderBuffer();
+	}
+
+	void swGraphicsContext::SetVSync(bool vSync)
+	{
+		LT_PROFILE_FUNC();
+
+		// presenting doesn't wait for the display, the frame limiter is left to the application
+		m_Configurations.vSync = vSync;
+	}
+
+	void swGraphicsContext::SetRenderTarget(swImage* target, bool clear /*= false*/)
+	{
+		s_Instance->m_Rasterizer.SetTarget(target);
+		s_Instance->m_Pipeline.viewport = { 0, 0, target->width, target->height };
+
+		if (clear)
+			s_Instance->m_Rasterizer.Clear(s_Instance->m_ClearColor);
+	}
+
+	void swGraphicsContext::Flush()
+	{
+		if (s_Instance)
+			s_Instance->m_Rasterizer.Flush();
+	}
+
+	void swGraphicsContext::ReleaseTarget(const swImage* target)
+	{
+		// may outlive the context
+		if (!s_Instance)
+			return;
+
+		if (s_Instance->m_Rasterizer.GetTarget() == target)
+			s_Instance->m_Rasterizer.SetTarget(nullptr);
+		else
+			s_Instance->m_Rasterizer.Flush();
+	}
+
+	void swGraphicsContext::Present()
+	{
+		LT_PROFILE_FUNC();
+
+#ifdef LIGHT_PLATFORM_WINDOWS
+		// GDI takes BGRA
+		m_PresentPixels.resize(m_FrontBuffer.pixels.size());
+		for (size_t i = 0; i < m_FrontBuffer.pixels.size(); i++)
+		{
+			const uint32_t pixel = m_FrontBuffer.pixels[i];
+			m_PresentPixels[i] = (pixel & 0xff00ff00u) | ((pixel & 0xffu) << 16) | ((pixel >> 16) & 0xffu);
+		}
+
+		BITMAPINFO bitmapInfo = {};
+		bitmapInfo.bmiHeader.biSize = sizeof(BITMAPINFOHEADER);
+		bitmapInfo.bmiHeader.biWidth = m_FrontBuffer.width;
+		bitmapInfo.bmiHeader.biHeight = -(LONG)m_FrontBuffer.height; // top-down
+		bitmapInfo.bmiHeader.biPlanes = 1;
+		bitmapInfo.bmiHeader.biBitCount = 32;
+		bitmapInfo.bmiHeader.biCompression = BI_RGB;
+
+		HWND window = (HWND)Window::GetNativeHandle();
+		HDC deviceContext = GetDC(window);
+
+		RECT clientRect;
+		GetClientRect(window, &clientRect);
+
+		StretchDIBits(deviceContext, 0, 0, clientRect.right, clientRect.bottom, 0, 0, m_FrontBuffer.width, m_FrontBuffer.height,
+		              m_PresentPixels.data(), &bitmapInfo, DIB_RGB_COLORS, SRCCOPY);
+
+		ReleaseDC(window, deviceContext);
+#endif
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,102 @@
+#pragma once
+
+#include "Core/Core.h"
+
+#include "Renderer/GraphicsContext.h"
+
+#include "swRasterizer.h"
+
+#include <glm/glm.hpp>
+
+#define LT_SW_CONSTANT_BUFFER_SLOTS 8u
+#define LT_SW_TEXTURE_SLOTS 8u
+
+struct GLFWwindow;
+
+namespace Light {
+
+	class swIndexBuffer;
+	class swShader;
+	class swVertexLayout;
+
+	// what the bound objects set, read by the draw calls
+	struct swPipeline
+	{
+		swVertexLayout* vertexLayout = nullptr;
+		swIndexBuffer* indexBuffer = nullptr;
+		swShader* shader = nullptr;
+
+		const uint8_t* constantBuffers[LT_SW_CONSTANT_BUFFER_SLOTS] = {};
+		swTextureView textures[LT_SW_TEXTURE_SLOTS] = {};
+
+		swViewport viewport = {};
+
+		bool blend = false;
+		BlendFactor srcFactor = BlendFactor::SRC_ALPHA, dstFactor = BlendFactor::SRC_ALPHA_INVERSE;
+	};
+
+	// renders on the cpu: the vertex programs run on the calling thread, triangles are binned and rasterized
+	// in tiles on the job system by swRasterizer, see swShader for the programs it understands
+	// frames are rendered to memory, SwapBuffers makes the back buffer the front buffer and blits it to the window
+	class swGraphicsContext : public GraphicsContext
+	{
+	private:
+		static swGraphicsContext* s_Instance;
+
+		GLFWwindow* m_WindowHandle;
+
+		swRasterizer m_Rasterizer;
+		swPipeline m_Pipeline;
+
+		swImage m_BackBuffer, m_FrontBuffer;
+		float m_ClearColor[4];
+
+		// converted to the window's pixel format
+		std::vector<uint32_t> m_PresentPixels;
+	public:
+		swGraphicsContext(const GraphicsConfigurations& configurations);
+		~swGraphicsContext();
+
+		void SwapBuffers() override;
+
+		void ClearBackbuffer(float colors[4]) override;
+
+		void Draw(unsigned int count) override;
+		void DrawIndexed(unsigned int count, unsigned int offset, unsigned int baseVertex) override;
+		void DrawInstanced(unsigned int vertexCount, unsigned int instanceCount, unsigned int firstInstance) override;
+
+		void DefaultRenderBuffer() override;
+
+		// setters
+		void SetConfigurations(const GraphicsConfigurations& configurations) override;
+		void SetResolution(const Resolution& resolution) override;
+		void SetVSync(bool vSync) override;
+
+		// binds 'target' and sets the viewport to its size, clears it with the last ClearBackbuffer color if 'clear'
+		static void SetRenderTarget(swImage* target, bool clear = false);
+
+		// pending triangles may still read from a texture that is about to be written to or destroyed
+		static void Flush();
+
+		// unbinds 'target' if it's bound, flushes the pending triangles otherwise, for images that are about to be destroyed
+		static void ReleaseTarget(const swImage* target);
+
+		// getters
+		static inline swPipeline& GetPipeline() { return s_Instance->m_Pipeline; }
+
+		static inline swRasterizer& GetRasterizer() { return s_Instance->m_Rasterizer; }
+
+		static inline swImage* GetBackBuffer() { return &s_Instance->m_BackBuffer; }
+
+		// the last presented frame
+		static inline const swImage& GetFrontBuffer() { return s_Instance->m_FrontBuffer; }
+	private:
+		// runs the bound vertex program on 'count' vertices, every 3 of them are a triangle
+		// 'getVertex(i, vertex, instance)' gives the vertex and instance indices of the i'th vertex
+		template<typename GetVertex>
+		void DrawTriangles(unsigned int count, GetVertex getVertex);
+
+		void Present();
+	};
+
+}
\ No newline at end of file
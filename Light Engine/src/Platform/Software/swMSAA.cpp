@@ -0,0 +1,56 @@
+#include "ltpch.h"
+#include "swMSAA.h"
+#include "swGraphicsContext.h"
+
+#include "Renderer/GraphicsContext.h"
+
+namespace Light {
+
+	swMSAA::swMSAA(unsigned int samples)
+		: m_Image(GraphicsContext::GetResolution().width, GraphicsContext::GetResolution().height)
+	{
+		LT_PROFILE_FUNC();
+	}
+
+	swMSAA::~swMSAA()
+	{
+		LT_PROFILE_FUNC();
+		swGraphicsContext::ReleaseTarget(&m_Image);
+	}
+
+	void swMSAA::BindFrameBuffer()
+	{
+		swGraphicsContext::SetRenderTarget(&m_Image, true);
+	}
+
+	void swMSAA::Resolve()
+	{
+		LT_PROFILE_FUNC();
+
+		// into the bound target, the pending triangles of the image were flushed when it was unbound
+		swImage* target = swGraphicsContext::GetRasterizer().GetTarget();
+		LT_CORE_ASSERT(target && target != &m_Image, "swMSAA::Resolve: no other render target is bound");
+
+		swGraphicsContext::Flush();
+
+		if (target->width == m_Image.width && target->height == m_Image.height)
+		{
+			target->pixels = m_Image.pixels;
+			return;
+		}
+
+		// nearest, like glBlitFramebuffer with GL_NEAREST
+		for (unsigned int y = 0u; y < target->height; y++)
+			for (unsigned int x = 0u; x < target->width; x++)
+				target->pixels[(size_t)y * target->width + x] = m_Image.pixels[(size_t)(y * m_Image.height / target->height) * m_Image.width + x * m_Image.width / target->width];
+	}
+
+	void swMSAA::Resize(unsigned int width, unsigned int height)
+	{
+		LT_PROFILE_FUNC();
+
+		swGraphicsContext::ReleaseTarget(&m_Image);
+		m_Image = swImage(width, height);
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "Core/Core.h"
+
+#include "Renderer/MSAA.h"
+
+#include "swRasterizer.h"
+
+namespace Light {
+
+	// the rasterizer takes a single sample per pixel, the target is only kept so MSAA can be toggled like with the other apis
+	class swMSAA : public MSAA
+	{
+	private:
+		swImage m_Image;
+	public:
+		swMSAA(unsigned int samples);
+		~swMSAA();
+
+		void BindFrameBuffer() override;
+
+		void Resolve() override;
+
+		void Resize(unsigned int width, unsigned int height) override;
+	};
+
+}
\ No newline at end of file
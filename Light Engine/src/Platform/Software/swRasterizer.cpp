@@ -0,0 +1,408 @@
+#include "ltpch.h"
+#include "swRasterizer.h"
+
+#include "Utility/JobSystem.h"
+
+namespace Light {
+
+	namespace {
+
+		// sub pixel bits of the fixed point positions
+		constexpr int SUBPIXEL_BITS = 8;
+		constexpr int64_t SUBPIXEL_ONE = 1 << SUBPIXEL_BITS;
+		constexpr int64_t SUBPIXEL_HALF = SUBPIXEL_ONE / 2;
+
+		// positions are clamped to a guard band, the products of the edge functions fit in 64 bits
+		constexpr float GUARD_BAND = (float)(1 << 20);
+
+		inline glm::vec4 UnpackColor(uint32_t color)
+		{
+			return glm::vec4(color & 0xffu, (color >> 8) & 0xffu, (color >> 16) & 0xffu, color >> 24) / 255.0f;
+		}
+
+		inline uint32_t PackColor(const glm::vec4& color)
+		{
+			const glm::vec4 c = glm::clamp(color, 0.0f, 1.0f) * 255.0f + 0.5f;
+			return (uint32_t)c.r | ((uint32_t)c.g << 8) | ((uint32_t)c.b << 16) | ((uint32_t)c.a << 24);
+		}
+
+		inline glm::vec4 GetBlendFactor(BlendFactor factor, const glm::vec4& source, const glm::vec4& destination)
+		{
+			switch (factor)
+			{
+			case BlendFactor::ZERO:              return glm::vec4(0.0f);
+			case BlendFactor::ONE:               return glm::vec4(1.0f);
+
+			case BlendFactor::SRC_COLOR:         return source;
+			case BlendFactor::SRC_COLOR_INVERSE: return 1.0f - source;
+			case BlendFactor::SRC_ALPHA:         return glm::vec4(source.a);
+			case BlendFactor::SRC_ALPHA_INVERSE: return glm::vec4(1.0f - source.a);
+
+			case BlendFactor::DST_COLOR:         return destination;
+			case BlendFactor::DST_COLOR_INVERSE: return 1.0f - destination;
+			case BlendFactor::DST_ALPHA:         return glm::vec4(destination.a);
+			case BlendFactor::DST_ALPHA_INVERSE: return glm::vec4(1.0f - destination.a);
+
+			default:                             return glm::vec4(1.0f);
+			}
+		}
+
+		inline float SmoothStep(float edge0, float edge1, float x)
+		{
+			if (edge1 <= edge0)
+				return x < edge0 ? 0.0f : 1.0f;
+
+			const float t = glm::clamp((x - edge0) / (edge1 - edge0), 0.0f, 1.0f);
+			return t * t * (3.0f - 2.0f * t);
+		}
+
+		inline swRect Intersect(const swRect& a, const swRect& b)
+		{
+			return { std::max(a.left, b.left), std::max(a.top, b.top), std::min(a.right, b.right), std::min(a.bottom, b.bottom) };
+		}
+
+	}
+
+	glm::vec4 swTextureView::Sample(float u, float v, unsigned int slice, unsigned int level) const
+	{
+		if (!levelCount)
+			return glm::vec4(1.0f);
+
+		const swMipLevel& mip = levels[std::min(level, levelCount - 1u)];
+
+		if (flipY)
+			v = 1.0f - v;
+
+		// clamped before the conversion to int, coordinates outside of [0, 1] end up on the edges anyway
+		const float x = glm::clamp(u, -1.0f, 2.0f) * mip.width - 0.5f;
+		const float y = glm::clamp(v, -1.0f, 2.0f) * mip.height - 0.5f;
+
+		const float floorX = std::floor(x);
+		const float floorY = std::floor(y);
+
+		const int x0 = glm::clamp((int)floorX, 0, (int)mip.width - 1);
+		const int x1 = glm::clamp((int)floorX + 1, 0, (int)mip.width - 1);
+		const int y0 = glm::clamp((int)floorY, 0, (int)mip.height - 1);
+		const int y1 = glm::clamp((int)floorY + 1, 0, (int)mip.height - 1);
+
+		const uint8_t* pixels = mip.pixels + slice * mip.sliceSize;
+		auto texel = [&](int tx, int ty) -> glm::vec4
+		{
+			const uint8_t* p = pixels + ((size_t)ty * mip.width + tx) * channels;
+
+			return channels == 4u ? glm::vec4(p[0], p[1], p[2], p[3]) :
+			       channels == 2u ? glm::vec4(p[0], p[1], 0.0f, 255.0f) :
+			                        glm::vec4(p[0], 0.0f, 0.0f, 255.0f);
+		};
+
+		const glm::vec4 top = glm::mix(texel(x0, y0), texel(x1, y0), x - floorX);
+		const glm::vec4 bottom = glm::mix(texel(x0, y1), texel(x1, y1), x - floorX);
+
+		return glm::mix(top, bottom, y - floorY) / 255.0f;
+	}
+
+	unsigned int swTextureView::GetLevel(float dudx, float dvdx, float dudy, float dvdy) const
+	{
+		if (levelCount <= 1u)
+			return 0u;
+
+		const float width = (float)levels[0].width, height = (float)levels[0].height;
+
+		// texels covered by a pixel
+		const float rho = std::sqrt(std::max(dudx * dudx * width * width + dvdx * dvdx * height * height,
+		                                     dudy * dudy * width * width + dvdy * dvdy * height * height));
+
+		if (!(rho > 1.0f))
+			return 0u;
+
+		return std::min((unsigned int)(std::log2(rho) + 0.5f), levelCount - 1u);
+	}
+
+	swRasterizer::swRasterizer()
+		: m_Target(nullptr), m_State(0u), m_TilesX(0u), m_TilesY(0u)
+	{
+	}
+
+	void swRasterizer::SetTarget(swImage* target)
+	{
+		if (target == m_Target)
+			return;
+
+		Flush();
+		m_Target = target;
+
+		m_TilesX = target ? (target->width + LT_SW_TILE_SIZE - 1u) / LT_SW_TILE_SIZE : 0u;
+		m_TilesY = target ? (target->height + LT_SW_TILE_SIZE - 1u) / LT_SW_TILE_SIZE : 0u;
+
+		if (m_Bins.size() < (size_t)m_TilesX * m_TilesY)
+			m_Bins.resize((size_t)m_TilesX * m_TilesY);
+	}
+
+	void swRasterizer::SetState(const swDrawState& state)
+	{
+		m_States.push_back(state);
+		m_State = (unsigned int)m_States.size() - 1u;
+	}
+
+	void swRasterizer::SubmitTriangle(const swVertex& v0, const swVertex& v1, const swVertex& v2, const swViewport& viewport, const swRect& scissor)
+	{
+		// the engine's projections are orthographic, triangles behind the camera are dropped instead of clipped
+		if (v0.position.w <= 0.0f || v1.position.w <= 0.0f || v2.position.w <= 0.0f)
+			return;
+
+		swVertex screen[3] = { v0, v1, v2 };
+		for (swVertex& vertex : screen)
+		{
+			const glm::vec2 ndc = glm::vec2(vertex.position) / vertex.position.w;
+
+			vertex.position.x = viewport.x + (ndc.x * 0.5f + 0.5f) * viewport.width;
+			vertex.position.y = viewport.y + (0.5f - ndc.y * 0.5f) * viewport.height;
+		}
+
+		const swRect viewportRect = { viewport.x, viewport.y, viewport.x + (int)viewport.width, viewport.y + (int)viewport.height };
+		SubmitScreenTriangle(screen[0], screen[1], screen[2], Intersect(viewportRect, scissor));
+	}
+
+	void swRasterizer::SubmitScreenTriangle(const swVertex& v0, const swVertex& v1, const swVertex& v2, const swRect& scissor)
+	{
+		LT_CORE_ASSERT(m_Target && !m_States.empty(), "swRasterizer::SubmitScreenTriangle: no target or state was set");
+
+		const swVertex* vertices[3] = { &v0, &v1, &v2 };
+
+		/* locals */
+		Triangle triangle;
+
+		for (int i = 0; i < 3; i++)
+		{
+			triangle.x[i] = (int32_t)std::lround(glm::clamp(vertices[i]->position.x, -GUARD_BAND, GUARD_BAND) * SUBPIXEL_ONE);
+			triangle.y[i] = (int32_t)std::lround(glm::clamp(vertices[i]->position.y, -GUARD_BAND, GUARD_BAND) * SUBPIXEL_ONE);
+		}
+
+		// no culling, clockwise triangles are flipped so every edge function is positive inside
+		int64_t area = (int64_t)(triangle.x[1] - triangle.x[0]) * (triangle.y[2] - triangle.y[0]) -
+		               (int64_t)(triangle.y[1] - triangle.y[0]) * (triangle.x[2] - triangle.x[0]);
+
+		if (!area)
+			return;
+
+		if (area < 0)
+		{
+			std::swap(triangle.x[1], triangle.x[2]);
+			std::swap(triangle.y[1], triangle.y[2]);
+			std::swap(vertices[1], vertices[2]);
+		}
+
+		// pixel centers on an edge belong to the triangle to its right or below it
+		for (int i = 0; i < 3; i++)
+		{
+			const int32_t dx = triangle.x[(i + 1) % 3] - triangle.x[i];
+			const int32_t dy = triangle.y[(i + 1) % 3] - triangle.y[i];
+
+			triangle.topLeft[i] = (dy == 0 && dx > 0) || dy < 0;
+		}
+
+		// pixels whose centers may be covered
+		const int64_t minX = std::min({ triangle.x[0], triangle.x[1], triangle.x[2] });
+		const int64_t minY = std::min({ triangle.y[0], triangle.y[1], triangle.y[2] });
+		const int64_t maxX = std::max({ triangle.x[0], triangle.x[1], triangle.x[2] });
+		const int64_t maxY = std::max({ triangle.y[0], triangle.y[1], triangle.y[2] });
+
+		const swRect targetRect = { 0, 0, (int)m_Target->width, (int)m_Target->height };
+		const swRect bounds = { (int)((minX - SUBPIXEL_HALF + SUBPIXEL_ONE - 1) >> SUBPIXEL_BITS), (int)((minY - SUBPIXEL_HALF + SUBPIXEL_ONE - 1) >> SUBPIXEL_BITS),
+		                        (int)((maxX - SUBPIXEL_HALF) >> SUBPIXEL_BITS) + 1, (int)((maxY - SUBPIXEL_HALF) >> SUBPIXEL_BITS) + 1 };
+
+		triangle.bounds = Intersect(Intersect(bounds, targetRect), scissor);
+		if (triangle.bounds.left >= triangle.bounds.right || triangle.bounds.top >= triangle.bounds.bottom)
+			return;
+
+		// attribute planes of the snapped positions
+		const float x0 = triangle.x[0] / (float)SUBPIXEL_ONE, y0 = triangle.y[0] / (float)SUBPIXEL_ONE;
+		const float x1 = triangle.x[1] / (float)SUBPIXEL_ONE - x0, y1 = triangle.y[1] / (float)SUBPIXEL_ONE - y0;
+		const float x2 = triangle.x[2] / (float)SUBPIXEL_ONE - x0, y2 = triangle.y[2] / (float)SUBPIXEL_ONE - y0;
+
+		const float inverseDeterminant = 1.0f / (x1 * y2 - x2 * y1);
+
+		const float attributes[3][6] =
+		{
+			{ vertices[0]->uv.x, vertices[0]->uv.y, vertices[0]->color.r, vertices[0]->color.g, vertices[0]->color.b, vertices[0]->color.a },
+			{ vertices[1]->uv.x, vertices[1]->uv.y, vertices[1]->color.r, vertices[1]->color.g, vertices[1]->color.b, vertices[1]->color.a },
+			{ vertices[2]->uv.x, vertices[2]->uv.y, vertices[2]->color.r, vertices[2]->color.g, vertices[2]->color.b, vertices[2]->color.a },
+		};
+
+		for (int i = 0; i < 6; i++)
+		{
+			const float a1 = attributes[1][i] - attributes[0][i];
+			const float a2 = attributes[2][i] - attributes[0][i];
+
+			triangle.planes[i][0] = (a1 * y2 - a2 * y1) * inverseDeterminant;
+			triangle.planes[i][1] = (a2 * x1 - a1 * x2) * inverseDeterminant;
+			triangle.planes[i][2] = attributes[0][i] - triangle.planes[i][0] * x0 - triangle.planes[i][1] * y0;
+		}
+
+		// flat, the provoking vertex is the first one
+		triangle.slice = v0.slice;
+		triangle.state = m_State;
+
+		// bin
+		const uint32_t index = (uint32_t)m_Triangles.size();
+		m_Triangles.push_back(triangle);
+
+		for (unsigned int tileY = triangle.bounds.top / LT_SW_TILE_SIZE; tileY <= (triangle.bounds.bottom - 1u) / LT_SW_TILE_SIZE; tileY++)
+			for (unsigned int tileX = triangle.bounds.left / LT_SW_TILE_SIZE; tileX <= (triangle.bounds.right - 1u) / LT_SW_TILE_SIZE; tileX++)
+				m_Bins[tileY * m_TilesX + tileX].push_back(index);
+	}
+
+	void swRasterizer::Flush()
+	{
+		if (m_Triangles.empty())
+			return;
+
+		LT_PROFILE_FUNC();
+
+		/* locals */
+		const unsigned int tileCount = m_TilesX * m_TilesY;
+
+		// tiles don't share pixels, one tile per job since their costs vary with the triangles binned into them
+		JobSystem::ParallelFor(tileCount, 1u, [this](unsigned int begin, unsigned int end)
+		{
+			for (unsigned int tile = begin; tile < end; tile++)
+				RasterizeTile(tile);
+		});
+
+		for (unsigned int tile = 0u; tile < tileCount; tile++)
+			m_Bins[tile].clear();
+
+		m_Triangles.clear();
+		m_States.clear();
+	}
+
+	void swRasterizer::Clear(const float colors[4])
+	{
+		LT_PROFILE_FUNC();
+
+		if (!m_Target)
+			return;
+
+		Flush();
+		std::fill(m_Target->pixels.begin(), m_Target->pixels.end(), PackColor(glm::vec4(colors[0], colors[1], colors[2], colors[3])));
+	}
+
+	void swRasterizer::RasterizeTile(unsigned int tile)
+	{
+		const std::vector<uint32_t>& bin = m_Bins[tile];
+		if (bin.empty())
+			return;
+
+		const int left = (int)((tile % m_TilesX) * LT_SW_TILE_SIZE);
+		const int top = (int)((tile / m_TilesX) * LT_SW_TILE_SIZE);
+
+		const swRect tileRect = { left, top, std::min(left + (int)LT_SW_TILE_SIZE, (int)m_Target->width), std::min(top + (int)LT_SW_TILE_SIZE, (int)m_Target->height) };
+
+		for (uint32_t index : bin)
+			RasterizeTriangle(m_Triangles[index], tileRect);
+	}
+
+	void swRasterizer::RasterizeTriangle(const Triangle& triangle, const swRect& tile)
+	{
+		const swRect rect = Intersect(triangle.bounds, tile);
+		if (rect.left >= rect.right || rect.top >= rect.bottom)
+			return;
+
+		const swDrawState& state = m_States[triangle.state];
+		const float (&planes)[6][3] = triangle.planes;
+
+		// edge functions at the center of the first pixel, stepped per pixel
+		const int64_t startX = (int64_t)rect.left * SUBPIXEL_ONE + SUBPIXEL_HALF;
+		const int64_t startY = (int64_t)rect.top * SUBPIXEL_ONE + SUBPIXEL_HALF;
+
+		int64_t rows[3], stepX[3], stepY[3];
+		for (int i = 0; i < 3; i++)
+		{
+			const int64_t dx = triangle.x[(i + 1) % 3] - triangle.x[i];
+			const int64_t dy = triangle.y[(i + 1) % 3] - triangle.y[i];
+
+			// the bias excludes centers exactly on edges that aren't top or left
+			rows[i] = dx * (startY - triangle.y[i]) - dy * (startX - triangle.x[i]) - (triangle.topLeft[i] ? 0 : 1);
+			stepX[i] = -dy * SUBPIXEL_ONE;
+			stepY[i] = dx * SUBPIXEL_ONE;
+		}
+
+		// texture coordinates are affine, the mip level is the same for the whole triangle
+		const unsigned int level = state.texture.GetLevel(planes[0][0], planes[1][0], planes[0][1], planes[1][1]);
+
+		bool sdf = triangle.slice > 127.5f;
+		const unsigned int slice = (unsigned int)(sdf ? triangle.slice - 128.0f : triangle.slice);
+
+		for (int y = rect.top; y < rect.bottom; y++)
+		{
+			int64_t edges[3] = { rows[0], rows[1], rows[2] };
+			uint32_t* row = m_Target->pixels.data() + (size_t)y * m_Target->width;
+
+			const float centerY = y + 0.5f;
+
+			for (int x = rect.left; x < rect.right; x++)
+			{
+				if ((edges[0] | edges[1] | edges[2]) >= 0)
+				{
+					const float centerX = x + 0.5f;
+
+					const float u = planes[0][0] * centerX + planes[0][1] * centerY + planes[0][2];
+					const float v = planes[1][0] * centerX + planes[1][1] * centerY + planes[1][2];
+
+					const glm::vec4 tint(planes[2][0] * centerX + planes[2][1] * centerY + planes[2][2],
+					                     planes[3][0] * centerX + planes[3][1] * centerY + planes[3][2],
+					                     planes[4][0] * centerX + planes[4][1] * centerY + planes[4][2],
+					                     planes[5][0] * centerX + planes[5][1] * centerY + planes[5][2]);
+
+					/* locals */
+					glm::vec4 color;
+
+					switch (state.program)
+					{
+					case swPixelProgram::Quad:
+					case swPixelProgram::UserInterface:
+						color = state.texture.Sample(u, v, slice, level) * tint;
+						break;
+
+					case swPixelProgram::Text:
+					{
+						const float value = state.texture.Sample(u, v, slice, level).r;
+						float coverage = value;
+
+						// fwidth from the neighbouring pixels' texels
+						if (sdf)
+						{
+							const float width = std::abs(state.texture.Sample(u + planes[0][0], v + planes[1][0], slice, level).r - value) +
+							                    std::abs(state.texture.Sample(u + planes[0][1], v + planes[1][1], slice, level).r - value);
+
+							coverage = SmoothStep(0.5f - width, 0.5f + width, value);
+						}
+
+						color = glm::vec4(glm::vec3(tint), tint.a * coverage);
+						break;
+					}
+
+					case swPixelProgram::Copy:
+						color = state.texture.Sample(u, v, 0u, 0u);
+						break;
+					}
+
+					if (state.blend)
+					{
+						const glm::vec4 destination = UnpackColor(row[x]);
+						color = color * GetBlendFactor(state.srcFactor, color, destination) + destination * GetBlendFactor(state.dstFactor, color, destination);
+					}
+
+					row[x] = PackColor(color);
+				}
+
+				for (int i = 0; i < 3; i++)
+					edges[i] += stepX[i];
+			}
+
+			for (int i = 0; i < 3; i++)
+				rows[i] += stepY[i];
+		}
+	}
+
+}
\ No newline at end of file
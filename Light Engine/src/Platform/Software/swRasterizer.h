@@ -0,0 +1,145 @@
+#pragma once
+
+#include "Core/Core.h"
+
+#include "Renderer/Blender.h"
+
+#include <glm/glm.hpp>
+
+// pixels per side of a tile, tiles are rasterized in parallel
+#define LT_SW_TILE_SIZE 64u
+
+#define LT_SW_MAX_MIP_LEVELS 16u
+
+namespace Light {
+
+	// RGBA8 color buffer, R in the lowest byte, row 0 is the top of the image
+	struct swImage
+	{
+		unsigned int width = 0u, height = 0u;
+		std::vector<uint32_t> pixels;
+
+		swImage() = default;
+		swImage(unsigned int width_, unsigned int height_) : width(width_), height(height_), pixels((size_t)width_ * height_, 0u) {}
+	};
+
+	struct swMipLevel
+	{
+		const uint8_t* pixels;
+		unsigned int width, height;
+		size_t sliceSize;
+	};
+
+	// what a pixel program samples from, a texture array or a framebuffer
+	struct swTextureView
+	{
+		swMipLevel levels[LT_SW_MAX_MIP_LEVELS];
+		unsigned int levelCount = 0u;
+		unsigned int channels = 4u;
+
+		// framebuffers are sampled with opengl's texture coordinates, v = 0 is the bottom row
+		bool flipY = false;
+
+		// bilinear, clamped to the edges, missing channels are read as (0, 0, 0, 1)
+		glm::vec4 Sample(float u, float v, unsigned int slice, unsigned int level) const;
+
+		// nearest mip level for a screen space gradient of the texture coordinates
+		unsigned int GetLevel(float dudx, float dvdx, float dudy, float dvdy) const;
+	};
+
+	// matches the programs of QuadShader.h, TextShader.h and PostProcessShader.h, see swShader
+	enum class swPixelProgram
+	{
+		Quad,          // texture * tint
+		Text,          // coverage of a glyph, signed distance field slices are offset by 128
+		Copy,          // framebuffer texel
+		UserInterface, // texture * color, ImGui's draw lists
+	};
+
+	struct swDrawState
+	{
+		swPixelProgram program;
+		swTextureView texture;
+
+		bool blend;
+		BlendFactor srcFactor, dstFactor;
+	};
+
+	// output of a vertex program
+	struct swVertex
+	{
+		glm::vec4 position; // clip space, or pixels for swRasterizer::SubmitScreenTriangle
+		glm::vec2 uv;
+		float slice;
+		glm::vec4 color;
+	};
+
+	struct swViewport
+	{
+		int x, y;
+		unsigned int width, height;
+	};
+
+	struct swRect
+	{
+		int left, top, right, bottom;
+	};
+
+	// binned tile rasterizer:
+	// submitted triangles are set up and appended to the bins of the tiles they touch, the target is only written by Flush,
+	// which rasterizes the tiles on the job system; a tile's triangles are drawn in submission order, blending stays ordered
+	class swRasterizer
+	{
+	private:
+		// fixed point with 8 bits of sub pixel precision
+		struct Triangle
+		{
+			int32_t x[3], y[3];
+			bool topLeft[3];
+
+			swRect bounds; // pixels, right and bottom are exclusive
+
+			// attribute = a * x + b * y + c, in pixels: u, v, r, g, b, a
+			float planes[6][3];
+			float slice;
+
+			unsigned int state;
+		};
+
+		swImage* m_Target;
+
+		std::vector<Triangle> m_Triangles;
+		std::vector<swDrawState> m_States;
+		unsigned int m_State;
+
+		std::vector<std::vector<uint32_t>> m_Bins;
+		unsigned int m_TilesX, m_TilesY;
+	public:
+		swRasterizer();
+
+		// flushes the pending triangles of the previous target
+		void SetTarget(swImage* target);
+
+		// every following triangle until the next call is drawn with this state
+		void SetState(const swDrawState& state);
+
+		// clip space positions, mapped to the viewport and clipped to 'scissor'
+		void SubmitTriangle(const swVertex& v0, const swVertex& v1, const swVertex& v2, const swViewport& viewport, const swRect& scissor);
+
+		// positions are already in pixels
+		void SubmitScreenTriangle(const swVertex& v0, const swVertex& v1, const swVertex& v2, const swRect& scissor);
+
+		// draws every pending triangle into the target, on the job system
+		void Flush();
+
+		void Clear(const float colors[4]);
+
+		inline bool IsPending() const { return !m_Triangles.empty(); }
+
+		inline swImage* GetTarget() const { return m_Target; }
+	private:
+		void RasterizeTile(unsigned int tile);
+		void RasterizeTriangle(const Triangle& triangle, const swRect& tile);
+	};
+
+}
\ No newline at end of file
@@ -0,0 +1,206 @@
+#include "ltpch.h"
+#include "swShader.h"
+#include "swGraphicsContext.h"
+#include "swVertexLayout.h"
+
+namespace Light {
+
+	std::unordered_map<std::string, TextureBindingSlot> swShader::s_TextureSlotsMap =
+	{
+		LT_PAIR_TOKEN_NAME_TO_VALUE(BINDING_TEXTUREARRAY0),
+		LT_PAIR_TOKEN_NAME_TO_VALUE(BINDING_FONTGLYPHARRAY0),
+		LT_PAIR_TOKEN_NAME_TO_VALUE(BINDING_FRAMEBUFFER0),
+		LT_PAIR_TOKEN_NAME_TO_VALUE(BINDING_FRAMEBUFFER1),
+		LT_PAIR_TOKEN_NAME_TO_VALUE(BINDING_FRAMEBUFFER2),
+	};
+
+	swShader::swShader(const std::string& vertexSource, const std::string& fragmentSource)
+		: m_Transformed(vertexSource.find("ViewProjection") != std::string::npos), m_Instanced(false), m_SliceInTexCoords(true),
+		  m_Program(swPixelProgram::Quad), m_TextureSlot(BINDING_TEXTUREARRAY0)
+	{
+		LT_PROFILE_FUNC();
+
+		ExtractVertexElements(vertexSource);
+		ExtractPixelProgram(fragmentSource);
+	}
+
+	void swShader::Bind()
+	{
+		swGraphicsContext::GetPipeline().shader = this;
+	}
+
+	swVertex swShader::RunVertex(const swVertexLayout& layout, unsigned int vertex, unsigned int instance, const glm::mat4& viewProjection) const
+	{
+		// TOP_LEFT, TOP_RIGHT, BOTTOM_RIGHT, BOTTOM_RIGHT, BOTTOM_LEFT, TOP_LEFT
+		static const glm::vec2 corners[6] = { { -1.0f, -1.0f }, { 1.0f, -1.0f }, { 1.0f, 1.0f }, { 1.0f, 1.0f }, { -1.0f, 1.0f }, { -1.0f, -1.0f } };
+
+		/* locals */
+		glm::vec4 position(0.0f, 0.0f, 0.0f, 1.0f), texCoords(0.0f), center(0.0f), texRect(0.0f), color(1.0f);
+		glm::vec2 halfSize(0.0f);
+		float slice = 0.0f;
+
+		const unsigned int index = layout.IsPerInstance() ? instance : vertex;
+		const unsigned int count = std::min((unsigned int)m_Inputs.size(), layout.GetElementCount());
+
+		for (unsigned int i = 0; i < count; i++)
+		{
+			switch (m_Inputs[i])
+			{
+			case swVertexInput::Position:  position = glm::vec4(glm::vec3(layout.Fetch(i, index)), 1.0f); break;
+			case swVertexInput::TexCoords: texCoords = layout.Fetch(i, index);                            break;
+			case swVertexInput::Slice:     slice = layout.Fetch(i, index).x;                              break;
+			case swVertexInput::Color:     color = layout.Fetch(i, index);                                break;
+			case swVertexInput::Center:    center = layout.Fetch(i, index);                               break;
+			case swVertexInput::HalfSize:  halfSize = layout.Fetch(i, index);                             break;
+			case swVertexInput::TexRect:   texRect = layout.Fetch(i, index);                              break;
+			default:                                                                                      break;
+			}
+		}
+
+		// the quad's corners are built from the vertex id, see QuadShaderSrc_Instanced_VS
+		if (m_Instanced)
+		{
+			const glm::vec2 corner = corners[vertex % 6u];
+
+			const float s = std::sin(center.w);
+			const float c = std::cos(center.w);
+
+			glm::vec2 offset = corner * halfSize;
+			offset = glm::vec2(offset.x * c - offset.y * s, offset.x * s + offset.y * c);
+
+			position = glm::vec4(glm::vec2(center) + offset, center.z, 1.0f);
+			texCoords = glm::vec4(glm::mix(glm::vec2(texRect), glm::vec2(texRect.z, texRect.w), corner * 0.5f + 0.5f), 0.0f, 0.0f);
+		}
+
+		return { m_Transformed ? viewProjection * position : position,
+		         glm::vec2(texCoords),
+		         m_SliceInTexCoords ? texCoords.z : slice,
+		         color };
+	}
+
+	void swShader::ExtractVertexElements(const std::string& vertexSource)
+	{
+		LT_PROFILE_FUNC();
+
+		std::stringstream stream(vertexSource.substr(0, vertexSource.find("void main()")));
+		std::string line;
+
+		while (std::getline(stream, line))
+		{
+			if (line.find("layout(location") != std::string::npos)
+			{
+				line = line.substr(line.find("in") + 3);
+				std::string type = line.substr(0, line.find(' '));
+				std::string name = line.substr(line.find(' ') + 1, line.find(';') - line.find(' ') - 1);
+
+				m_Elements.push_back({name, GetVertexElementType(type.c_str())});
+
+				switch (hashStr(name.c_str()))
+				{
+				case hashStr("InPosition"):  m_Inputs.push_back(swVertexInput::Position);  break;
+				case hashStr("InTexCoords"): m_Inputs.push_back(swVertexInput::TexCoords); break;
+				case hashStr("InSlice"):     m_Inputs.push_back(swVertexInput::Slice);     break;
+				case hashStr("InColor"):     m_Inputs.push_back(swVertexInput::Color);     break;
+				case hashStr("InCenter"):    m_Inputs.push_back(swVertexInput::Center);    break;
+				case hashStr("InHalfSize"):  m_Inputs.push_back(swVertexInput::HalfSize);  break;
+				case hashStr("InTexRect"):   m_Inputs.push_back(swVertexInput::TexRect);   break;
+
+				default:
+					LT_CORE_WARN("swShader::ExtractVertexElements: vertex input is not understood, it's ignored: {}", name);
+					m_Inputs.push_back(swVertexInput::Unknown);
+				}
+
+				if (m_Inputs.back() == swVertexInput::Slice)
+					m_SliceInTexCoords = false;
+
+				if (m_Inputs.back() == swVertexInput::Center)
+					m_Instanced = true;
+			}
+		}
+	}
+
+	void swShader::ExtractPixelProgram(const std::string& fragmentSource)
+	{
+		LT_PROFILE_FUNC();
+
+		const size_t tokenPosition = fragmentSource.find("// #");
+		const std::string token = tokenPosition == std::string::npos ? "" : fragmentSource.substr(tokenPosition + 4, fragmentSource.find_first_of("\r\n", tokenPosition) - tokenPosition - 4);
+
+		auto slot = s_TextureSlotsMap.find(token);
+		if (slot == s_TextureSlotsMap.end())
+		{
+			LT_CORE_WARN("swShader::ExtractPixelProgram: pixel shader doesn't sample a known binding, it's drawn as a quad: {}", token);
+			return;
+		}
+
+		m_TextureSlot = slot->second;
+
+		switch (m_TextureSlot)
+		{
+		case BINDING_TEXTUREARRAY0:
+			m_Program = swPixelProgram::Quad;
+			break;
+
+		case BINDING_FONTGLYPHARRAY0:
+			m_Program = swPixelProgram::Text;
+			break;
+
+		default:
+			m_Program = swPixelProgram::Copy;
+
+			// the code of post process effects isn't run, only a pass without effects between the head and the tail
+			// of PostProcessShader.h is drawn as it would be by the other apis
+			const size_t head = fragmentSource.find('\n', fragmentSource.find("vec4 color = texture("));
+			const size_t tail = fragmentSource.find("FSOutFragmentColor = color;");
+
+			if (head == std::string::npos || tail == std::string::npos || fragmentSource.find_first_not_of(" \t\r\n", head) != tail)
+				LT_CORE_WARN("swShader::ExtractPixelProgram: post process effects aren't run by the software renderer, the pass copies its input");
+		}
+	}
+
+	VertexElementType swShader::GetVertexElementType(const char* typeName)
+	{
+		switch (hashStr(typeName))
+		{
+		case hashStr("int"):       return VertexElementType::Int;
+		case hashStr("ivec2"):     return VertexElementType::Int2;
+		case hashStr("ivec3"):     return VertexElementType::Int3;
+		case hashStr("ivec4"):     return VertexElementType::Int4;
+
+		case hashStr("uint"):      return VertexElementType::UInt;
+		case hashStr("uvec2"):     return VertexElementType::UInt2;
+		case hashStr("uvec3"):     return VertexElementType::UInt3;
+		case hashStr("uvec4"):     return VertexElementType::UInt4;
+
+		case hashStr("float"):     return VertexElementType::Float;
+		case hashStr("vec2"):      return VertexElementType::Float2;
+		case hashStr("vec3"):      return VertexElementType::Float3;
+		case hashStr("vec4"):      return VertexElementType::Float4;
+
+		case hashStr("double"):    return VertexElementType::Double;
+		case hashStr("dvec2"):     return VertexElementType::Double2;
+		case hashStr("dvec3"):     return VertexElementType::Double3;
+		case hashStr("dvec4"):     return VertexElementType::Double4;
+
+		default: LT_CORE_ASSERT(false, "swShader::GetElementType: invalid typeName");
+		}
+	}
+
+	std::string swShaderCompiler::GetDeviceName()
+	{
+		return "software";
+	}
+
+	std::shared_ptr<Shader> swShaderCompiler::Compile(const std::string& vertexSource, const std::string& fragmentSource, std::vector<uint8_t>& binary)
+	{
+		LT_PROFILE_FUNC();
+		return std::make_shared<swShader>(vertexSource, fragmentSource);
+	}
+
+	std::shared_ptr<Shader> swShaderCompiler::Load(const std::string& vertexSource, const std::string& fragmentSource, const std::vector<uint8_t>& binary)
+	{
+		// nothing is ever saved
+		return nullptr;
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "Core/Core.h"
+
+#include "Renderer/Shader.h"
+#include "Renderer/ShaderCache.h"
+
+#include "swRasterizer.h"
+
+#include <glm/glm.hpp>
+
+namespace Light {
+
+	class swVertexLayout;
+
+	// what a vertex input is used for, by its name in the GLSL source
+	enum class swVertexInput
+	{
+		Position,  // InPosition
+		TexCoords, // InTexCoords, z is the slice if there is no InSlice
+		Slice,     // InSlice
+		Color,     // InColor
+		Center,    // InCenter, instanced quads, w is the angle
+		HalfSize,  // InHalfSize
+		TexRect,   // InTexRect
+		Unknown,
+	};
+
+	// the GLSL sections aren't compiled, the engine's programs are recognized from their inputs and sampler tokens:
+	//     vertex  : InPosition/InTexCoords/InSlice/InColor, or InCenter/InHalfSize/InTexRect/InSlice/InColor for instanced quads
+	//               transformed by the ViewProjection buffer if the source declares it, passed through otherwise
+	//     fragment: #BINDING_TEXTUREARRAY0 -> swPixelProgram::Quad, #BINDING_FONTGLYPHARRAY0 -> swPixelProgram::Text,
+	//               #BINDING_FRAMEBUFFERX -> swPixelProgram::Copy
+	class swShader : public Shader
+	{
+	private:
+		static std::unordered_map<std::string, TextureBindingSlot> s_TextureSlotsMap;
+
+		// by location
+		std::vector<swVertexInput> m_Inputs;
+		bool m_Transformed, m_Instanced, m_SliceInTexCoords;
+
+		swPixelProgram m_Program;
+		TextureBindingSlot m_TextureSlot;
+	public:
+		swShader(const std::string& vertexSource, const std::string& fragmentSource);
+
+		void Bind() override;
+
+		// the vertex attributes are read from 'layout' at 'instance' if it advances per instance
+		swVertex RunVertex(const swVertexLayout& layout, unsigned int vertex, unsigned int instance, const glm::mat4& viewProjection) const;
+
+		// getters
+		inline swPixelProgram GetProgram() const { return m_Program; }
+		inline TextureBindingSlot GetTextureSlot() const { return m_TextureSlot; }
+
+		inline bool IsTransformed() const { return m_Transformed; }
+	private:
+		void ExtractVertexElements(const std::string& vertexSource);
+		void ExtractPixelProgram(const std::string& fragmentSource);
+
+		VertexElementType GetVertexElementType(const char* typeName);
+	};
+
+	class swShaderCompiler : public ShaderCompiler
+	{
+	public:
+		std::string GetDeviceName() override;
+
+		// there's nothing to keep, the binary is left empty
+		std::shared_ptr<Shader> Compile(const std::string& vertexSource, const std::string& fragmentSource, std::vector<uint8_t>& binary) override;
+
+		std::shared_ptr<Shader> Load(const std::string& vertexSource, const std::string& fragmentSource, const std::vector<uint8_t>& binary) override;
+	};
+
+}
\ No newline at end of file
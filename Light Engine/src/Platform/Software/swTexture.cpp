@@ -0,0 +1,79 @@
+#include "ltpch.h"
+#include "swTexture.h"
+#include "swGraphicsContext.h"
+
+#include <cstring>
+
+namespace Light {
+
+	swTextureArray::swTextureArray(unsigned int width, unsigned int height, unsigned int depth, unsigned int channels)
+		: TextureArray(width, height, depth, channels)
+	{
+		LT_PROFILE_FUNC();
+
+		LT_CORE_ASSERT(channels == 4 || channels == 2 || channels == 1, "swTextureArray::swTextureArray: invalid number of channels: {}", channels);
+		LT_CORE_ASSERT(m_MipLevels <= LT_SW_MAX_MIP_LEVELS, "swTextureArray::swTextureArray: too many mip levels: {}", m_MipLevels);
+
+		m_Levels.resize(m_MipLevels);
+
+		m_View.levelCount = m_MipLevels;
+		m_View.channels = channels;
+
+		for (unsigned int level = 0u; level < m_MipLevels; level++)
+		{
+			const unsigned int levelWidth = GetMipSize(width, level);
+			const unsigned int levelHeight = GetMipSize(height, level);
+
+			m_Levels[level].resize((size_t)levelWidth * levelHeight * channels * depth, 0u);
+			m_View.levels[level] = { m_Levels[level].data(), levelWidth, levelHeight, (size_t)levelWidth * levelHeight * channels };
+		}
+	}
+
+	swTextureArray::~swTextureArray()
+	{
+		LT_PROFILE_FUNC();
+
+		// pending triangles may still sample the array
+		swGraphicsContext::Flush();
+	}
+
+	void swTextureArray::Bind(unsigned int slot /* = 0 */)
+	{
+		LT_PROFILE_FUNC();
+
+		LT_CORE_ASSERT(slot < LT_SW_TEXTURE_SLOTS, "swTextureArray::Bind: invalid slot: {}", slot);
+		swGraphicsContext::GetPipeline().textures[slot] = m_View;
+	}
+
+	void swTextureArray::UploadRegion(unsigned int slice, unsigned int level, const ImageRegion& region, const void* pixels)
+	{
+		LT_PROFILE_FUNC();
+
+		swGraphicsContext::Flush();
+
+		const swMipLevel& mip = m_View.levels[level];
+		const size_t rowSize = (size_t)region.width * m_Channels;
+
+		for (unsigned int y = 0u; y < region.height; y++)
+			std::memcpy(m_Levels[level].data() + slice * mip.sliceSize + ((size_t)(region.y + y) * mip.width + region.x) * m_Channels,
+			            (const uint8_t*)pixels + y * rowSize, rowSize);
+	}
+
+	void swTextureArray::CopyRegion(unsigned int sourceSlice, unsigned int slice, unsigned int level, const ImageRegion& source, unsigned int x, unsigned int y)
+	{
+		LT_PROFILE_FUNC();
+
+		swGraphicsContext::Flush();
+
+		const swMipLevel& mip = m_View.levels[level];
+		const size_t rowSize = (size_t)source.width * m_Channels;
+
+		uint8_t* pixels = m_Levels[level].data();
+
+		// the copies are to another slice, the regions don't overlap
+		for (unsigned int row = 0u; row < source.height; row++)
+			std::memcpy(pixels + slice * mip.sliceSize + ((size_t)(y + row) * mip.width + x) * m_Channels,
+			            pixels + sourceSlice * mip.sliceSize + ((size_t)(source.y + row) * mip.width + source.x) * m_Channels, rowSize);
+	}
+
+}
\ No newline at end of file
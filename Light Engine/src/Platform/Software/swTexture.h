@@ -0,0 +1,28 @@
+#pragma once
+
+#include "Core/Core.h"
+
+#include "Renderer/Texture.h"
+
+#include "swRasterizer.h"
+
+namespace Light {
+
+	// every mip level of every slice is kept in host memory, slices of a level are contiguous
+	class swTextureArray : public TextureArray
+	{
+	private:
+		std::vector<std::vector<uint8_t>> m_Levels;
+		swTextureView m_View;
+	public:
+		swTextureArray(unsigned int width, unsigned int height, unsigned int depth, unsigned int channels);
+		~swTextureArray();
+
+		void Bind(unsigned int slot = 0) override;
+	private:
+		void UploadRegion(unsigned int slice, unsigned int level, const ImageRegion& region, const void* pixels) override;
+
+		void CopyRegion(unsigned int sourceSlice, unsigned int slice, unsigned int level, const ImageRegion& source, unsigned int x, unsigned int y) override;
+	};
+
+}
\ No newline at end of file
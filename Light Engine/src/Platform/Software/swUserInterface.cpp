@@ -0,0 +1,126 @@
+#include "ltpch.h"
+#include "swUserInterface.h"
+#include "swGraphicsContext.h"
+
+#include "Core/Window.h"
+
+#include <imgui.h>
+#include <imgui_impl_glfw.h>
+
+#include <cstring>
+
+namespace Light {
+
+	swUserInterface::swUserInterface()
+	{
+		LT_PROFILE_FUNC();
+
+		// setup ImGui's context
+		IMGUI_CHECKVERSION();
+		ImGui::CreateContext();
+		ImGuiIO& io = ImGui::GetIO();
+		io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard; // enable keyboard controls
+		io.ConfigFlags |= ImGuiConfigFlags_NavEnableGamepad;  // enable gamepad controls
+		io.ConfigFlags |= ImGuiConfigFlags_NoMouseCursorChange;  // disable mouse cursor change
+
+		io.BackendRendererName = "LightEngine_Software";
+		io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;
+
+		// setup ImGui's style
+		ImGui::StyleColorsDark();
+
+		ImGuiStyle& style = ImGui::GetStyle();
+		style.WindowRounding = 0.0f;
+		style.Colors[ImGuiCol_WindowBg].w = 1.0f;
+
+		// setup platform bindings, the vulkan init doesn't touch any graphics api
+		ImGui_ImplGlfw_InitForVulkan(Window::GetGlfwHandle(), false);
+
+		// font atlas
+		unsigned char* pixels;
+		int width, height;
+		io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+
+		m_FontPixels.assign(pixels, pixels + (size_t)width * height * 4u);
+
+		m_FontView.levels[0] = { m_FontPixels.data(), (unsigned int)width, (unsigned int)height, m_FontPixels.size() };
+		m_FontView.levelCount = 1u;
+		m_FontView.channels = 4u;
+
+		io.Fonts->TexID = (ImTextureID)&m_FontView;
+	}
+
+	swUserInterface::~swUserInterface()
+	{
+		LT_PROFILE_FUNC();
+
+		// pending triangles may still sample the font atlas
+		swGraphicsContext::Flush();
+
+		ImGui_ImplGlfw_Shutdown();
+		ImGui::DestroyContext();
+	}
+
+	void swUserInterface::Begin()
+	{
+		ImGui_ImplGlfw_NewFrame();
+		ImGui::NewFrame();
+	}
+
+	void swUserInterface::Draw(ImDrawData* drawData)
+	{
+		LT_PROFILE_FUNC();
+
+		swGraphicsContext::SetRenderTarget(swGraphicsContext::GetBackBuffer());
+		swRasterizer& rasterizer = swGraphicsContext::GetRasterizer();
+
+		const ImVec2 position = drawData->DisplayPos;
+		const ImVec2 scale = drawData->FramebufferScale;
+
+		/* locals */
+		swVertex vertices[3];
+
+		for (int i = 0; i < drawData->CmdListsCount; i++)
+		{
+			const ImDrawList* commandList = drawData->CmdLists[i];
+
+			for (const ImDrawCmd& command : commandList->CmdBuffer)
+			{
+				if (command.UserCallback)
+				{
+					// ImDrawCallback_ResetRenderState has nothing to reset
+					if (command.UserCallback != ImDrawCallback_ResetRenderState)
+						command.UserCallback(commandList, &command);
+
+					continue;
+				}
+
+				const swRect scissor = { (int)((command.ClipRect.x - position.x) * scale.x), (int)((command.ClipRect.y - position.y) * scale.y),
+				                         (int)((command.ClipRect.z - position.x) * scale.x), (int)((command.ClipRect.w - position.y) * scale.y) };
+
+				if (scissor.left >= scissor.right || scissor.top >= scissor.bottom)
+					continue;
+
+				// alpha blended, like the other apis' backends
+				rasterizer.SetState({ swPixelProgram::UserInterface, *(const swTextureView*)command.TextureId,
+				                      true, BlendFactor::SRC_ALPHA, BlendFactor::SRC_ALPHA_INVERSE });
+
+				for (unsigned int j = 0; j + 2u < command.ElemCount; j += 3u)
+				{
+					for (unsigned int k = 0; k < 3u; k++)
+					{
+						const ImDrawVert& vertex = commandList->VtxBuffer[command.VtxOffset + commandList->IdxBuffer[command.IdxOffset + j + k]];
+
+						vertices[k].position = glm::vec4((vertex.pos.x - position.x) * scale.x, (vertex.pos.y - position.y) * scale.y, 0.0f, 1.0f);
+						vertices[k].uv = glm::vec2(vertex.uv.x, vertex.uv.y);
+						vertices[k].slice = 0.0f;
+						vertices[k].color = glm::vec4(vertex.col & 0xffu, (vertex.col >> 8) & 0xffu, (vertex.col >> 16) & 0xffu, vertex.col >> 24) / 255.0f;
+					}
+
+					rasterizer.SubmitScreenTriangle(vertices[0], vertices[1], vertices[2], scissor);
+				}
+			}
+		}
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "Core/Core.h"
+
+#include "UserInterface/UserInterface.h"
+
+#include "swRasterizer.h"
+
+namespace Light {
+
+	// ImGui's draw lists are rasterized to the back buffer with their clip rectangles as scissors
+	class swUserInterface : public UserInterface
+	{
+	private:
+		std::vector<uint8_t> m_FontPixels;
+		swTextureView m_FontView;
+	public:
+		swUserInterface();
+		~swUserInterface();
+
+		void Begin() override;
+		void Draw(ImDrawData* drawData) override;
+	};
+
+}
\ No newline at end of file
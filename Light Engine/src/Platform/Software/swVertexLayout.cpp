@@ -0,0 +1,128 @@
+#include "ltpch.h"
+#include "swVertexLayout.h"
+#include "swBuffers.h"
+#include "swGraphicsContext.h"
+
+#include <glm/gtc/packing.hpp>
+
+#include <cstring>
+
+namespace Light {
+
+	namespace {
+
+		template<typename T>
+		inline T Read(const uint8_t* data, unsigned int i)
+		{
+			T value;
+			std::memcpy(&value, data + i * sizeof(T), sizeof(T));
+			return value;
+		}
+
+		template<typename T>
+		inline glm::vec4 ReadVector(const uint8_t* data, unsigned int count, float scale = 1.0f)
+		{
+			glm::vec4 vector(0.0f, 0.0f, 0.0f, 1.0f);
+			for (unsigned int i = 0; i < count; i++)
+				vector[i] = (float)Read<T>(data, i) * scale;
+
+			return vector;
+		}
+
+	}
+
+	swVertexLayout::swVertexLayout(std::shared_ptr<VertexBuffer> buffer, const std::vector<std::pair<std::string, VertexElementType>>& elements, VertexInputRate inputRate)
+		: m_Buffer(buffer), m_Data(nullptr), m_Stride(0u), m_InputRate(inputRate)
+	{
+		LT_PROFILE_FUNC();
+
+		if (std::shared_ptr<swVertexBuffer> vertexBuffer = std::dynamic_pointer_cast<swVertexBuffer>(buffer))
+			m_Data = vertexBuffer->GetData();
+		else if (std::shared_ptr<swStreamVertexBuffer> streamBuffer = std::dynamic_pointer_cast<swStreamVertexBuffer>(buffer))
+			m_Data = streamBuffer->GetData();
+
+		LT_CORE_ASSERT(m_Data, "swVertexLayout::swVertexLayout: failed to cast VertexBuffer to swVertexBuffer");
+
+		// vertex elements desc
+		m_Elements.reserve(elements.size());
+
+		for (const auto& element : elements)
+		{
+			m_Elements.push_back({ element.second, m_Stride });
+			m_Stride += GetTypeSize(element.second);
+		}
+	}
+
+	void swVertexLayout::Bind()
+	{
+		swGraphicsContext::GetPipeline().vertexLayout = this;
+	}
+
+	glm::vec4 swVertexLayout::Fetch(unsigned int element, unsigned int index) const
+	{
+		const swVertexElementDesc& desc = m_Elements[element];
+		const uint8_t* data = m_Data + (size_t)index * m_Stride + desc.offset;
+
+		switch (desc.type)
+		{
+		case VertexElementType::Int:         return ReadVector<int32_t>(data, 1u);
+		case VertexElementType::Int2:        return ReadVector<int32_t>(data, 2u);
+		case VertexElementType::Int3:        return ReadVector<int32_t>(data, 3u);
+		case VertexElementType::Int4:        return ReadVector<int32_t>(data, 4u);
+
+		case VertexElementType::UInt:        return ReadVector<uint32_t>(data, 1u);
+		case VertexElementType::UInt2:       return ReadVector<uint32_t>(data, 2u);
+		case VertexElementType::UInt3:       return ReadVector<uint32_t>(data, 3u);
+		case VertexElementType::UInt4:       return ReadVector<uint32_t>(data, 4u);
+
+		case VertexElementType::Float:       return ReadVector<float>(data, 1u);
+		case VertexElementType::Float2:      return ReadVector<float>(data, 2u);
+		case VertexElementType::Float3:      return ReadVector<float>(data, 3u);
+		case VertexElementType::Float4:      return ReadVector<float>(data, 4u);
+
+		case VertexElementType::Double:      return ReadVector<double>(data, 1u);
+		case VertexElementType::Double2:     return ReadVector<double>(data, 2u);
+		case VertexElementType::Double3:     return ReadVector<double>(data, 3u);
+		case VertexElementType::Double4:     return ReadVector<double>(data, 4u);
+
+		case VertexElementType::Half2:       return glm::vec4(glm::unpackHalf2x16(Read<uint32_t>(data, 0u)), 0.0f, 1.0f);
+		case VertexElementType::Half4:       return glm::unpackHalf4x16(Read<uint64_t>(data, 0u));
+
+		case VertexElementType::UShort2Norm: return ReadVector<uint16_t>(data, 2u, 1.0f / UINT16_MAX);
+		case VertexElementType::UShort4Norm: return ReadVector<uint16_t>(data, 4u, 1.0f / UINT16_MAX);
+
+		case VertexElementType::UByte4:      return ReadVector<uint8_t>(data, 4u);
+		case VertexElementType::UByte4Norm:  return ReadVector<uint8_t>(data, 4u, 1.0f / UINT8_MAX);
+
+		default: LT_CORE_ASSERT(false, "swVertexLayout::Fetch: invalid vertex type");
+		}
+	}
+
+	unsigned int swVertexLayout::GetTypeSize(VertexElementType type)
+	{
+		switch (type)
+		{
+		case VertexElementType::Int:     case VertexElementType::UInt:    case VertexElementType::Float:   return 4u;
+		case VertexElementType::Int2:    case VertexElementType::UInt2:   case VertexElementType::Float2:  return 8u;
+		case VertexElementType::Int3:    case VertexElementType::UInt3:   case VertexElementType::Float3:  return 12u;
+		case VertexElementType::Int4:    case VertexElementType::UInt4:   case VertexElementType::Float4:  return 16u;
+
+		case VertexElementType::Double:  return 8u;
+		case VertexElementType::Double2: return 16u;
+		case VertexElementType::Double3: return 24u;
+		case VertexElementType::Double4: return 32u;
+
+		case VertexElementType::Half2:       return 4u;
+		case VertexElementType::Half4:       return 8u;
+
+		case VertexElementType::UShort2Norm: return 4u;
+		case VertexElementType::UShort4Norm: return 8u;
+
+		case VertexElementType::UByte4:      return 4u;
+		case VertexElementType::UByte4Norm:  return 4u;
+
+		default: LT_CORE_ASSERT(false, "swVertexLayout::GetTypeSize: invalid vertex type");
+		}
+	}
+
+}
\ No newline at end of file
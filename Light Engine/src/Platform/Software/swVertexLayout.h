@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Core/Core.h"
+
+#include "Renderer/VertexLayout.h"
+
+#include <glm/glm.hpp>
+
+namespace Light {
+
+	struct swVertexElementDesc
+	{
+		VertexElementType type;
+		unsigned int offset;
+	};
+
+	// reads the vertex attributes of a buffer for swShader, elements are matched to the shader's inputs by location
+	class swVertexLayout : public VertexLayout
+	{
+	private:
+		std::shared_ptr<VertexBuffer> m_Buffer;
+		const uint8_t* m_Data;
+
+		std::vector<swVertexElementDesc> m_Elements;
+		unsigned int m_Stride;
+
+		VertexInputRate m_InputRate;
+	public:
+		swVertexLayout(std::shared_ptr<VertexBuffer> buffer, const std::vector<std::pair<std::string, VertexElementType>>& elements, VertexInputRate inputRate);
+
+		void Bind() override;
+
+		// missing components are read as (0, 0, 0, 1), integers are converted to float
+		glm::vec4 Fetch(unsigned int element, unsigned int index) const;
+
+		// getters
+		inline unsigned int GetElementCount() const { return (unsigned int)m_Elements.size(); }
+
+		inline bool IsPerInstance() const { return m_InputRate == VertexInputRate::PerInstance; }
+	private:
+		unsigned int GetTypeSize(VertexElementType type);
+	};
+
+}
\ No newline at end of file
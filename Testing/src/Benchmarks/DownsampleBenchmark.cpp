@@ -0,0 +1,72 @@
+#include "DownsampleBenchmark.h"
+
+#include <chrono>
+#include <random>
+
+void DownsampleBenchmark::Run(unsigned int regionCount /*= 2000u*/, unsigned int seed /*= 1337u*/)
+{
+	LT_TRACE("DownsampleBenchmark: {} regions per case of a 2048x2048 slice", regionCount);
+
+	Run(4u, regionCount, seed);
+	Run(2u, regionCount, seed);
+	Run(1u, regionCount, seed);
+}
+
+void DownsampleBenchmark::Run(unsigned int channels, unsigned int regionCount, unsigned int seed)
+{
+	/* locals */
+	std::mt19937 random(seed);
+	std::uniform_int_distribution<unsigned int> size(4u, 512u);
+
+	std::vector<Light::ImageRegion> regions(regionCount);
+	for (auto& region : regions)
+	{
+		region.width = size(random);
+		region.height = size(random);
+		region.x = random() % (2048u - region.width + 1u);
+		region.y = random() % (2048u - region.height + 1u);
+	}
+
+	std::vector<uint8_t> pixels(512u * 512u * channels);
+	for (auto& pixel : pixels)
+		pixel = (uint8_t)random();
+
+	std::vector<uint8_t> simd[2], scalar[2];
+	double simdMilliseconds = 0.0, scalarMilliseconds = 0.0;
+	bool exact = true;
+
+	for (const auto& region : regions)
+	{
+		const uint8_t* simdSource = pixels.data();
+		const uint8_t* scalarSource = pixels.data();
+		Light::ImageRegion sourceRegion = region;
+
+		for (unsigned int level = 1u; level < Light::GetMipLevelCount(2048u, 2048u); level++)
+		{
+			const Light::ImageRegion mipRegion = Light::GetMipRegion(sourceRegion, Light::GetMipSize(2048u, level), Light::GetMipSize(2048u, level));
+
+			simd[level & 1u].resize((size_t)mipRegion.width * mipRegion.height * channels);
+			scalar[level & 1u].resize(simd[level & 1u].size());
+
+			auto start = std::chrono::steady_clock::now();
+			Light::DownsampleRegion(simdSource, sourceRegion, channels, simd[level & 1u].data(), mipRegion);
+			simdMilliseconds += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+			start = std::chrono::steady_clock::now();
+			Light::DownsampleRegionScalar(scalarSource, sourceRegion, channels, scalar[level & 1u].data(), mipRegion);
+			scalarMilliseconds += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+			exact &= simd[level & 1u] == scalar[level & 1u];
+
+			simdSource = simd[level & 1u].data();
+			scalarSource = scalar[level & 1u].data();
+			sourceRegion = mipRegion;
+		}
+	}
+
+	if (!exact)
+		LT_ERROR("DownsampleBenchmark: {} channels: sse2 and scalar filters don't match", channels);
+
+	LT_TRACE("DownsampleBenchmark: {} channels: sse2 {:.2f}ms, scalar {:.2f}ms ({:.2f}x)",
+	         channels, simdMilliseconds, scalarMilliseconds, scalarMilliseconds / std::max(simdMilliseconds, 0.001));
+}
\ No newline at end of file
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <LightEngine.h>
+
+// downsamples random regions of a texture array sized slice through every mip level, the way TextureArray::GenerateMips does,
+// and logs the time of the SSE2 and the scalar filters, the two are checked to be bit exact
+class DownsampleBenchmark
+{
+public:
+	DownsampleBenchmark() = delete;
+
+	static void Run(unsigned int regionCount = 2000u, unsigned int seed = 1337u);
+private:
+	static void Run(unsigned int channels, unsigned int regionCount, unsigned int seed);
+};
\ No newline at end of file
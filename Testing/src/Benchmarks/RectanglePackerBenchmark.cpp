@@ -0,0 +1,65 @@
+#include "RectanglePackerBenchmark.h"
+
+#include <chrono>
+#include <random>
+
+void RectanglePackerBenchmark::Run(unsigned int rectangleCount /*= 5000u*/, unsigned int seed /*= 1337u*/)
+{
+	LT_TRACE("RectanglePackerBenchmark: {} rectangles per case into 2048x2048 slices", rectangleCount);
+
+	// sprite sized, glyph sized and mixed rectangles
+	Run("sprites", rectangleCount, 32u, 256u, seed, Light::PackingHeuristic::BestShortSideFit);
+	Run("glyphs ", rectangleCount, 4u, 48u, seed, Light::PackingHeuristic::BestShortSideFit);
+	Run("mixed  ", rectangleCount, 4u, 512u, seed, Light::PackingHeuristic::BestShortSideFit);
+	Run("mixed  ", rectangleCount, 4u, 512u, seed, Light::PackingHeuristic::BottomLeft);
+}
+
+void RectanglePackerBenchmark::Run(const char* name, unsigned int rectangleCount, unsigned int minSize, unsigned int maxSize, unsigned int seed,
+                                   Light::PackingHeuristic heuristic)
+{
+	/* locals */
+	std::mt19937 random(seed);
+	std::uniform_int_distribution<unsigned int> distribution(minSize, maxSize);
+
+	std::vector<glm::uvec2> rectangles(rectangleCount);
+	for (auto& rectangle : rectangles)
+		rectangle = glm::uvec2(distribution(random), distribution(random));
+
+	// largest first, same as ResolveTextures
+	std::sort(rectangles.begin(), rectangles.end(), [](const glm::uvec2& a, const glm::uvec2& b) { return a.x * a.y > b.x * b.y; });
+
+	std::vector<Light::RectanglePacker> slices;
+
+	const auto start = std::chrono::steady_clock::now();
+
+	for (const auto& rectangle : rectangles)
+	{
+		glm::uvec2 position;
+
+		bool packed = false;
+		for (unsigned int i = 0; i < slices.size() && !packed; i++)
+			packed = slices[i].Insert(rectangle.x, rectangle.y, position);
+
+		if (!packed)
+		{
+			slices.emplace_back(2048u, 2048u, heuristic);
+			slices.back().Insert(rectangle.x, rectangle.y, position);
+		}
+	}
+
+	const double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+	if (slices.empty())
+		return;
+
+	// the last slice is partially filled, it doesn't say anything about density
+	float density = 0.0f;
+	for (unsigned int i = 0; i + 1u < slices.size(); i++)
+		density += slices[i].GetOccupancy();
+
+	density = slices.size() > 1u ? density / (slices.size() - 1u) : slices.back().GetOccupancy();
+
+	LT_TRACE("RectanglePackerBenchmark: {} [{}, {}] {}: {:.2f}ms ({:.2f}us per rectangle), {} slices, {:.1f}% density",
+	         name, minSize, maxSize, heuristic == Light::PackingHeuristic::BottomLeft ? "bottom-left" : "best short side",
+	         milliseconds, milliseconds * 1000.0 / rectangleCount, slices.size(), density * 100.0f);
+}
\ No newline at end of file
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <LightEngine.h>
+
+// packs random rectangles into texture array sized slices, the way TextureArray::ResolveTextures does,
+// and logs the pack time and the packing density of the filled slices
+class RectanglePackerBenchmark
+{
+public:
+	RectanglePackerBenchmark() = delete;
+
+	static void Run(unsigned int rectangleCount = 5000u, unsigned int seed = 1337u);
+private:
+	static void Run(const char* name, unsigned int rectangleCount, unsigned int minSize, unsigned int maxSize, unsigned int seed,
+	                Light::PackingHeuristic heuristic);
+};
\ No newline at end of file
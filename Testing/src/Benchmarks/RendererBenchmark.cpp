@@ -0,0 +1,95 @@
+#include "RendererBenchmark.h"
+
+#include "Platform/Null/nullGraphicsContext.h"
+
+#include <chrono>
+#include <random>
+
+RendererBenchmark::QuadLayer::QuadLayer(std::shared_ptr<Light::Camera> camera, unsigned int quadCount, unsigned int frameCount, unsigned int seed)
+	: m_Camera(camera), m_Positions(quadCount), m_Sizes(quadCount), m_Angles(quadCount), m_Textures(quadCount), m_FramesLeft(frameCount)
+{
+	m_LayeDebugrName = "RendererBenchmark::QuadLayer";
+
+	/* locals */
+	std::mt19937 random(seed);
+	std::uniform_real_distribution<float> position(-500.0f, 500.0f);
+	std::uniform_real_distribution<float> size(4.0f, 64.0f);
+	std::uniform_real_distribution<float> angle(0.0f, 6.2831853f);
+	std::uniform_int_distribution<int> slice(0, 3);
+
+	for (unsigned int i = 0; i < quadCount; i++)
+	{
+		m_Positions[i] = glm::vec3(position(random), position(random), 0.0f);
+		m_Sizes[i] = glm::vec2(size(random), size(random));
+		m_Angles[i] = angle(random);
+		m_Textures[i] = Light::TextureCoordinates(0.0f, 0.0f, 1.0f, 1.0f, (float)slice(random));
+	}
+}
+
+void RendererBenchmark::QuadLayer::OnUpdate(float deltaTime)
+{
+	// the frame this is called in is still rendered
+	if (!--m_FramesLeft)
+		Light::Window::Get()->Close();
+}
+
+void RendererBenchmark::QuadLayer::OnRender(Light::RenderCommandList& commands)
+{
+	commands.BeginScene(m_Camera);
+
+	for (unsigned int i = 0; i < m_Positions.size(); i++)
+		commands.DrawQuad(m_Positions[i], m_Sizes[i], m_Angles[i], &m_Textures[i]);
+
+	commands.EndScene();
+}
+
+RendererBenchmark::BenchmarkApplication::BenchmarkApplication(Light::SubmissionMode mode, unsigned int layerCount, unsigned int quadCount,
+                                                              unsigned int frameCount, unsigned int seed)
+{
+	// initialize window
+	Light::WindowData wd;
+	wd.title = "RendererBenchmark";
+	wd.displayMode = Light::DisplayMode::Windowed;
+	wd.visible = false;
+
+	Light::GraphicsConfigurations gc;
+	gc.resolution = Light::Resolution(800.0f, 600.0f, Light::AspectRatio::AR_4_3);
+
+	m_Window = std::make_unique<Light::Window>(wd, gc, Light::GraphicsAPI::Null);
+
+	Light::Renderer::SetSubmissionMode(mode);
+
+	// attach layers, the quads are split between them
+	std::shared_ptr<Light::Camera> camera = std::make_shared<Light::Camera>(glm::vec2(0.0f, 0.0f), Light::GraphicsContext::GetAspectRatio(), 1000.0f);
+
+	for (unsigned int i = 0; i < layerCount; i++)
+		Light::Application::AttachLayer(new QuadLayer(camera, quadCount * (i + 1u) / layerCount - quadCount * i / layerCount, frameCount, seed + i));
+}
+
+void RendererBenchmark::Run(unsigned int quadCount /*= 100000u*/, unsigned int frameCount /*= 100u*/, unsigned int seed /*= 1337u*/)
+{
+	Run("immediate", Light::SubmissionMode::Immediate, 1u, quadCount, frameCount, seed);
+	Run("deferred ", Light::SubmissionMode::Deferred, 1u, quadCount, frameCount, seed);
+	Run("immediate", Light::SubmissionMode::Immediate, 12u, quadCount, frameCount, seed);
+	Run("deferred ", Light::SubmissionMode::Deferred, 12u, quadCount, frameCount, seed);
+}
+
+void RendererBenchmark::Run(const char* name, Light::SubmissionMode mode, unsigned int layerCount, unsigned int quadCount, unsigned int frameCount, unsigned int seed)
+{
+	BenchmarkApplication application(mode, layerCount, quadCount, frameCount, seed);
+
+	Light::nullGraphicsContext::ResetStats();
+
+	const auto start = std::chrono::steady_clock::now();
+	application.GameLoop();
+	const double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+	const Light::nullStats& stats = Light::nullGraphicsContext::GetTotalStats();
+
+	// logged before the application terminates the logger
+	LT_TRACE("RendererBenchmark: {}, {} quads in {} layers, {} frames: {:.3f}ms per frame, {:.1f} draw calls, {:.1f} shader binds, {:.0f} bytes mapped per frame",
+	         name, quadCount, layerCount, frameCount, milliseconds / frameCount, (double)stats.drawCalls / frameCount,
+	         (double)stats.shaderBinds / frameCount, (double)stats.bytesMapped / frameCount);
+
+	Light::Renderer::SetSubmissionMode(Light::SubmissionMode::Immediate);
+}
\ No newline at end of file
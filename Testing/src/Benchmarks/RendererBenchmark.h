@@ -0,0 +1,42 @@
+#pragma once
+
+#include <LightEngine.h>
+
+// runs a small application on the null graphics context whose layers draw random rotated quads for a number of frames
+// and logs the cpu time of a frame and what the graphics api was asked to do, the layers record on the job system
+// the applications run to completion before the testing application is created, there is only one application at a time
+class RendererBenchmark
+{
+private:
+	// draws its share of the quads every frame, closes the window after the last one
+	class QuadLayer : public Light::Layer
+	{
+	private:
+		std::shared_ptr<Light::Camera> m_Camera;
+
+		std::vector<glm::vec3> m_Positions;
+		std::vector<glm::vec2> m_Sizes;
+		std::vector<float> m_Angles;
+		std::vector<Light::TextureCoordinates> m_Textures;
+
+		unsigned int m_FramesLeft;
+	public:
+		QuadLayer(std::shared_ptr<Light::Camera> camera, unsigned int quadCount, unsigned int frameCount, unsigned int seed);
+
+		void OnUpdate(float deltaTime) override;
+		void OnRender(Light::RenderCommandList& commands) override;
+	};
+
+	// hidden window on the null graphics context
+	class BenchmarkApplication : public Light::Application
+	{
+	public:
+		BenchmarkApplication(Light::SubmissionMode mode, unsigned int layerCount, unsigned int quadCount, unsigned int frameCount, unsigned int seed);
+	};
+public:
+	RendererBenchmark() = delete;
+
+	static void Run(unsigned int quadCount = 100000u, unsigned int frameCount = 100u, unsigned int seed = 1337u);
+private:
+	static void Run(const char* name, Light::SubmissionMode mode, unsigned int layerCount, unsigned int quadCount, unsigned int frameCount, unsigned int seed);
+};
\ No newline at end of file
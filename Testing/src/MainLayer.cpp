@@ -1,8 +1,28 @@
 #include "MainLayer.h"
 
+#include "Benchmarks/DownsampleBenchmark.h"
+#include "Benchmarks/RectanglePackerBenchmark.h"
+
+#include "Tests/DownsampleRegionTest.h"
+#include "Tests/InstrumentorTest.h"
+#include "Tests/JobSystemTest.h"
+#include "Tests/QuadInstanceTest.h"
+#include "Tests/ShaderCacheTest.h"
+#include "Tests/StaticBatchDefragmentTest.h"
+
 MainLayer::MainLayer()
 {
 	LT_CORE_TRACE("MainLayer::MainLayer");
+
+	RectanglePackerBenchmark::Run();
+	DownsampleBenchmark::Run();
+
+	DownsampleRegionTest::Run();
+	InstrumentorTest::Run();
+	JobSystemTest::Run();
+	QuadInstanceTest::Run();
+	ShaderCacheTest::Run();
+	StaticBatchDefragmentTest::Run();
 }
 
 MainLayer::~MainLayer()
@@ -14,4 +34,4 @@ void MainLayer::OnUpdate(float DeltaTime)
 {
 	if (Light::Input::GetKey(KEY_ESCAPE))
 		Light::Window::Get()->Close();
-}
+}
\ No newline at end of file
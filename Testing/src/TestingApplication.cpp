@@ -3,6 +3,8 @@
 
 #include "MainLayer.h"
 
+#include "Benchmarks/RendererBenchmark.h"
+
 TestingApplication::TestingApplication()
 {
 	LT_PROFILE_FUNC();
@@ -31,5 +33,9 @@ TestingApplication::~TestingApplication()
 Light::Application* Light::CreateApplication()
 {
 	LT_PROFILE_FUNC();
+
+	// runs its own applications, they're done before this one is created
+	RendererBenchmark::Run();
+
 	return new TestingApplication();
 }
\ No newline at end of file
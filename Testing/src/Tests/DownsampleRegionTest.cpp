@@ -0,0 +1,108 @@
+#include "DownsampleRegionTest.h"
+
+#include <random>
+
+bool DownsampleRegionTest::Run(unsigned int seed /*= 1337u*/)
+{
+	bool passed = true;
+
+	// 5x3 region at (3, 1) of a 16x8 image, the next level's region is (1, 0) 3x2
+	// its left column and top row reach outside the region and are clamped to the region's first column and row
+	passed &= Check("1 channel at an offset", { 10u,  20u,  30u,  40u,  50u,
+	                                            60u,  70u,  80u,  90u, 100u,
+	                                           110u, 120u, 130u, 140u, 150u },
+	                { 3u, 1u, 5u, 3u }, 1u, { 1u, 0u, 3u, 2u },
+	                { 10u, 25u, 45u,    // (10*4 + 2)/4, (20*2 + 30*2 + 2)/4, (40*2 + 50*2 + 2)/4
+	                  85u, 100u, 120u }); // (60*2 + 110*2 + 2)/4, (70 + 80 + 120 + 130 + 2)/4, (90 + 100 + 140 + 150 + 2)/4
+
+	// whole 3x5 image into 1x2, the last column and row have no pair and are dropped
+	passed &= Check("2 channels of an odd image", { 0u, 255u,   4u, 251u,   8u, 0u,
+	                                                1u, 254u,   5u, 250u,   9u, 0u,
+	                                                2u, 253u,   6u, 249u,  10u, 0u,
+	                                                3u, 252u,   7u, 248u,  11u, 0u,
+	                                              100u,   1u, 200u,   2u,  50u, 3u },
+	                { 0u, 0u, 3u, 5u }, 2u, { 0u, 0u, 1u, 2u },
+	                { 3u, 253u,    // (0 + 4 + 1 + 5 + 2)/4, (255 + 251 + 254 + 250 + 2)/4
+	                  5u, 251u }); // (2 + 6 + 3 + 7 + 2)/4, (253 + 249 + 252 + 248 + 2)/4
+
+	// sums of 1019 and 1020 stay at 255, sums of 3 and 4 round to 0 and 1
+	passed &= Check("4 channels rounding", { 255u, 255u, 0u, 0u,   255u, 255u, 0u, 0u,
+	                                         255u, 255u, 0u, 0u,   255u, 254u, 1u, 2u },
+	                { 0u, 0u, 2u, 2u }, 4u, { 0u, 0u, 1u, 1u },
+	                { 255u, 255u, 0u, 1u });
+
+	// 35x2 region at (1, 0) of a 64x2 image, wide enough for the simd blocks
+	// the top row is 4 times the column and the bottom row is 0, a texel of the next level is the sum of its two columns
+	{
+		std::vector<uint8_t> source(35u * 2u, 0u);
+		for (unsigned int x = 0u; x < 35u; x++)
+			source[x] = (uint8_t)((x + 1u) * 4u);
+
+		passed &= Check("1 channel wide", source, { 1u, 0u, 35u, 2u }, 1u, { 0u, 0u, 18u, 1u },
+		                { 2u, 5u, 9u, 13u, 17u, 21u, 25u, 29u, 33u, 37u, 41u, 45u, 49u, 53u, 57u, 61u, 65u, 69u });
+	}
+
+	// simd and scalar paths give the same texels
+	for (unsigned int channels : { 1u, 2u, 4u })
+	{
+		passed &= CheckSIMD(channels, 64u, 64u, { 0u, 0u, 64u, 64u }, seed);
+		passed &= CheckSIMD(channels, 64u, 32u, { 5u, 3u, 37u, 19u }, seed);
+		passed &= CheckSIMD(channels, 128u, 16u, { 1u, 1u, 101u, 7u }, seed);
+		passed &= CheckSIMD(channels, 256u, 256u, { 130u, 77u, 126u, 179u }, seed);
+		passed &= CheckSIMD(channels, 33u, 17u, { 31u, 15u, 2u, 2u }, seed);
+	}
+
+	if (passed)
+		LT_TRACE("DownsampleRegionTest: passed");
+
+	return passed;
+}
+
+bool DownsampleRegionTest::Check(const char* name, const std::vector<uint8_t>& source, const Light::ImageRegion& region, unsigned int channels,
+                                 const Light::ImageRegion& mipRegion, const std::vector<uint8_t>& expected)
+{
+	/* locals */
+	std::vector<uint8_t> simd(expected.size()), scalar(expected.size());
+
+	Light::DownsampleRegion(source.data(), region, channels, simd.data(), mipRegion);
+	Light::DownsampleRegionScalar(source.data(), region, channels, scalar.data(), mipRegion);
+
+	bool passed = true;
+	for (size_t i = 0u; i < expected.size(); i++)
+	{
+		if (simd[i] != expected[i] || scalar[i] != expected[i])
+		{
+			LT_ERROR("DownsampleRegionTest: {}: texel {} channel {} is {} (scalar {}) instead of {}", name,
+			         i / channels, i % channels, simd[i], scalar[i], expected[i]);
+			passed = false;
+		}
+	}
+
+	return passed;
+}
+
+bool DownsampleRegionTest::CheckSIMD(unsigned int channels, unsigned int width, unsigned int height, const Light::ImageRegion& region, unsigned int seed)
+{
+	/* locals */
+	std::mt19937 random(seed);
+	const Light::ImageRegion mipRegion = Light::GetMipRegion(region, Light::GetMipSize(width, 1u), Light::GetMipSize(height, 1u));
+
+	std::vector<uint8_t> source((size_t)region.width * region.height * channels);
+	for (auto& texel : source)
+		texel = (uint8_t)random();
+
+	std::vector<uint8_t> simd((size_t)mipRegion.width * mipRegion.height * channels);
+	std::vector<uint8_t> scalar(simd.size());
+
+	Light::DownsampleRegion(source.data(), region, channels, simd.data(), mipRegion);
+	Light::DownsampleRegionScalar(source.data(), region, channels, scalar.data(), mipRegion);
+
+	if (simd != scalar)
+	{
+		LT_ERROR("DownsampleRegionTest: simd and scalar differ for {} channels, region ({}, {}) {}x{} of a {}x{} image",
+		         channels, region.x, region.y, region.width, region.height, width, height);
+		return false;
+	}
+
+	return true;
+}
\ No newline at end of file
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <LightEngine.h>
+
+// downsamples small regions whose next level was worked out by hand, 1, 2 and 4 channels, odd sizes, regions at an
+// offset whose edges are clamped and rounding at 0 and 255, then compares the simd path with the scalar one on random regions
+class DownsampleRegionTest
+{
+public:
+	DownsampleRegionTest() = delete;
+
+	// returns false and logs an error for every region that doesn't match
+	static bool Run(unsigned int seed = 1337u);
+private:
+	// source holds only the region, expected only the mip region
+	static bool Check(const char* name, const std::vector<uint8_t>& source, const Light::ImageRegion& region, unsigned int channels,
+	                  const Light::ImageRegion& mipRegion, const std::vector<uint8_t>& expected);
+
+	static bool CheckSIMD(unsigned int channels, unsigned int width, unsigned int height, const Light::ImageRegion& region, unsigned int seed);
+};
\ No newline at end of file
@@ -0,0 +1,137 @@
+#include "InstrumentorTest.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+#define LT_TEST_TRACE_PATH "InstrumentorTest.lttrace"
+#define LT_TEST_JSON_PATH  "InstrumentorTest.json"
+
+// scopes on the main thread and on the other thread
+#define LT_TEST_MAIN_SCOPES  3u
+#define LT_TEST_OTHER_SCOPES 2u
+
+bool InstrumentorTest::Run()
+{
+	/* locals */
+	Light::Instrumentor& instrumentor = Light::Instrumentor::Get();
+	const std::string applicationSession = instrumentor.IsActive() ? instrumentor.GetSessionPath() : "";
+
+	bool passed = true;
+
+	// outlives the first session
+	std::unique_ptr<Light::InstrumentationTimer> stale;
+
+	instrumentor.BeginSession(LT_TEST_TRACE_PATH);
+	stale = std::make_unique<Light::InstrumentationTimer>("InstrumentorTest::Stale");
+	instrumentor.EndSession();
+
+	instrumentor.BeginSession(LT_TEST_TRACE_PATH);
+	stale.reset();
+
+	for (unsigned int i = 0u; i < LT_TEST_MAIN_SCOPES; i++)
+		Light::InstrumentationTimer timer("InstrumentorTest::Main");
+
+	std::thread other([]()
+	{
+		for (unsigned int i = 0u; i < LT_TEST_OTHER_SCOPES; i++)
+			Light::InstrumentationTimer timer("InstrumentorTest::Other");
+	});
+	other.join();
+
+	instrumentor.EndSession();
+
+	// without a session
+	instrumentor.EndSession();
+
+	if (!Light::Instrumentor::ConvertToChromeTrace(LT_TEST_TRACE_PATH, LT_TEST_JSON_PATH))
+	{
+		LT_ERROR("InstrumentorTest: failed to convert the trace");
+		passed = false;
+	}
+	else
+	{
+		/* locals */
+		const std::vector<TraceEvent> events = ReadEvents(LT_TEST_JSON_PATH);
+
+		unsigned int mainCount = 0u, otherCount = 0u;
+		int mainThread = -1, otherThread = -1;
+
+		for (const TraceEvent& event : events)
+		{
+			unsigned int& count = event.name == "InstrumentorTest::Main" ? mainCount : otherCount;
+			int& thread = event.name == "InstrumentorTest::Main" ? mainThread : otherThread;
+
+			if (event.name != "InstrumentorTest::Main" && event.name != "InstrumentorTest::Other")
+			{
+				LT_ERROR("InstrumentorTest: unexpected event: {}", event.name);
+				passed = false;
+				continue;
+			}
+
+			count++;
+			if (thread != -1 && thread != (int)event.threadID)
+			{
+				LT_ERROR("InstrumentorTest: {} events are on threads {} and {}", event.name, thread, event.threadID);
+				passed = false;
+			}
+
+			thread = (int)event.threadID;
+		}
+
+		if (mainCount != LT_TEST_MAIN_SCOPES || otherCount != LT_TEST_OTHER_SCOPES)
+		{
+			LT_ERROR("InstrumentorTest: {} main and {} other events instead of {} and {}", mainCount, otherCount, LT_TEST_MAIN_SCOPES, LT_TEST_OTHER_SCOPES);
+			passed = false;
+		}
+		else if (mainThread == otherThread)
+		{
+			LT_ERROR("InstrumentorTest: the events of both threads are on thread {}", mainThread);
+			passed = false;
+		}
+	}
+
+	std::remove(LT_TEST_TRACE_PATH);
+	std::remove(LT_TEST_JSON_PATH);
+
+	if (!applicationSession.empty())
+		instrumentor.BeginSession(applicationSession);
+
+	if (passed)
+		LT_TRACE("InstrumentorTest: passed");
+
+	return passed;
+}
+
+std::vector<InstrumentorTest::TraceEvent> InstrumentorTest::ReadEvents(const std::string& jsonPath)
+{
+	/* locals */
+	std::ifstream file(jsonPath);
+	std::stringstream stream;
+	stream << file.rdbuf();
+
+	const std::string json = stream.str();
+	const std::string nameKey = "\"name\":\"", threadKey = "\"tid\":";
+
+	std::vector<TraceEvent> events;
+
+	// ConvertToChromeTrace writes the keys of every event in the same order, the name before the thread
+	for (size_t name = json.find(nameKey); name != std::string::npos; name = json.find(nameKey, name))
+	{
+		name += nameKey.size();
+
+		const size_t nameEnd = json.find('"', name);
+		const size_t thread = json.find(threadKey, nameEnd);
+		if (nameEnd == std::string::npos || thread == std::string::npos)
+			break;
+
+		// the engine's scopes share the trace
+		if (json.compare(name, 18u, "InstrumentorTest::") == 0)
+			events.push_back({ json.substr(name, nameEnd - name), (unsigned int)std::stoul(json.substr(thread + threadKey.size())) });
+
+		name = nameEnd;
+	}
+
+	return events;
+}
\ No newline at end of file
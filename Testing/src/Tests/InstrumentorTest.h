@@ -0,0 +1,24 @@
+#pragma once
+
+#include <LightEngine.h>
+
+// records scopes on two threads into a session, converts the trace to JSON and checks the events' names and threads,
+// a scope begun in an earlier session and ended in this one is left out
+// the application's session is ended and begun again afterwards, its trace only covers what follows the test
+class InstrumentorTest
+{
+private:
+	struct TraceEvent
+	{
+		std::string name;
+		unsigned int threadID;
+	};
+public:
+	InstrumentorTest() = delete;
+
+	// returns false and logs an error for every check that fails
+	static bool Run();
+private:
+	// only the events of this test's scopes, the engine's own scopes (ie. the job system's) are left out
+	static std::vector<TraceEvent> ReadEvents(const std::string& jsonPath);
+};
\ No newline at end of file
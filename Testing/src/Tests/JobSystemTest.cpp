@@ -0,0 +1,155 @@
+#include "JobSystemTest.h"
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+bool JobSystemTest::Run()
+{
+	bool passed = true;
+
+	passed &= CheckParallelFor(10007u, 1u);
+	passed &= CheckParallelFor(10007u, 64u);
+	passed &= CheckParallelFor(10007u, 20000u);
+	passed &= CheckParallelFor(1u, 64u);
+
+	passed &= CheckContinuations(16u);
+	passed &= CheckContinuations(0u);
+
+	passed &= CheckExceptions();
+
+	if (passed)
+		LT_TRACE("JobSystemTest: passed");
+
+	return passed;
+}
+
+bool JobSystemTest::CheckParallelFor(unsigned int count, unsigned int grainSize)
+{
+	/* locals */
+	std::vector<std::atomic<unsigned int>> visits(count);
+	std::atomic<bool> invalidRange = false;
+
+	for (auto& visit : visits)
+		visit = 0u;
+
+	Light::JobSystem::ParallelFor(count, grainSize, [&](unsigned int begin, unsigned int end)
+	{
+		if (begin >= end || end > count || end - begin > grainSize)
+			invalidRange = true;
+
+		for (unsigned int i = begin; i < end && i < count; i++)
+			visits[i]++;
+	});
+
+	bool passed = !invalidRange;
+	if (invalidRange)
+		LT_ERROR("JobSystemTest: ParallelFor({}, {}): a subrange is empty, past the end or larger than the grain size", count, grainSize);
+
+	for (unsigned int i = 0u; i < count; i++)
+	{
+		if (visits[i] != 1u)
+		{
+			LT_ERROR("JobSystemTest: ParallelFor({}, {}): element {} visited {} times", count, grainSize, i, visits[i].load());
+			passed = false;
+			break;
+		}
+	}
+
+	return passed;
+}
+
+bool JobSystemTest::CheckContinuations(unsigned int childCount)
+{
+	/* locals */
+	std::atomic<unsigned int> finishedChildren = 0u;
+	std::atomic<bool> parentFinished = false;
+	unsigned int finishedBeforeContinuation = ~0u;
+	bool parentBeforeContinuation = false;
+
+	// the children are created before the parent is queued, so it can't finish before them
+	Light::JobHandle parent = Light::JobSystem::Create([&]() { parentFinished = true; });
+
+	for (unsigned int i = 0u; i < childCount; i++)
+	{
+		Light::JobSystem::Schedule([&]()
+		{
+			std::this_thread::sleep_for(std::chrono::microseconds(200));
+			finishedChildren++;
+		}, parent);
+	}
+
+	Light::JobHandle continuation = Light::JobSystem::Then(parent, [&]()
+	{
+		finishedBeforeContinuation = finishedChildren;
+		parentBeforeContinuation = parentFinished;
+	});
+
+	Light::JobSystem::Run(parent);
+	Light::JobSystem::Wait(continuation);
+
+	// a continuation of a finished job is queued right away
+	Light::JobHandle late = Light::JobSystem::Then(parent, []() {});
+	Light::JobSystem::Wait(late);
+
+	if (finishedBeforeContinuation != childCount || !parentBeforeContinuation)
+	{
+		LT_ERROR("JobSystemTest: Then: the continuation ran after {} of {} children, {} the parent's task", finishedBeforeContinuation, childCount,
+		         parentBeforeContinuation ? "after" : "before");
+		return false;
+	}
+
+	return true;
+}
+
+bool JobSystemTest::CheckExceptions()
+{
+	/* locals */
+	bool passed = true;
+
+	const auto rethrows = [](const char* name, const std::function<void()>& wait)
+	{
+		try
+		{
+			wait();
+		}
+		catch (const std::runtime_error& error)
+		{
+			if (std::string(error.what()) == "JobSystemTest")
+				return true;
+		}
+		catch (...)
+		{
+		}
+
+		LT_ERROR("JobSystemTest: {}: the job's exception wasn't rethrown by Wait", name);
+		return false;
+	};
+
+	passed &= rethrows("job", []()
+	{
+		Light::JobSystem::Wait(Light::JobSystem::Schedule([]() { throw std::runtime_error("JobSystemTest"); }));
+	});
+
+	passed &= rethrows("child", []()
+	{
+		Light::JobHandle parent = Light::JobSystem::Create(nullptr);
+		Light::JobSystem::Schedule([]() { throw std::runtime_error("JobSystemTest"); }, parent);
+		Light::JobSystem::Schedule([]() {}, parent);
+
+		Light::JobSystem::Run(parent);
+		Light::JobSystem::Wait(parent);
+	});
+
+	passed &= rethrows("ParallelFor", []()
+	{
+		Light::JobSystem::ParallelFor(1000u, 10u, [](unsigned int begin, unsigned int end)
+		{
+			if (begin <= 500u && 500u < end)
+				throw std::runtime_error("JobSystemTest");
+		});
+	});
+
+	return passed;
+}
\ No newline at end of file
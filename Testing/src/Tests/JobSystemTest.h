@@ -0,0 +1,18 @@
+#pragma once
+
+#include <LightEngine.h>
+
+// runs on the application's job system: ParallelFor covers its range without overlap for several grain sizes,
+// continuations run after their job and its children, and exceptions thrown by jobs are rethrown by Wait
+class JobSystemTest
+{
+public:
+	JobSystemTest() = delete;
+
+	// returns false and logs an error for every case that fails
+	static bool Run();
+private:
+	static bool CheckParallelFor(unsigned int count, unsigned int grainSize);
+	static bool CheckContinuations(unsigned int childCount);
+	static bool CheckExceptions();
+};
\ No newline at end of file
@@ -0,0 +1,146 @@
+#include "QuadInstanceTest.h"
+
+#include <glm/gtc/packing.hpp>
+
+#include <cstring>
+
+// the record quantizes the texture rect to unorm16 and the tint to unorm8, the vertex path writes floats
+#define LT_TEST_POSITION_EPSILON 1e-4f
+#define LT_TEST_UV_EPSILON       (0.5f / 65535.0f + 1e-6f)
+#define LT_TEST_TINT_EPSILON     (0.5f / 255.0f + 1e-6f)
+
+bool QuadInstanceTest::Run()
+{
+	/* locals */
+	const Light::TextureCoordinates texture(0.0f, 0.0f, 1.0f, 1.0f, 0.0f);
+	const Light::TextureCoordinates subTexture(0.25f, 0.125f, 0.6f, 0.9f, 3.0f);
+
+	bool passed = true;
+
+	passed &= Check("unrotated"          , glm::vec3(10.0f, -20.0f, 0.5f), glm::vec2(64.0f, 32.0f), 0.0f, texture, glm::vec4(1.0f));
+	passed &= Check("rotated"            , glm::vec3(-3.0f, 7.5f, 0.25f), glm::vec2(40.0f, 90.0f), 0.7f, texture, glm::vec4(0.2f, 0.4f, 0.6f, 0.8f));
+	passed &= Check("rotated backwards"  , glm::vec3(0.0f), glm::vec2(1.0f, 3.0f), -2.5f, texture, glm::vec4(1.0f, 0.0f, 0.5f, 1.0f));
+	passed &= Check("sub-texture"        , glm::vec3(100.0f, 50.0f, 0.0f), glm::vec2(16.0f, 16.0f), 0.0f, subTexture, glm::vec4(1.0f));
+	passed &= Check("rotated sub-texture", glm::vec3(-250.0f, 125.0f, 0.75f), glm::vec2(24.0f, 8.0f), 1.3f, subTexture, glm::vec4(0.9f, 0.1f, 0.3f, 0.5f));
+
+	if (passed)
+		LT_TRACE("QuadInstanceTest: passed");
+
+	return passed;
+}
+
+bool QuadInstanceTest::Check(const char* name, const glm::vec3& position, const glm::vec2& size, float angle,
+                             const Light::TextureCoordinates& texture, const glm::vec4& tint)
+{
+	/* locals */
+	const QuadVertices instanced = Unpack(Light::QuadInstance::Pack(position, size / 2.0f, angle, texture, tint));
+	const QuadVertices vertices = WriteQuad(position, size, angle, texture, tint);
+
+	const auto matches = [](const glm::vec4& a, const glm::vec4& b, float epsilon)
+	{
+		const glm::vec4 difference = glm::abs(a - b);
+		const glm::vec4 tolerance = epsilon * glm::max(glm::vec4(1.0f), glm::abs(b));
+
+		return glm::all(glm::lessThanEqual(difference, tolerance));
+	};
+
+	bool passed = matches(instanced.tint, vertices.tint, LT_TEST_TINT_EPSILON);
+	if (!passed)
+		LT_ERROR("QuadInstanceTest: {}: tint ({}, {}, {}, {}) instead of ({}, {}, {}, {})", name,
+		         instanced.tint.r, instanced.tint.g, instanced.tint.b, instanced.tint.a,
+		         vertices.tint.r, vertices.tint.g, vertices.tint.b, vertices.tint.a);
+
+	for (unsigned int i = 0; i < 4; i++)
+	{
+		const glm::vec3& corner = instanced.positions[i];
+		const glm::vec3& texCoords = instanced.texCoords[i];
+
+		if (!matches(glm::vec4(corner, 0.0f), glm::vec4(vertices.positions[i], 0.0f), LT_TEST_POSITION_EPSILON))
+		{
+			LT_ERROR("QuadInstanceTest: {}: corner {} at ({}, {}, {}) instead of ({}, {}, {})", name, i,
+			         corner.x, corner.y, corner.z, vertices.positions[i].x, vertices.positions[i].y, vertices.positions[i].z);
+			passed = false;
+		}
+
+		if (!matches(glm::vec4(texCoords, 0.0f), glm::vec4(vertices.texCoords[i], 0.0f), LT_TEST_UV_EPSILON))
+		{
+			LT_ERROR("QuadInstanceTest: {}: corner {} samples ({}, {}, {}) instead of ({}, {}, {})", name, i,
+			         texCoords.x, texCoords.y, texCoords.z, vertices.texCoords[i].x, vertices.texCoords[i].y, vertices.texCoords[i].z);
+			passed = false;
+		}
+	}
+
+	return passed;
+}
+
+QuadInstanceTest::QuadVertices QuadInstanceTest::Unpack(const Light::QuadInstance& instance)
+{
+	/* locals */
+	QuadVertices vertices;
+
+	const float s = std::sin(instance.center.w);
+	const float c = std::cos(instance.center.w);
+
+	uint64_t packedRect;
+	std::memcpy(&packedRect, instance.texRect, sizeof(instance.texRect));
+	const glm::vec4 rect = glm::unpackUnorm4x16(packedRect);
+
+	// TOP_LEFT [ -1, -1 ], TOP_RIGHT [ 1, -1 ], BOTTOM_RIGHT [ 1, 1 ], BOTTOM_LEFT [ -1, 1 ]
+	const glm::vec2 corners[4] = { { -1.0f, -1.0f }, { 1.0f, -1.0f }, { 1.0f, 1.0f }, { -1.0f, 1.0f } };
+
+	for (unsigned int i = 0; i < 4; i++)
+	{
+		const glm::vec2 offset = corners[i] * instance.halfSize;
+
+		vertices.positions[i] = glm::vec3(instance.center.x + offset.x * c - offset.y * s, instance.center.y + offset.x * s + offset.y * c, instance.center.z);
+		vertices.texCoords[i] = glm::vec3(glm::mix(glm::vec2(rect.x, rect.y), glm::vec2(rect.z, rect.w), corners[i] * 0.5f + 0.5f), (float)instance.slice[0]);
+	}
+
+	uint32_t packedTint;
+	std::memcpy(&packedTint, instance.tint, sizeof(instance.tint));
+	vertices.tint = glm::unpackUnorm4x8(packedTint);
+
+	return vertices;
+}
+
+QuadInstanceTest::QuadVertices QuadInstanceTest::WriteQuad(const glm::vec3& position, const glm::vec2& size, float angle,
+                                                           const Light::TextureCoordinates& texture, const glm::vec4& tint)
+{
+	/* locals */
+	QuadVertices vertices;
+
+	if (angle == 0.0f)
+	{
+		const float xMin = position.x - size.x / 2.0f;
+		const float xMax = position.x + size.x / 2.0f;
+		const float yMin = position.y - size.y / 2.0f;
+		const float yMax = position.y + size.y / 2.0f;
+
+		vertices.positions[0] = { xMin, yMin, position.z };
+		vertices.positions[1] = { xMax, yMin, position.z };
+		vertices.positions[2] = { xMax, yMax, position.z };
+		vertices.positions[3] = { xMin, yMax, position.z };
+	}
+	else
+	{
+		const float COS = std::cos(angle);
+		const float SIN = std::sin(angle);
+
+		const glm::vec2 quadCos = COS * size / 2.0f;
+		const glm::vec2 quadSin = SIN * size / 2.0f;
+
+		vertices.positions[0] = glm::vec3(-(quadCos.x - quadSin.y), -(quadSin.x + quadCos.y), 0.0f) + position;
+		vertices.positions[1] = glm::vec3(quadCos.x - -quadSin.y, quadSin.x + -quadCos.y, 0.0f) + position;
+		vertices.positions[2] = glm::vec3(quadCos.x - quadSin.y, quadSin.x + quadCos.y, 0.0f) + position;
+		vertices.positions[3] = glm::vec3(-quadCos.x - quadSin.y, -quadSin.x + quadCos.y, 0.0f) + position;
+	}
+
+	vertices.texCoords[0] = { texture.xMin, texture.yMin, texture.sliceIndex };
+	vertices.texCoords[1] = { texture.xMax, texture.yMin, texture.sliceIndex };
+	vertices.texCoords[2] = { texture.xMax, texture.yMax, texture.sliceIndex };
+	vertices.texCoords[3] = { texture.xMin, texture.yMax, texture.sliceIndex };
+
+	vertices.tint = tint;
+
+	return vertices;
+}
\ No newline at end of file
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <LightEngine.h>
+
+#include "Renderer/QuadInstance.h"
+
+// packs unrotated, rotated and sub-texture quads into QuadInstance records, unpacks them the way the instanced vertex
+// shaders do and compares the corners, texture coordinates and tint with what the vertex path writes for the same quads
+class QuadInstanceTest
+{
+private:
+	// TOP_LEFT, TOP_RIGHT, BOTTOM_RIGHT, BOTTOM_LEFT
+	struct QuadVertices
+	{
+		glm::vec3 positions[4];
+		glm::vec3 texCoords[4];
+		glm::vec4 tint;
+	};
+public:
+	QuadInstanceTest() = delete;
+
+	// returns false and logs an error for every quad that doesn't match
+	static bool Run();
+private:
+	static bool Check(const char* name, const glm::vec3& position, const glm::vec2& size, float angle,
+	                  const Light::TextureCoordinates& texture, const glm::vec4& tint);
+
+	// QuadShaderSrc_Instanced_VS
+	static QuadVertices Unpack(const Light::QuadInstance& instance);
+
+	// Renderer::WriteQuad and Renderer::PushQuad, the unrotated overload is used when there's no angle like DrawQuad does
+	static QuadVertices WriteQuad(const glm::vec3& position, const glm::vec2& size, float angle,
+	                              const Light::TextureCoordinates& texture, const glm::vec4& tint);
+};
\ No newline at end of file
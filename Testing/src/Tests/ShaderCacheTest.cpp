@@ -0,0 +1,114 @@
+#include "ShaderCacheTest.h"
+
+#include <cstdio>
+
+#define LT_TEST_SHADER_CACHE_PATH "ShaderCacheTest.bin"
+
+namespace {
+
+	class CountedShader : public Light::Shader
+	{
+	public:
+		void Bind() override {}
+	};
+
+}
+
+ShaderCacheTest::CountingCompiler::CountingCompiler(const std::string& deviceName, bool rejectBinaries, Counts& counts)
+	: m_DeviceName(deviceName), b_RejectBinaries(rejectBinaries), m_Counts(counts)
+{
+}
+
+std::shared_ptr<Light::Shader> ShaderCacheTest::CountingCompiler::Compile(const std::string& vertexSource, const std::string& fragmentSource, std::vector<uint8_t>& binary)
+{
+	m_Counts.compiles++;
+
+	// the 'binary' is the sources, Load checks it's handed back the one built for them
+	binary.assign(vertexSource.begin(), vertexSource.end());
+	binary.insert(binary.end(), fragmentSource.begin(), fragmentSource.end());
+
+	return std::make_shared<CountedShader>();
+}
+
+std::shared_ptr<Light::Shader> ShaderCacheTest::CountingCompiler::Load(const std::string& vertexSource, const std::string& fragmentSource, const std::vector<uint8_t>& binary)
+{
+	m_Counts.loads++;
+
+	if (b_RejectBinaries || binary.size() != vertexSource.size() + fragmentSource.size() ||
+	    !std::equal(vertexSource.begin(), vertexSource.end(), binary.begin()) || !std::equal(fragmentSource.begin(), fragmentSource.end(), binary.begin() + vertexSource.size()))
+		return nullptr;
+
+	return std::make_shared<CountedShader>();
+}
+
+bool ShaderCacheTest::Run()
+{
+	/* locals */
+	const std::string vertex = "#version 440 core\nvoid main() { gl_Position = vec4(0.0); }";
+	const std::string fragment = "#version 440 core\nout vec4 FSOut_FragColor;\nvoid main() { FSOut_FragColor = vec4(1.0); }";
+	const std::string otherFragment = "#version 440 core\nout vec4 FSOut_FragColor;\nvoid main() { FSOut_FragColor = vec4(0.5); }";
+
+	Counts counts;
+	bool passed = true;
+
+	// programs the application already got stay alive, only the cache's bookkeeping is swapped out
+	Light::ShaderCache::Terminate();
+	std::remove(LT_TEST_SHADER_CACHE_PATH);
+
+	// identical sources are compiled once and share the program
+	{
+		Light::ShaderCache::Init(LT_TEST_SHADER_CACHE_PATH, std::make_unique<CountingCompiler>("device a", false, counts));
+
+		std::shared_ptr<Light::Shader> first = Light::ShaderCache::GetShader(vertex, fragment);
+		std::shared_ptr<Light::Shader> second = Light::ShaderCache::GetShader(vertex, fragment);
+		std::shared_ptr<Light::Shader> other = Light::ShaderCache::GetShader(vertex, otherFragment);
+
+		passed &= Expect("identical sources", counts, 2u, 0u);
+		if (first != second || first == other)
+		{
+			LT_ERROR("ShaderCacheTest: identical sources: programs aren't shared by identical sources only");
+			passed = false;
+		}
+
+		// saves both binaries
+		Light::ShaderCache::Terminate();
+	}
+
+	// the next run loads the saved binaries
+	counts = Counts();
+	Light::ShaderCache::Init(LT_TEST_SHADER_CACHE_PATH, std::make_unique<CountingCompiler>("device a", false, counts));
+	passed &= Light::ShaderCache::GetShader(vertex, fragment) && Light::ShaderCache::GetShader(vertex, otherFragment);
+	passed &= Expect("saved binaries", counts, 0u, 2u);
+	Light::ShaderCache::Terminate();
+
+	// ie. the driver was updated
+	counts = Counts();
+	Light::ShaderCache::Init(LT_TEST_SHADER_CACHE_PATH, std::make_unique<CountingCompiler>("device a", true, counts));
+	passed &= Light::ShaderCache::GetShader(vertex, fragment) != nullptr;
+	passed &= Expect("rejected binary", counts, 1u, 1u);
+	Light::ShaderCache::Terminate();
+
+	// binaries built by another device are never handed to it
+	counts = Counts();
+	Light::ShaderCache::Init(LT_TEST_SHADER_CACHE_PATH, std::make_unique<CountingCompiler>("device b", false, counts));
+	passed &= Light::ShaderCache::GetShader(vertex, fragment) != nullptr;
+	passed &= Expect("other device", counts, 1u, 0u);
+	Light::ShaderCache::Terminate();
+
+	std::remove(LT_TEST_SHADER_CACHE_PATH);
+	Light::ShaderCache::Init(Light::GraphicsContext::GetConfigurations().shaderCachePath);
+
+	if (passed)
+		LT_TRACE("ShaderCacheTest: passed");
+
+	return passed;
+}
+
+bool ShaderCacheTest::Expect(const char* name, const Counts& counts, unsigned int compiles, unsigned int loads)
+{
+	if (counts.compiles == compiles && counts.loads == loads)
+		return true;
+
+	LT_ERROR("ShaderCacheTest: {}: {} compiles and {} loads instead of {} and {}", name, counts.compiles, counts.loads, compiles, loads);
+	return false;
+}
\ No newline at end of file
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <LightEngine.h>
+
+// drives ShaderCache with a compiler that counts its calls: identical sources are compiled once, saved binaries are
+// loaded by the next run without compiling, rejected binaries are recompiled and other devices' binaries aren't loaded
+class ShaderCacheTest
+{
+private:
+	struct Counts
+	{
+		unsigned int compiles = 0u;
+		unsigned int loads = 0u;
+	};
+
+	class CountingCompiler : public Light::ShaderCompiler
+	{
+	private:
+		std::string m_DeviceName;
+		bool b_RejectBinaries;
+
+		Counts& m_Counts;
+	public:
+		CountingCompiler(const std::string& deviceName, bool rejectBinaries, Counts& counts);
+
+		std::string GetDeviceName() override { return m_DeviceName; }
+
+		std::shared_ptr<Light::Shader> Compile(const std::string& vertexSource, const std::string& fragmentSource, std::vector<uint8_t>& binary) override;
+		std::shared_ptr<Light::Shader> Load(const std::string& vertexSource, const std::string& fragmentSource, const std::vector<uint8_t>& binary) override;
+	};
+public:
+	ShaderCacheTest() = delete;
+
+	// the application's shader cache is saved before and reloaded after, returns false and logs an error for every case that fails
+	static bool Run();
+private:
+	static bool Expect(const char* name, const Counts& counts, unsigned int compiles, unsigned int loads);
+};
\ No newline at end of file
@@ -0,0 +1,93 @@
+#include "StaticBatchDefragmentTest.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+// allocated textures are pinned, the sprite's texture has to be loaded from a file to be moved
+#define LT_TEST_TEXTURE_PATH "StaticBatchDefragmentTest.ppm"
+
+bool StaticBatchDefragmentTest::Run()
+{
+	const Light::GraphicsAPI api = Light::GraphicsContext::GetAPI();
+	const Light::GraphicsConfigurations configurations = Light::GraphicsContext::GetConfigurations();
+
+	Light::GraphicsContext::CreateContext(Light::GraphicsAPI::Null, configurations);
+
+	/* locals */
+	bool passed = true;
+
+	{
+		std::shared_ptr<Light::TextureArray> textures = Light::TextureArray::Create(1024u, 1024u, 2u);
+
+		// 'filler' fills the rest of slice 0 so 'sprite' is placed in slice 1, next to 'neighbour'
+		textures->AllocateTexture("large", 1024u, 700u);
+		textures->AllocateTexture("filler", 1024u, 324u);
+		textures->ResolveTextures();
+
+		// binary ppm, loaded by stb_image like the other formats
+		{
+			std::ofstream file(LT_TEST_TEXTURE_PATH, std::ios::binary);
+			file << "P6\n200 300\n255\n";
+
+			const std::vector<char> pixels(200u * 300u * 3u, (char)0xff);
+			file.write(pixels.data(), pixels.size());
+		}
+
+		textures->AllocateTexture("neighbour", 1024u, 400u);
+		textures->LoadTexture("sprite", LT_TEST_TEXTURE_PATH);
+		textures->ResolveTextures();
+
+		std::remove(LT_TEST_TEXTURE_PATH);
+
+		std::shared_ptr<Light::Texture> sprite = textures->GetTexture("sprite");
+		const Light::TextureCoordinates before = *sprite->GetTextureUV();
+
+		std::shared_ptr<Light::StaticBatch> batch = std::make_shared<Light::StaticBatch>();
+		batch->AddSprite(glm::vec3(0.0f), glm::vec2(200.0f, 300.0f), 0.0f, sprite, sprite->GetTextureUV());
+
+		std::shared_ptr<Light::Camera> camera = std::make_shared<Light::Camera>(glm::vec2(0.0f, 0.0f), Light::GraphicsContext::GetAspectRatio(), 1000.0f);
+
+		auto draw = [&]()
+		{
+			Light::Renderer::BeginFrame();
+			Light::Renderer::BeginScene(camera);
+			Light::Renderer::DrawStaticBatch(batch);
+			Light::Renderer::EndScene();
+			Light::Renderer::EndFrame();
+		};
+
+		draw();
+
+		// slice 1 is left almost empty, the sprite is evacuated into the space of 'filler'
+		textures->DeleteTexture("filler");
+		textures->DeleteTexture("neighbour");
+		textures->Defragment();
+
+		const Light::TextureCoordinates after = *sprite->GetTextureUV();
+		if (after.sliceIndex == before.sliceIndex)
+		{
+			LT_ERROR("StaticBatchDefragmentTest: the texture wasn't moved by the defragmenter, slice {}", before.sliceIndex);
+			passed = false;
+		}
+
+		draw();
+
+		const Light::QuadInstance expected = Light::QuadInstance::Pack(glm::vec3(0.0f), glm::vec2(100.0f, 150.0f), 0.0f, after, glm::vec4(1.0f));
+		const Light::QuadInstance& actual = batch->GetSprite(0u);
+
+		if (std::memcmp(expected.texRect, actual.texRect, sizeof(expected.texRect)) || expected.slice[0] != actual.slice[0])
+		{
+			LT_ERROR("StaticBatchDefragmentTest: the batch's sprite wasn't repacked, slice {} instead of {}", actual.slice[0], expected.slice[0]);
+			passed = false;
+		}
+	}
+
+	Light::GraphicsContext::CreateContext(api, configurations);
+
+	if (passed)
+		LT_TRACE("StaticBatchDefragmentTest: passed");
+
+	return passed;
+}
\ No newline at end of file
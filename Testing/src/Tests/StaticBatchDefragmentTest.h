@@ -0,0 +1,15 @@
+#pragma once
+
+#include <LightEngine.h>
+
+// builds a static batch from a texture in a sparse slice, deletes the textures around it so TextureArray::Defragment
+// moves it into another slice, draws the batch and checks its sprite was repacked with the texture's new coordinates,
+// runs on the null graphics context, the previous graphics api is restored
+class StaticBatchDefragmentTest
+{
+public:
+	StaticBatchDefragmentTest() = delete;
+
+	// returns false and logs an error if the batch kept the old coordinates
+	static bool Run();
+};
\ No newline at end of file
@@ -0,0 +1,51 @@
+#include <LightEngine.h>
+
+// bakes a texture manifest into a cache loaded by ResourceManager::SetTextureCache
+// paths in the manifest are relative to the working directory and have to match the ones the game loads with
+// the dimensions have to match the texture array the cache is loaded into, otherwise it's rebaked at runtime
+int main(int argc, char** argv)
+{
+	if (argc != 3 && argc != 7)
+	{
+		std::printf("usage: TextureBaker <manifest> <output> [width height depth channels]\n");
+		return 1;
+	}
+
+	/* locals */
+	unsigned int width = 2048u, height = 2048u, depth = 16u, channels = 4u;
+	int exitCode = 0;
+
+	if (argc == 7)
+	{
+		width = std::stoul(argv[3]);
+		height = std::stoul(argv[4]);
+		depth = std::stoul(argv[5]);
+		channels = std::stoul(argv[6]);
+	}
+
+	Light::Logger::Init();
+	Light::JobSystem::Init();
+
+	try
+	{
+		std::vector<Light::TextureSource> sources = Light::TextureCache::LoadManifest(argv[1]);
+
+		if (sources.empty())
+		{
+			LT_ERROR("TextureBaker: no textures in manifest: {}", argv[1]);
+			exitCode = 1;
+		}
+		else if (!Light::TextureCache::Bake(sources, width, height, depth, channels, argv[2]))
+			exitCode = 1;
+	}
+	catch (Light::FailedAssertion fa)
+	{
+		LT_FATAL("TextureBaker exited due to FailedAssertion");
+		exitCode = -1;
+	}
+
+	Light::JobSystem::Terminate();
+	Light::Logger::Terminate();
+
+	return exitCode;
+}
\ No newline at end of file
@@ -0,0 +1,27 @@
+#include <LightEngine.h>
+
+#include <filesystem>
+
+// converts a binary trace written by the Instrumentor (ie. GameLoop.lttrace) into JSON for chrome://tracing
+// the output defaults to the trace's path with a .json extension
+int main(int argc, char** argv)
+{
+	if (argc != 2 && argc != 3)
+	{
+		std::printf("usage: TraceConverter <trace> [output]\n");
+		return 1;
+	}
+
+	/* locals */
+	std::string output = argc == 3 ? argv[2] : std::filesystem::path(argv[1]).replace_extension(".json").string();
+	int exitCode = 0;
+
+	Light::Logger::Init();
+
+	if (!Light::Instrumentor::ConvertToChromeTrace(argv[1], output))
+		exitCode = 1;
+
+	Light::Logger::Terminate();
+
+	return exitCode;
+}
\ No newline at end of file
@@ -17,6 +17,8 @@ DependenciesDir = "%{wks.location}/Dependencies/"
 
 include "Light Engine/"
 include "Sandbox/"
+include "TextureBaker/"
+include "TraceConverter/"
 include "Demo/"
 include "Testing/"
 include "glfw/"